@@ -0,0 +1,153 @@
+/*
+ * author Connor Walsh
+ * file   benchmark.cpp
+ * brief  this file times ConjugateGradientSolver against
+ *        PipelinedConjugateGradientSolver on the sparse DirichletPoisson
+ *        operator for an increasing number of threads. Each time is the
+ *        best of a number of repetitions so that noise from the rest of the
+ *        machine is kept out. The input parameters can define the number of
+ *        divisions, the repetitions, the largest number of threads and
+ *        whether to output in a csv type format
+ */
+
+#include <iostream>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+#include "../linear_algebra/matrix_solver/ConjugateGradientSolver.h"
+#include "../linear_algebra/matrix_solver/PipelinedConjugateGradientSolver.h"
+#include "../linear_algebra/math_matrix/SparseMathMatrix.h"
+
+#include "../linear_algebra/DirichletPoisson.h"
+#include "../linear_algebra/PoissonFunctions.h"
+#include "../parallel/ThreadPool.h"
+
+using namespace std;
+
+/*
+ * brief  Returns the best time in nanoseconds of repetitions solves of
+ *        Ax = b by solver
+ */
+template <class Solver>
+long long bestTime(const Solver& solver, const SparseMathMatrix<double>& A,
+    const MathVector<double>& b, int repetitions)
+{
+  long long best = 0;
+  for (int i = 0; i < repetitions; ++i)
+  {
+    auto begin = std::chrono::high_resolution_clock::now();
+    solver.solve(A, b);
+    auto end = std::chrono::high_resolution_clock::now();
+    long long elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>
+      (end-begin).count();
+    if (i == 0 || elapsed < best)
+    {
+      best = elapsed;
+    }
+  }
+  return best;
+}
+
+int main (int argc, char** argv) {
+
+  int divisions = 200;
+  int repetitions = 3;
+  int maxThreads = std::thread::hardware_concurrency();
+  int fileOutput = 0;
+
+  if (maxThreads < 1)
+  {
+    maxThreads = 1;
+  }
+
+  if (argc != 1 && argc != 4 && argc != 5)
+  {
+    std::cout << "Usage: benchmark [divisions  repetitions  threads]"
+      " [file friendly]" << std::endl;
+    return 0;
+  }
+  else if (argc >= 4)
+  {
+    istringstream ss(argv[1]);
+    if (!(ss >> divisions) || divisions < 2)
+    {
+      std::cout << "Invalid number of divisions! Must be at least 2"
+        << std::endl;
+      return 0;
+    }
+    istringstream ss2(argv[2]);
+    if (!(ss2 >> repetitions) || repetitions < 1)
+    {
+      std::cout << "Invalid number of repetitions! Must be positive"
+        << std::endl;
+      return 0;
+    }
+    istringstream ss3(argv[3]);
+    if (!(ss3 >> maxThreads) || maxThreads < 1)
+    {
+      std::cout << "Invalid number of threads! Must be positive" << std::endl;
+      return 0;
+    }
+  }
+  if (argc == 5)
+  {
+    istringstream ss(argv[4]);
+    if (!(ss >> fileOutput))
+    {
+      std::cout << "File output parameter must be a valid number (0=false)"
+        << std::endl;
+    }
+  }
+
+  bool fileFriendly = (fileOutput == 0) ? false : true;
+
+  ConjugateGradientSolver<double> cg;
+  PipelinedConjugateGradientSolver<double> pipelined;
+  DirichletPoisson<double, ConjugateGradientSolver<double> >
+    dirichlet(0.0, 0.0, 1.0, cg);
+
+  SparseMathMatrix<double> A = dirichlet.getSparseOperator(divisions);
+  MathVector<double> b(A.rows());
+  dirichlet.generateConstants
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(b);
+
+  if (!fileFriendly)
+  {
+    cout << "== Parameters ==\n\tDivisions:\t" << divisions
+      << "\n\tUnknowns:\t" << A.rows() << "\n\tRepetitions:\t" << repetitions
+      << "\n\tThreads:\t" << maxThreads << std::endl;
+    cout << "== Timing Solvers (CG|Pipelined CG) ==\n";
+  }
+
+  // Doubling the threads each time, ending on maxThreads itself
+  int threads = 1;
+  while (true)
+  {
+    ThreadPool::setThreadCount(threads);
+
+    long long cgTime = bestTime(cg, A, b, repetitions);
+    long long pipelinedTime = bestTime(pipelined, A, b, repetitions);
+
+    if (!fileFriendly)
+    {
+      cout << "== " << threads << " threads: \t" << cgTime / 1000000
+        << " ms (" << cg.iterations() << " iterations)\t | "
+        << pipelinedTime / 1000000 << " ms (" << pipelined.iterations()
+        << " iterations)" << std::endl;
+    }
+    else
+    {
+      cout << threads << ", " << cgTime / 1000000 << ", "
+        << pipelinedTime / 1000000 << std::endl;
+    }
+
+    if (threads == maxThreads)
+    {
+      break;
+    }
+    threads = (threads * 2 < maxThreads) ? threads * 2 : maxThreads;
+  }
+
+  return 0;
+}
@@ -9,13 +9,58 @@
 
 #include <cstddef>
 
+#include "MonotonicArena.h"
+
+/*
+ * class ArrayInlineStorage
+ * brief Uninitialized room for N elements kept inside an Array object. The
+ * specialization for N == 0 is empty so Arrays without inline storage stay
+ * the same size
+ */
+template <class T, std::size_t N>
+class ArrayInlineStorage
+{
+  protected:
+    T* inlineData() noexcept
+    {
+      return reinterpret_cast<T*>(myStorage);
+    }
+
+    const T* inlineData() const noexcept
+    {
+      return reinterpret_cast<const T*>(myStorage);
+    }
+
+  private:
+    alignas(T) unsigned char myStorage[N * sizeof(T)];
+};
+
+template <class T>
+class ArrayInlineStorage<T, 0>
+{
+  protected:
+    T* inlineData() noexcept
+    {
+      return nullptr;
+    }
+
+    const T* inlineData() const noexcept
+    {
+      return nullptr;
+    }
+};
+
 /*
  * class Array
  * brief This class represents a simple array. It is created with a specific size
- * but can take on a new size when the = operator is used
+ * but can take on a new size when the = operator is used. Arrays of at most
+ * InlineSize elements keep them inside the object and never allocate. Larger
+ * storage comes from the global heap, or from the MonotonicArena the Array
+ * was constructed with. An Array keeps drawing from that arena when it
+ * grows, while copies of it are always allocated from the heap
  */
-template <class T>
-class Array
+template <class T, std::size_t InlineSize = 0>
+class Array : private ArrayInlineStorage<T, InlineSize>
 {
   public:
     typedef T value_type;
@@ -39,6 +84,15 @@ class Array
     */
     explicit Array(size_type size);
 
+    /*
+    * brief   Creates an Array of size whose storage, now and whenever it
+    *         grows, is drawn from arena
+    * pre     arena must not be rewound past this Array's storage while the
+    *         Array holds it
+    * post    Array is of size and contains default constructed elements
+    */
+    Array(size_type size, MonotonicArena& arena);
+
     /*
     * brief   Creates a copy of the passed in Array
     * post    This now contains a copy of the elements in other
@@ -52,6 +106,15 @@ class Array
     */
     Array(Array&& other);
 
+    /*
+    * brief   Creates an Array from one with a different inline size
+    * post    This contains a copy of, or the moved data from, other
+    */
+    template <std::size_t OtherSize>
+    Array(const Array<T, OtherSize>& other);
+    template <std::size_t OtherSize>
+    Array(Array<T, OtherSize>&& other);
+
     /*
     * brief   Deletes the Array
     * post    MyData now contains a nullptr and all elements T[] are 
@@ -100,6 +163,22 @@ class Array
     */
     size_type size() const noexcept;
 
+    /*
+    * brief   Returns the number of elements the Array can hold before resize
+    *         needs to allocate
+    * post    Returns the capacity of the Array by value
+    */
+    size_type capacity() const noexcept;
+
+    /*
+    * brief   Changes the size of the Array. Storage is only reallocated when
+    *         size is larger than the current capacity, so shrinking and then
+    *         growing back to the old size never allocates
+    * post    Array is of size; the first min(old size, size) elements keep
+    *         their values and any new elements are default constructed
+    */
+    void resize(size_type size);
+
     /*
     * brief   swaps the data elements of this with other
     * post    this now contains other's data and other now contains this's data
@@ -108,8 +187,45 @@ class Array
     void swap(Array& other) noexcept;
 
   private:
+    template <class U, std::size_t OtherSize>
+    friend class Array;
+
+    /*
+    * brief   Returns true if the elements are stored inside this object
+    */
+    bool isInline() const noexcept;
+
+    /*
+    * brief   Allocates storage for at least size default constructed elements.
+    *         Sizes up to InlineSize use the inline buffer, otherwise storage
+    *         comes from arena, or the heap if arena is nullptr
+    * pre     When size fits inline the inline buffer must not be in use
+    * post    Returns the storage and sets capacity to the number of elements
+    *         constructed
+    */
+    T* allocate(size_type size, size_type& capacity, MonotonicArena* arena);
+
+    /*
+    * brief   Destroys capacity elements of data and returns the storage to
+    *         where allocate() took it from when given the same arena
+    * post    data is no longer valid
+    */
+    void deallocate(T* data, size_type capacity, MonotonicArena* arena) noexcept;
+
+    /*
+    * brief   Takes the elements of other, moving them one by one when other
+    *         keeps them inline and taking its storage otherwise
+    * pre     This must hold no storage
+    * post    This holds other's elements and other is empty
+    */
+    template <std::size_t OtherSize>
+    void steal(Array<T, OtherSize>& other);
+
     size_type mySize;
+    size_type myCapacity;
     T* myData;
+    // The arena storage is drawn from, nullptr meaning the heap
+    MonotonicArena* myArena;
 };
 
 #include "Array.hpp"
@@ -6,58 +6,163 @@
 
 #include <stdexcept>
 #include <algorithm>
+#include <new>
 
 #include "Array.h"
 
-template <class T>
-Array<T>::Array() : mySize(0), myData(nullptr) {}
+template <class T, std::size_t N>
+bool Array<T, N>::isInline() const noexcept
+{
+  return N > 0 && myData == this->inlineData();
+}
 
-template <class T>
-Array<T>::Array(Array<T>::size_type size) : mySize(size)
+template <class T, std::size_t N>
+T* Array<T, N>::allocate(Array<T, N>::size_type size,
+    Array<T, N>::size_type& capacity, MonotonicArena* arena)
 {
-  myData = new T[mySize]();
+  if (N > 0 && size <= N)
+  {
+    T* data = this->inlineData();
+    for (size_type i = 0; i < N; ++i)
+    {
+      new (data + i) T();
+    }
+    capacity = N;
+    return data;
+  }
+
+  capacity = size;
+  if (arena == nullptr)
+  {
+    return new T[size]();
+  }
+
+  T* data = static_cast<T*>(arena->allocate(size * sizeof(T), alignof(T)));
+  for (size_type i = 0; i < size; ++i)
+  {
+    new (data + i) T();
+  }
+  return data;
 }
 
-template <class T>
-Array<T>::Array(const Array<T>& other) : mySize(other.mySize)
+template <class T, std::size_t N>
+void Array<T, N>::deallocate(T* data, Array<T, N>::size_type capacity,
+    MonotonicArena* arena) noexcept
 {
-  myData = new T[mySize];
-  std::copy(other.myData, other.myData + other.mySize, myData);
+  if (arena == nullptr && (N == 0 || data != this->inlineData()))
+  {
+    delete[] data;
+    return;
+  }
+
+  // Inline and arena storage only need their elements destroyed
+  for (size_type i = 0; i < capacity; ++i)
+  {
+    data[i].~T();
+  }
 }
 
-template <class T>
-Array<T>::Array(Array<T>&& other) : mySize(other.mySize), myData(other.myData)
+template <class T, std::size_t N>
+template <std::size_t M>
+void Array<T, N>::steal(Array<T, M>& other)
 {
+  myArena = other.myArena;
+  if (other.isInline())
+  {
+    myData = allocate(other.mySize, myCapacity, myArena);
+    std::move(other.myData, other.myData + other.mySize, myData);
+    other.deallocate(other.myData, other.myCapacity, other.myArena);
+  }
+  else
+  {
+    myData = other.myData;
+    myCapacity = other.myCapacity;
+  }
+  mySize = other.mySize;
+
   other.myData = nullptr;
+  other.mySize = 0;
+  other.myCapacity = 0;
+  other.myArena = nullptr;
+}
+
+template <class T, std::size_t N>
+Array<T, N>::Array() : mySize(0), myCapacity(0), myData(nullptr),
+    myArena(nullptr) {}
+
+template <class T, std::size_t N>
+Array<T, N>::Array(Array<T, N>::size_type size) : mySize(size),
+    myArena(nullptr)
+{
+  myData = allocate(mySize, myCapacity, myArena);
 }
 
-template <class T>
-Array<T>::~Array()
+template <class T, std::size_t N>
+Array<T, N>::Array(Array<T, N>::size_type size, MonotonicArena& arena)
+  : mySize(size), myArena(&arena)
 {
-  delete[] myData;
+  myData = allocate(mySize, myCapacity, myArena);
 }
 
-template <class T>
-typename Array<T>::value_type& Array<T>::operator[](Array<T>::size_type index)
+template <class T, std::size_t N>
+Array<T, N>::Array(const Array<T, N>& other) : mySize(other.mySize),
+    myArena(nullptr)
+{
+  myData = allocate(mySize, myCapacity, myArena);
+  std::copy(other.myData, other.myData + other.mySize, myData);
+}
+
+template <class T, std::size_t N>
+Array<T, N>::Array(Array<T, N>&& other) : mySize(0), myCapacity(0),
+    myData(nullptr), myArena(nullptr)
+{
+  steal(other);
+}
+
+template <class T, std::size_t N>
+template <std::size_t M>
+Array<T, N>::Array(const Array<T, M>& other) : mySize(other.size()),
+    myArena(nullptr)
+{
+  myData = allocate(mySize, myCapacity, myArena);
+  std::copy(other.begin(), other.end(), myData);
+}
+
+template <class T, std::size_t N>
+template <std::size_t M>
+Array<T, N>::Array(Array<T, M>&& other) : mySize(0), myCapacity(0),
+    myData(nullptr), myArena(nullptr)
+{
+  steal(other);
+}
+
+template <class T, std::size_t N>
+Array<T, N>::~Array()
+{
+  deallocate(myData, myCapacity, myArena);
+}
+
+template <class T, std::size_t N>
+typename Array<T, N>::value_type& Array<T, N>::operator[](Array<T, N>::size_type index)
 {
   return myData[index];
 }
 
-template <class T>
-const typename Array<T>::value_type& Array<T>::operator[](Array<T>::size_type index) const
+template <class T, std::size_t N>
+const typename Array<T, N>::value_type& Array<T, N>::operator[](Array<T, N>::size_type index) const
 {
   return myData[index];
 }
 
-template <class T>
-Array<T>& Array<T>::operator=(Array<T> other) noexcept
+template <class T, std::size_t N>
+Array<T, N>& Array<T, N>::operator=(Array<T, N> other) noexcept
 {
   this->swap(other);
   return *this;
 }
 
-template <class T>
-typename Array<T>::value_type& Array<T>::at(Array<T>::size_type index)
+template <class T, std::size_t N>
+typename Array<T, N>::value_type& Array<T, N>::at(Array<T, N>::size_type index)
 {
   if (index >= mySize)
   {
@@ -67,8 +172,8 @@ typename Array<T>::value_type& Array<T>::at(Array<T>::size_type index)
   return myData[index];
 }
 
-template <class T>
-const typename Array<T>::value_type& Array<T>::at(Array<T>::size_type index) const
+template <class T, std::size_t N>
+const typename Array<T, N>::value_type& Array<T, N>::at(Array<T, N>::size_type index) const
 {
   if (index >= mySize)
   {
@@ -78,47 +183,78 @@ const typename Array<T>::value_type& Array<T>::at(Array<T>::size_type index) con
   return myData[index];
 }
 
-template <class T>
-typename Array<T>::iterator Array<T>::begin() noexcept
+template <class T, std::size_t N>
+typename Array<T, N>::iterator Array<T, N>::begin() noexcept
 {
   return myData;
 }
 
-template <class T>
-typename Array<T>::iterator Array<T>::end() noexcept
+template <class T, std::size_t N>
+typename Array<T, N>::iterator Array<T, N>::end() noexcept
 {
   return myData + mySize;
 }
 
-template <class T>
-typename Array<T>::const_iterator Array<T>::begin() const noexcept
+template <class T, std::size_t N>
+typename Array<T, N>::const_iterator Array<T, N>::begin() const noexcept
 {
   return myData;
 }
 
-template <class T>
-typename Array<T>::const_iterator Array<T>::end() const noexcept
+template <class T, std::size_t N>
+typename Array<T, N>::const_iterator Array<T, N>::end() const noexcept
 {
   return myData + mySize;
 }
 
-template <class T>
-typename Array<T>::size_type Array<T>::size() const noexcept
+template <class T, std::size_t N>
+typename Array<T, N>::size_type Array<T, N>::size() const noexcept
 {
   return mySize;
 } 
 
-template <class T>
-void Array<T>::swap(Array<T>& other) noexcept
+template <class T, std::size_t N>
+typename Array<T, N>::size_type Array<T, N>::capacity() const noexcept
+{
+  return myCapacity;
+}
+
+template <class T, std::size_t N>
+void Array<T, N>::resize(Array<T, N>::size_type size)
+{
+  if (size > myCapacity)
+  {
+    // Anything larger than the capacity cannot fit inline, so the new
+    // storage never overlaps the old
+    size_type newCapacity;
+    T* newData = allocate(size, newCapacity, myArena);
+    std::copy(myData, myData + mySize, newData);
+    deallocate(myData, myCapacity, myArena);
+    myData = newData;
+    myCapacity = newCapacity;
+  }
+  else
+  {
+    std::fill(myData + std::min(mySize, size), myData + size, T());
+  }
+  mySize = size;
+}
+
+template <class T, std::size_t N>
+void Array<T, N>::swap(Array<T, N>& other) noexcept
 {
-  std::swap(myData, other.myData);
-  std::swap(mySize, other.mySize);
+  // Inline elements cannot change owner by swapping pointers, so go through
+  // a temporary that moves them when needed
+  Array<T, N> temp;
+  temp.steal(*this);
+  steal(other);
+  other.steal(temp);
 
   return;
 }
 
-template <class T>
-bool operator==(const Array<T>& lhs, const Array<T>& rhs)
+template <class T, std::size_t N>
+bool operator==(const Array<T, N>& lhs, const Array<T, N>& rhs)
 {
   if (lhs.size() != rhs.size())
   {
@@ -137,14 +273,14 @@ bool operator==(const Array<T>& lhs, const Array<T>& rhs)
   return true;
 }
 
-template <class T>
-bool operator!=(const Array<T>& lhs, const Array<T>& rhs)
+template <class T, std::size_t N>
+bool operator!=(const Array<T, N>& lhs, const Array<T, N>& rhs)
 {
   return !(lhs == rhs);
 }
 
-template <class T>
-void swap(Array<T>& lhs, Array<T>& rhs) noexcept
+template <class T, std::size_t N>
+void swap(Array<T, N>& lhs, Array<T, N>& rhs) noexcept
 {
   lhs.swap(rhs);
 }
@@ -0,0 +1,149 @@
+/*
+ * author Connor Walsh
+ * brief  This file provides a monotonic arena allocator together with a
+ *        guard that rewinds it
+ */
+
+#ifndef MONOTONIC_ARENA_H
+#define MONOTONIC_ARENA_H
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * class MonotonicArena
+ * brief This class hands out memory by bumping an offset through a list of
+ * blocks. Individual allocations are never freed, instead the arena is
+ * rewound to an earlier mark which releases everything allocated after it.
+ * Blocks are kept when rewinding so an arena that has warmed up serves
+ * further allocations without touching the global heap
+ */
+class MonotonicArena
+{
+  public:
+    /*
+     * brief  Position in the arena that can be rewound to
+     */
+    struct Marker
+    {
+      std::size_t block;
+      std::size_t offset;
+    };
+
+    static const std::size_t defaultBlockSize = 64 * 1024;
+
+    /*
+    * brief   Creates an empty arena
+    * post    No memory is held; blocks of at least blockSize bytes are
+    *         allocated on demand
+    */
+    explicit MonotonicArena(std::size_t blockSize = defaultBlockSize);
+
+    /*
+    * brief   Frees every block held by the arena
+    * post    Memory handed out by this arena is no longer valid
+    */
+    ~MonotonicArena();
+
+    MonotonicArena(const MonotonicArena& other) = delete;
+    MonotonicArena& operator=(const MonotonicArena& other) = delete;
+
+    /*
+    * brief   Returns bytes of memory aligned to alignment
+    * pre     alignment must be a power of two
+    * post    Returned memory is valid until the arena is rewound past it
+    */
+    void* allocate(std::size_t bytes, std::size_t alignment);
+
+    /*
+    * brief   Returns the current position of the arena
+    * post    Returned marker can be passed to rewind()
+    */
+    Marker mark() const noexcept;
+
+    /*
+    * brief   Releases everything allocated after marker
+    * pre     marker must have come from mark() on this arena and no earlier
+    *         marker may have been rewound to since
+    * post    Memory allocated after marker may be handed out again
+    */
+    void rewind(const Marker& marker) noexcept;
+
+    /*
+    * brief   Releases everything allocated from the arena
+    * post    The arena is empty but keeps its blocks for reuse
+    */
+    void release() noexcept;
+
+    /*
+    * brief   Returns the number of bytes handed out since the last release
+    * post    Returns the bytes in use including alignment padding
+    */
+    std::size_t bytesUsed() const noexcept;
+
+    /*
+    * brief   Returns the total size of the blocks held by the arena
+    * post    Returns the capacity in bytes
+    */
+    std::size_t capacity() const noexcept;
+
+    /*
+    * brief   Returns an arena owned by the calling thread for use by library
+    *         code that needs scratch memory
+    * post    Returns the same arena for every call on a given thread
+    */
+    static MonotonicArena& threadArena()
+    {
+      static thread_local MonotonicArena arena;
+      return arena;
+    }
+
+  private:
+    struct Block
+    {
+      char* data;
+      std::size_t size;
+    };
+
+    std::vector<Block> myBlocks;
+    std::size_t myBlock;
+    std::size_t myOffset;
+    std::size_t myBlockSize;
+};
+
+/*
+ * class ArenaRewind
+ * brief Marks an arena when created and rewinds it to that mark when
+ * destroyed, so a kernel can release its scratch memory on every path out,
+ * exceptions included. Only Arrays explicitly given the arena draw from it,
+ * and they must be destroyed before the ArenaRewind
+ */
+class ArenaRewind
+{
+  public:
+    /*
+    * brief   Marks arena
+    */
+    explicit ArenaRewind(MonotonicArena& arena)
+      : myArena(arena), myMarker(arena.mark()) {}
+
+    /*
+    * brief   Rewinds arena to the mark
+    * post    Memory allocated from arena since construction is released
+    */
+    ~ArenaRewind()
+    {
+      myArena.rewind(myMarker);
+    }
+
+    ArenaRewind(const ArenaRewind& other) = delete;
+    ArenaRewind& operator=(const ArenaRewind& other) = delete;
+
+  private:
+    MonotonicArena& myArena;
+    MonotonicArena::Marker myMarker;
+};
+
+#include "MonotonicArena.hpp"
+
+#endif
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+// author Connor Walsh
+// file   MonotonicArena.hpp
+// brief  Implementation of the MonotonicArena class
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "MonotonicArena.h"
+
+inline MonotonicArena::MonotonicArena(std::size_t blockSize)
+  : myBlock(0), myOffset(0), myBlockSize(blockSize) {}
+
+inline MonotonicArena::~MonotonicArena()
+{
+  for (Block& block : myBlocks)
+  {
+    delete[] block.data;
+  }
+}
+
+inline void* MonotonicArena::allocate(std::size_t bytes, std::size_t alignment)
+{
+  while (myBlock < myBlocks.size())
+  {
+    Block& block = myBlocks[myBlock];
+    std::size_t address = reinterpret_cast<std::size_t>(block.data) + myOffset;
+    std::size_t padding = (alignment - (address % alignment)) % alignment;
+    if (myOffset + padding + bytes <= block.size)
+    {
+      void* result = block.data + myOffset + padding;
+      myOffset += padding + bytes;
+      return result;
+    }
+
+    // Skip to the next block, but never past one that is too small to
+    // ever satisfy this request so it stays available for later requests
+    if (myBlock + 1 < myBlocks.size() &&
+        myBlocks[myBlock + 1].size >= bytes + alignment)
+    {
+      ++myBlock;
+      myOffset = 0;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  Block block;
+  block.size = std::max(myBlockSize, bytes + alignment);
+  block.data = new char[block.size];
+  std::size_t position = myBlocks.empty() ? 0 : myBlock + 1;
+  myBlocks.insert(myBlocks.begin() + position, block);
+  myBlock = position;
+  myOffset = 0;
+
+  return allocate(bytes, alignment);
+}
+
+inline MonotonicArena::Marker MonotonicArena::mark() const noexcept
+{
+  Marker marker;
+  marker.block = myBlock;
+  marker.offset = myOffset;
+  return marker;
+}
+
+inline void MonotonicArena::rewind(const Marker& marker) noexcept
+{
+  myBlock = marker.block;
+  myOffset = marker.offset;
+}
+
+inline void MonotonicArena::release() noexcept
+{
+  myBlock = 0;
+  myOffset = 0;
+}
+
+inline std::size_t MonotonicArena::bytesUsed() const noexcept
+{
+  std::size_t result = myOffset;
+  for (std::size_t block = 0; block < myBlock && block < myBlocks.size(); ++block)
+  {
+    result += myBlocks[block].size;
+  }
+  return result;
+}
+
+inline std::size_t MonotonicArena::capacity() const noexcept
+{
+  std::size_t result = 0;
+  for (const Block& block : myBlocks)
+  {
+    result += block.size;
+  }
+  return result;
+}
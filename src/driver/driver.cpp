@@ -2,7 +2,9 @@
  * author Connor Walsh
  * file   driver.cpp
  * brief  this file profides simple testing of the DirichletPoisson class
- *        using two different types of solvers, Gaussian and QR
+ *        using three different types of solvers, Gaussian, QR and conjugate
+ *        gradient. The conjugate gradient column starts each resolution
+ *        from the previous solution interpolated onto the new grid
  *        The input parameters can define the number of divisions to make
  *        and whether to output in a csv type format
  */
@@ -13,6 +15,7 @@
 
 #include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
 #include "../linear_algebra/matrix_solver/QRSolver.h"
+#include "../linear_algebra/matrix_solver/ConjugateGradientSolver.h"
 
 #include "../linear_algebra/DirichletPoisson.h"
 #include "../linear_algebra/PoissonFunctions.h"
@@ -75,14 +78,18 @@ int main (int argc, char** argv) {
   {
     cout << "== Parameters ==\n\tStart:\t\t" << startDivisions << "\n\tEnd:\t\t"
       << endDivisions << "\n\tIncrement:\t" << increment << std::endl;
-    cout << "== Testing Solvers (Gaussian|QR) ==\n";
+    cout << "== Testing Solvers (Gaussian|QR|CG) ==\n";
   }
 
   GaussianEliminationSolver<double> gauss;
   QRSolver<double> qr;
 
-  DirichletPoisson<double> dirichletGauss(0.0, 0.0, 1.0, gauss);
-  DirichletPoisson<double> dirichletQR(0.0, 0.0, 1.0, qr);
+  DirichletPoisson<double, GaussianEliminationSolver<double> >
+    dirichletGauss(0.0, 0.0, 1.0, gauss);
+  DirichletPoisson<double, QRSolver<double> > dirichletQR(0.0, 0.0, 1.0, qr);
+  ConjugateGradientSolver<double> cg;
+  DirichletPoisson<double, ConjugateGradientSolver<double> >
+    dirichletCG(0.0, 0.0, 1.0, cg);
   
   for (int i = startDivisions; i <= endDivisions; i += increment)
   {
@@ -124,7 +131,26 @@ int main (int argc, char** argv) {
       (end-begin).count();
     if (!fileFriendly)
     {
-      std::cout << "\t\t | " << elapsed / 1000000 << " ms" << std::endl;
+      std::cout << "\t\t | " << elapsed / 1000000 << " ms";
+    }
+    else
+    {
+      std::cout << elapsed / 1000000 << ", ";
+    }
+    cout.flush();
+
+    begin = std::chrono::high_resolution_clock::now();
+
+    dirichletCG.getNestedSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(i);
+
+    end = std::chrono::high_resolution_clock::now();
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>
+      (end-begin).count();
+    if (!fileFriendly)
+    {
+      std::cout << "\t | " << elapsed / 1000000 << " ms ("
+        << cg.iterations() << " iterations)" << std::endl;
     }
     else
     {
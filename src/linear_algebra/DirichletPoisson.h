@@ -10,23 +10,64 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+
 #include "math_matrix/IMathMatrix.h"
+#include "math_matrix/SparseMathMatrix.h"
 #include "matrix_solver/IMatrixSolver.h"
+#include "matrix_solver/IMatrixFactorization.h"
 #include "MathVector.h"
+#include "PoissonProblem.h"
 
 /*
  * class DirichletPoisson
  * brief  This class is used to generate and solve the Poisson equation 
  *        given the boundary conditions, area, number of divisions to make,
- *        and a IMatrixSolver to use
+ *        and a IMatrixSolver to use. Solver defaults to the polymorphic
+ *        interface; passing a concrete solver type instead lets the whole
+ *        generate and solve pipeline be resolved at compile time
  */
-template <class T>
+template <class T, class Solver = IMatrixSolver<T> >
 class DirichletPoisson
 {
   private:
+    typedef typename PoissonProblem<T>::Identity Identity;
+
+    /*
+     * brief  Grid coordinates and boundary values for one number of
+     *        divisions and one set of boundary functions. Entry i of each
+     *        table belongs to grid index i + 1
+     */
+    struct BoundaryTables
+    {
+      BoundaryTables() : numDivs(0), source(0) {}
+
+      int numDivs;
+      Identity source;
+      MathVector<T> xCoords, yCoords;
+      MathVector<T> low, high, left, right;
+    };
+
+    /*
+     * brief  The last solution of getNestedSolution together with its number
+     *        of divisions and the boundary functions it was solved for
+     */
+    struct PreviousSolution
+    {
+      PreviousSolution() : numDivs(0), source(0) {}
+
+      int numDivs;
+      Identity source;
+      MathVector<T> values;
+    };
+
     T xLow, yLow, length;
     int numDivs;
-    IMatrixSolver<T>& mySolver;
+    Solver& mySolver;
+    mutable BoundaryTables myTables;
+    PreviousSolution myPrevious;
+    std::map<int, std::unique_ptr<IMatrixFactorization<T> > > myFactorizations;
 
     /*
      * brief  Function to get the index in a vector of the point in h coordinates
@@ -34,6 +75,68 @@ class DirichletPoisson
      * post   returns the index of the point given by input coordinates
      */
     int getPointOffset(int x, int y) const;
+
+    /*
+     * brief  Returns the boundary tables for the current divisions, only
+     *        evaluating the boundary functions if the cached tables were
+     *        built for other divisions or from functions other than source
+     * pre    source must be the identity of the boundary functions passed
+     *        in, from PoissonProblem::identity or functionsKey
+     * post   Returned tables hold the coordinates and boundary values for
+     *        numDivs
+     */
+    template <class Low, class High, class Left, class Right>
+    const BoundaryTables& boundaryTables(Identity source, const Low& fnLow,
+        const High& fnHigh, const Left& fnLeft, const Right& fnRight) const;
+
+    /*
+     * brief  Returns an identity unique to one set of template boundary
+     *        functions, drawn from the same sequence as the identities of
+     *        PoissonProblem so the two never collide
+     */
+    template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T)>
+    static Identity functionsKey();
+
+    /*
+     * brief  Assembles b from the boundary tables and a forceRow callable
+     *        which fills values[i] with the forcing function at (x[i], y)
+     *        for a whole grid row
+     * pre    Same as generateConstants
+     * post   Same as generateConstants
+     */
+    template <class ForceRow>
+    void assembleConstants(MathVector<T>& b, const BoundaryTables& tables,
+        const ForceRow& forceRow) const;
+
+    /*
+     * brief  Bilinearly interpolates coarse, the inner points of a grid of
+     *        coarseDivs divisions, onto the inner points of the current
+     *        divisions. Points of the coarse grid on the boundary take the
+     *        values of the boundary functions
+     * pre    coarse must have (coarseDivs - 1)^2 entries, coarseDivs > 0
+     * post   returns a vector of (numDivs - 1)^2 entries
+     */
+    template <class Low, class High, class Left, class Right>
+    MathVector<T> interpolate(const MathVector<T>& coarse, int coarseDivs,
+        const Low& fnLow, const High& fnHigh, const Left& fnLeft,
+        const Right& fnRight) const;
+
+    /*
+     * brief  Returns the initial guess getNestedSolution uses for the
+     *        current divisions and the functions identified by source: the
+     *        previous solution interpolated if it was solved for the same
+     *        functions, and zero otherwise
+     */
+    template <class Low, class High, class Left, class Right>
+    MathVector<T> nestedGuess(Identity source, const Low& fnLow,
+        const High& fnHigh, const Left& fnLeft, const Right& fnRight) const;
+
+    /*
+     * brief  Returns the factored operator for the current divisions,
+     *        assembling and factoring it with the solver on first use
+     * post   The factorization is cached until clearOperatorCache
+     */
+    const IMatrixFactorization<T>& factorization();
   
   public:
     /*
@@ -41,20 +144,67 @@ class DirichletPoisson
      *        to use for solving for the points and a default number of divisions
      * post   Creates a DirichletPoisson problem that is ready to solve
      */
-    DirichletPoisson(T lowX, T lowY, T plength, IMatrixSolver<T>& solver,
+    DirichletPoisson(T lowX, T lowY, T plength, Solver& solver,
         int numDivisions = 2) : xLow(lowX), yLow(lowY), length(plength), 
         numDivs(numDivisions), mySolver(solver) {};
 
     /*
      * brief  This function generates the A matrix and b vector in the equation
-     *        Ax = b for the current problem with the current number of divisions
+     *        Ax = b for the current problem with the current number of divisions.
+     *        Grid coordinates and boundary values are cached per number of
+     *        divisions, so the boundary functions are only evaluated the first
+     *        time a resolution is generated. A DirichletPoisson must therefore
+     *        not generate from more than one thread at a time
      * pre    A and b are of appropriate sizes for the current divisions
      *        i.e dimension length is equal to (#divisions - 1)^2
      * post   A is now equal to the coefficients for solving the poisson equation
      *        and b holds the constants for the given template parameters
      */
+    template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T),
+        class Matrix>
+    void generate(Matrix& A, MathVector<T>& b) const;
+
+    /*
+     * brief  Generates only the A matrix of generate, which depends on
+     *        nothing but the number of divisions
+     * pre    A is zero and of the size generate requires
+     * post   A holds the coefficients for the current divisions
+     */
+    template <class Matrix>
+    void generateOperator(Matrix& A) const;
+
+    /*
+     * brief  Returns the A matrix of generate for numDivisions divisions in
+     *        compressed sparse row form, assembled directly so the dense
+     *        matrix is never formed
+     * post   returns a matrix with at most five entries per row, numbered
+     *        as getPointOffset numbers the grid
+     */
+    SparseMathMatrix<T> getSparseOperator(int numDivisions);
+
+    /*
+     * brief  Generates only the b vector of generate from the boundary and
+     *        forcing functions
+     * pre    b is zero and of the size generate requires
+     * post   b holds the constants for the given functions
+     */
     template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
-    void generate(IMathMatrix<T>& A, MathVector<T>& b) const;
+    void generateConstants(MathVector<T>& b) const;
+    void generateConstants(MathVector<T>& b,
+        const PoissonProblem<T>& problem) const;
+
+    /*
+     * brief  Same as generate above but with the functions of problem chosen
+     *        at run time. The forcing function is evaluated a grid row at a
+     *        time through problem's forceRow when it is set. Cached boundary
+     *        values are keyed on problem's identity, so they are evaluated
+     *        again once its functions are replaced
+     * pre    A and b are of appropriate sizes for the current divisions
+     * post   A and b hold the same values the template version would give
+     */
+    template <class Matrix>
+    void generate(Matrix& A, MathVector<T>& b,
+        const PoissonProblem<T>& problem) const;
 
     /*
      * brief  This function calculates the solution for a Dirichlet Poisson problem
@@ -64,6 +214,107 @@ class DirichletPoisson
      */
     template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
     MathVector<T> getSolution(int numDivs);
+    MathVector<T> getSolution(int numDivs, const PoissonProblem<T>& problem);
+
+    /*
+     * brief  Same as getSolution but passes initialGuess, e.g. the solution
+     *        of the previous problem in a sequence of similar problems, on
+     *        to the solver's solveFrom. Iterative solvers start from it,
+     *        direct solvers ignore it
+     * pre    numDivs must be greater than 1 and initialGuess must have
+     *        (numDivs - 1)^2 entries if the solver uses it
+     * post   returns a vector containing the approximated inner points
+     */
+    template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
+    MathVector<T> getSolution(int numDivs, const MathVector<T>& initialGuess);
+    MathVector<T> getSolution(int numDivs, const PoissonProblem<T>& problem,
+        const MathVector<T>& initialGuess);
+
+    /*
+     * brief  Same as getSolution but for solvers that work on the grid
+     *        itself, such as RedBlackSORSolver, so A is never formed. Only
+     *        b is generated and passed to solver.solve(b, numDivs)
+     * pre    numDivs must be greater than 1. GridSolver must solve the
+     *        system generate produces given only b and numDivs
+     * post   returns a vector containing the approximated inner points
+     */
+    template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T),
+        class GridSolver>
+    MathVector<T> getGridSolution(int numDivs, const GridSolver& solver);
+    template <class GridSolver>
+    MathVector<T> getGridSolution(int numDivs, const PoissonProblem<T>& problem,
+        const GridSolver& solver);
+
+    /*
+     * brief  Same as getSolution but A is assembled by getSparseOperator
+     *        and handed to solver.solve(A, b), so the dense matrix is never
+     *        formed
+     * pre    numDivs must be greater than 1. SparseSolver must provide
+     *        solve(const SparseMathMatrix<T>&, const MathVector<T>&), as
+     *        SparseCholeskySolver and ReorderedSolver do
+     * post   returns a vector containing the approximated inner points
+     */
+    template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T),
+        class SparseSolver>
+    MathVector<T> getSparseSolution(int numDivs, const SparseSolver& solver);
+    template <class SparseSolver>
+    MathVector<T> getSparseSolution(int numDivs,
+        const PoissonProblem<T>& problem, const SparseSolver& solver);
+
+    /*
+     * brief  Same as getSolution but meant for sweeps over increasing
+     *        divisions. The solution of the previous call for the same
+     *        functions is interpolated onto the new grid and used as the
+     *        initial guess, so an iterative solver only has to remove the
+     *        discretization difference between the two grids. A
+     *        PoissonProblem counts as the same functions only while its
+     *        identity is unchanged, never because of its address
+     * pre    numDivs must be greater than 1
+     * post   returns a vector containing the approximated inner points and
+     *        keeps it for the next call
+     */
+    template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
+    MathVector<T> getNestedSolution(int numDivs);
+    MathVector<T> getNestedSolution(int numDivs,
+        const PoissonProblem<T>& problem);
+
+    /*
+     * brief  Bilinearly interpolates coarse, the inner points of a solution
+     *        on coarseDivs divisions, onto the inner points of numDivs
+     *        divisions, taking boundary values from the boundary functions
+     * pre    coarse must have (coarseDivs - 1)^2 entries, both divisions
+     *        must be positive
+     * post   returns a vector of (numDivs - 1)^2 entries
+     */
+    template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T)>
+    MathVector<T> interpolateSolution(const MathVector<T>& coarse,
+        int coarseDivs, int numDivs);
+    MathVector<T> interpolateSolution(const MathVector<T>& coarse,
+        int coarseDivs, int numDivs, const PoissonProblem<T>& problem);
+
+    /*
+     * brief  Forgets the solution kept by getNestedSolution
+     * post   The next getNestedSolution starts from zero
+     */
+    void clearNestedSolution();
+
+    /*
+     * brief  Same as getSolution, but the operator A is assembled and
+     *        factored by the solver only the first time a resolution is
+     *        solved. Later calls at that resolution only generate b and run
+     *        the substitution steps of the cached factorization
+     * pre    numDivs must be greater than 1
+     * post   returns a vector containing the approximated inner points
+     */
+    template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
+    MathVector<T> resolve(int numDivs);
+    MathVector<T> resolve(int numDivs, const PoissonProblem<T>& problem);
+
+    /*
+     * brief  Discards every cached factorization
+     * post   The next resolve at any resolution factors its operator again
+     */
+    void clearOperatorCache();
 
     /*
      * brief  Function for determing the correct answer points for the Poisson
@@ -74,6 +325,8 @@ class DirichletPoisson
      */
     template <T solution(T, T)>
     MathVector<T> getActualSolution(int numDivs);
+    MathVector<T> getActualSolution(int numDivs,
+        const std::function<T(T, T)>& solution);
 };
 
 #include "DirichletPoisson.hpp"
@@ -4,86 +4,240 @@
  * brief  Implementation file for DirichletPoisson class
  */
 
+#include <utility>
+#include <vector>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+
 #include "DirichletPoisson.h"
 #include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../parallel/ThreadPool.h"
 
-template <class T>
-int DirichletPoisson<T>::getPointOffset(int x, int y) const
+template <class T, class Solver>
+int DirichletPoisson<T, Solver>::getPointOffset(int x, int y) const
 {
   return (x - 1) + ((y - 1) * (numDivs - 1));
 }
 
-template <class T>
-template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
-void DirichletPoisson<T>::generate(IMathMatrix<T>& A, MathVector<T>& b) const
+template <class T, class Solver>
+template <class Low, class High, class Left, class Right>
+const typename DirichletPoisson<T, Solver>::BoundaryTables&
+DirichletPoisson<T, Solver>::boundaryTables(Identity source,
+    const Low& fnLow, const High& fnHigh, const Left& fnLeft,
+    const Right& fnRight) const
 {
-  int xdir, ydir;
+  BoundaryTables& tables = myTables;
+  if (tables.numDivs == numDivs && tables.source == source)
+  {
+    return tables;
+  }
+
   T h = length / numDivs;
-  for (int x = 1; x < numDivs; ++x)
+  int numPoints = numDivs - 1;
+  tables.xCoords.resize(numPoints);
+  tables.yCoords.resize(numPoints);
+  tables.low.resize(numPoints);
+  tables.high.resize(numPoints);
+  tables.left.resize(numPoints);
+  tables.right.resize(numPoints);
+  for (int i = 1; i < numDivs; ++i)
   {
-    for (int y = 1; y < numDivs; ++y)
-    {
-      int pointOffset = getPointOffset(x, y);
-      A(pointOffset, pointOffset) = 1;
+    tables.xCoords[i - 1] = xLow + i*h;
+    tables.yCoords[i - 1] = yLow + i*h;
+    tables.low[i - 1] = fnLow(xLow + i*h);
+    tables.high[i - 1] = fnHigh(xLow + i*h);
+    tables.left[i - 1] = fnLeft(yLow + i*h);
+    tables.right[i - 1] = fnRight(yLow + i*h);
+  }
+  tables.numDivs = numDivs;
+  tables.source = source;
 
-      // Check the left direction point
-      xdir = x - 1;
-      ydir = y;
-      if (xdir == 0)
-      {
-        // Update the b for the current point
-        b[pointOffset] += 0.25*(fnLeft(yLow + ydir*h));
-      }
-      else
-      {
-        // Update A at [currentpoint][directionPoint] = -1/4
-        A(pointOffset, getPointOffset(xdir, ydir)) = -0.25;
-      }
+  return tables;
+}
 
-      // Check the right direction point
-      xdir = x + 1;
-      if (xdir == numDivs)
-      {
-        // Update the b for the current point
-        b[pointOffset] += 0.25*(fnRight(yLow + ydir*h));
-      }
-      else
-      {
-        A(pointOffset, getPointOffset(xdir, ydir)) = -0.25;
-      }
-      
-      // Check the up direction point
-      xdir = x;
-      ydir = y + 1;
-      if (ydir == numDivs)
+template <class T, class Solver>
+template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T)>
+typename DirichletPoisson<T, Solver>::Identity
+DirichletPoisson<T, Solver>::functionsKey()
+{
+  static const Identity key = PoissonProblem<T>::nextIdentity();
+  return key;
+}
+
+template <class T, class Solver>
+template <class Matrix>
+void DirichletPoisson<T, Solver>::generateOperator(Matrix& A) const
+{
+  // Points of one grid row fill a contiguous range of rows of A, so whole
+  // grid rows can be assembled on different threads without any two of them
+  // writing to the same place
+  parallelFor(1, numDivs, ThreadPool::grainFor(8 * (numDivs - 1)),
+      [&](size_t firstRow, size_t lastRow)
       {
-        b[pointOffset] += 0.25*(fnHigh(xLow + xdir*h));
-      }
-      else
+        for (int y = firstRow; y < (int)lastRow; ++y)
+        {
+          for (int x = 1; x < numDivs; ++x)
+          {
+            int pointOffset = getPointOffset(x, y);
+            A(pointOffset, pointOffset) = 1;
+
+            // Neighbours inside the grid are unknowns, the ones on the
+            // boundary only contribute to b
+            if (x - 1 != 0)
+            {
+              A(pointOffset, getPointOffset(x - 1, y)) = -0.25;
+            }
+            if (x + 1 != numDivs)
+            {
+              A(pointOffset, getPointOffset(x + 1, y)) = -0.25;
+            }
+            if (y + 1 != numDivs)
+            {
+              A(pointOffset, getPointOffset(x, y + 1)) = -0.25;
+            }
+            if (y - 1 != 0)
+            {
+              A(pointOffset, getPointOffset(x, y - 1)) = -0.25;
+            }
+          }
+        }
+      });
+}
+
+template <class T, class Solver>
+SparseMathMatrix<T> DirichletPoisson<T, Solver>::getSparseOperator
+    (int numDivisions)
+{
+  numDivs = numDivisions;
+  size_t dimensions = (numDivs - 1)*(numDivs - 1);
+
+  std::vector<size_t> rowStarts(1, 0);
+  std::vector<size_t> columns;
+  columns.reserve(5 * dimensions);
+  rowStarts.reserve(dimensions + 1);
+
+  // Neighbours are pushed in increasing offset order, down, left, the point
+  // itself, right and up
+  for (int y = 1; y < numDivs; ++y)
+  {
+    for (int x = 1; x < numDivs; ++x)
+    {
+      if (y - 1 != 0) columns.push_back(getPointOffset(x, y - 1));
+      if (x - 1 != 0) columns.push_back(getPointOffset(x - 1, y));
+      columns.push_back(getPointOffset(x, y));
+      if (x + 1 != numDivs) columns.push_back(getPointOffset(x + 1, y));
+      if (y + 1 != numDivs) columns.push_back(getPointOffset(x, y + 1));
+      rowStarts.push_back(columns.size());
+    }
+  }
+
+  MathVector<T> values(columns.size());
+  for (size_t i = 0; i < dimensions; ++i)
+  {
+    for (size_t k = rowStarts[i]; k < rowStarts[i + 1]; ++k)
+    {
+      values[k] = (columns[k] == i) ? 1 : -0.25;
+    }
+  }
+  return SparseMathMatrix<T>(dimensions, dimensions, std::move(rowStarts),
+      std::move(columns), std::move(values));
+}
+
+template <class T, class Solver>
+template <class ForceRow>
+void DirichletPoisson<T, Solver>::assembleConstants(MathVector<T>& b,
+    const BoundaryTables& tables, const ForceRow& forceRow) const
+{
+  T h = length / numDivs;
+
+  // As in generateOperator each grid row writes its own range of b. Each
+  // point costs a handful of function evaluations
+  parallelFor(1, numDivs, ThreadPool::grainFor(32 * (numDivs - 1)),
+      [&](size_t firstRow, size_t lastRow)
       {
-        A(pointOffset, getPointOffset(xdir, ydir)) = -0.25;
-      }
+        MathVector<T> forces(numDivs - 1);
+
+        for (int y = firstRow; y < (int)lastRow; ++y)
+        {
+          forceRow(tables.yCoords[y - 1], tables.xCoords, forces);
+          for (int x = 1; x < numDivs; ++x)
+          {
+            int pointOffset = getPointOffset(x, y);
+
+            // Boundary neighbours in the order left, right, up, down
+            if (x - 1 == 0)
+            {
+              b[pointOffset] += 0.25*(tables.left[y - 1]);
+            }
+            if (x + 1 == numDivs)
+            {
+              b[pointOffset] += 0.25*(tables.right[y - 1]);
+            }
+            if (y + 1 == numDivs)
+            {
+              b[pointOffset] += 0.25*(tables.high[x - 1]);
+            }
+            if (y - 1 == 0)
+            {
+              b[pointOffset] += 0.25*(tables.low[x - 1]);
+            }
 
-      // Check the down direction point
-      ydir = y - 1;
-      if (ydir == 0)
+            // Subtract the forcing function from b
+            b[pointOffset] -= ((h*h)*(forces[x - 1]))/4.0;
+          }
+        }
+      });
+}
+
+template <class T, class Solver>
+template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
+void DirichletPoisson<T, Solver>::generateConstants(MathVector<T>& b) const
+{
+  Identity source = functionsKey<fnLow, fnHigh, fnLeft, fnRight>();
+  assembleConstants(b, boundaryTables(source, fnLow, fnHigh, fnLeft, fnRight),
+      [](T y, const MathVector<T>& x, MathVector<T>& values)
       {
-        b[pointOffset] += 0.25*(fnLow(xLow + xdir*h));
-      }
-      else
+        for (int i = 0, size = x.size(); i < size; ++i)
+        {
+          values[i] = fnForce(x[i], y);
+        }
+      });
+}
+
+template <class T, class Solver>
+void DirichletPoisson<T, Solver>::generateConstants(MathVector<T>& b,
+    const PoissonProblem<T>& problem) const
+{
+  assembleConstants(b, boundaryTables(problem.identity(), problem.low(),
+      problem.high(), problem.left(), problem.right()),
+      [&problem](T y, const MathVector<T>& x, MathVector<T>& values)
       {
-        A(pointOffset, getPointOffset(xdir, ydir)) = -0.25;
-      }
+        problem.evaluateForceRow(y, x, values);
+      });
+}
 
-      // Subtract the forcing function from b
-      b[pointOffset] -= ((h*h)*(fnForce(xLow + x*h, yLow + y*h)))/4.0;
-    }
-  }
+template <class T, class Solver>
+template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T),
+    class Matrix>
+void DirichletPoisson<T, Solver>::generate(Matrix& A, MathVector<T>& b) const
+{
+  generateOperator(A);
+  generateConstants<fnLow, fnHigh, fnLeft, fnRight, fnForce>(b);
 }
 
-template <class T>
+template <class T, class Solver>
+template <class Matrix>
+void DirichletPoisson<T, Solver>::generate(Matrix& A, MathVector<T>& b,
+    const PoissonProblem<T>& problem) const
+{
+  generateOperator(A);
+  generateConstants(b, problem);
+}
+
+template <class T, class Solver>
 template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
-MathVector<T> DirichletPoisson<T>::getSolution(int numDivisions)
+MathVector<T> DirichletPoisson<T, Solver>::getSolution(int numDivisions)
 {
   numDivs = numDivisions;
   int dimensions = (numDivs - 1)*(numDivs - 1);
@@ -93,13 +247,296 @@ MathVector<T> DirichletPoisson<T>::getSolution(int numDivisions)
 
   generate<fnLow, fnHigh, fnLeft, fnRight, fnForce>(A, b);
 
-  return mySolver(A, b);
+  return mySolver(std::move(A), std::move(b));
+}
+
+template <class T, class Solver>
+MathVector<T> DirichletPoisson<T, Solver>::getSolution(int numDivisions,
+    const PoissonProblem<T>& problem)
+{
+  numDivs = numDivisions;
+  int dimensions = (numDivs - 1)*(numDivs - 1);
+
+  MathMatrix<T> A(dimensions, dimensions);
+  MathVector<T> b(dimensions);
+
+  generate(A, b, problem);
+
+  return mySolver(std::move(A), std::move(b));
+}
+
+template <class T, class Solver>
+template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
+MathVector<T> DirichletPoisson<T, Solver>::getSolution(int numDivisions,
+    const MathVector<T>& initialGuess)
+{
+  numDivs = numDivisions;
+  int dimensions = (numDivs - 1)*(numDivs - 1);
+
+  MathMatrix<T> A(dimensions, dimensions);
+  MathVector<T> b(dimensions);
+
+  generate<fnLow, fnHigh, fnLeft, fnRight, fnForce>(A, b);
+
+  return mySolver.solveFrom(std::move(A), std::move(b), initialGuess);
+}
+
+template <class T, class Solver>
+MathVector<T> DirichletPoisson<T, Solver>::getSolution(int numDivisions,
+    const PoissonProblem<T>& problem, const MathVector<T>& initialGuess)
+{
+  numDivs = numDivisions;
+  int dimensions = (numDivs - 1)*(numDivs - 1);
+
+  MathMatrix<T> A(dimensions, dimensions);
+  MathVector<T> b(dimensions);
+
+  generate(A, b, problem);
+
+  return mySolver.solveFrom(std::move(A), std::move(b), initialGuess);
+}
+
+template <class T, class Solver>
+template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T),
+    class GridSolver>
+MathVector<T> DirichletPoisson<T, Solver>::getGridSolution(int numDivisions,
+    const GridSolver& solver)
+{
+  numDivs = numDivisions;
+  MathVector<T> b((numDivs - 1)*(numDivs - 1));
+  generateConstants<fnLow, fnHigh, fnLeft, fnRight, fnForce>(b);
+
+  return solver.solve(b, numDivs);
+}
+
+template <class T, class Solver>
+template <class GridSolver>
+MathVector<T> DirichletPoisson<T, Solver>::getGridSolution(int numDivisions,
+    const PoissonProblem<T>& problem, const GridSolver& solver)
+{
+  numDivs = numDivisions;
+  MathVector<T> b((numDivs - 1)*(numDivs - 1));
+  generateConstants(b, problem);
+
+  return solver.solve(b, numDivs);
+}
+
+template <class T, class Solver>
+template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T),
+    class SparseSolver>
+MathVector<T> DirichletPoisson<T, Solver>::getSparseSolution(int numDivisions,
+    const SparseSolver& solver)
+{
+  SparseMathMatrix<T> A = getSparseOperator(numDivisions);
+  MathVector<T> b(A.rows());
+  generateConstants<fnLow, fnHigh, fnLeft, fnRight, fnForce>(b);
+
+  return solver.solve(A, b);
+}
+
+template <class T, class Solver>
+template <class SparseSolver>
+MathVector<T> DirichletPoisson<T, Solver>::getSparseSolution(int numDivisions,
+    const PoissonProblem<T>& problem, const SparseSolver& solver)
+{
+  SparseMathMatrix<T> A = getSparseOperator(numDivisions);
+  MathVector<T> b(A.rows());
+  generateConstants(b, problem);
+
+  return solver.solve(A, b);
+}
+
+template <class T, class Solver>
+template <class Low, class High, class Left, class Right>
+MathVector<T> DirichletPoisson<T, Solver>::interpolate(
+    const MathVector<T>& coarse, int coarseDivs, const Low& fnLow,
+    const High& fnHigh, const Left& fnLeft, const Right& fnRight) const
+{
+  if (coarseDivs < 1 || (int)coarse.size() != (coarseDivs - 1)*(coarseDivs - 1))
+  {
+    throw std::domain_error("Cannot interpolate a solution of incorrect"
+        " dimensions!");
+  }
+
+  // Coarse grid values including the boundary, row y at y * (coarseDivs + 1)
+  T coarseH = length / coarseDivs;
+  int coarseWidth = coarseDivs + 1;
+  MathVector<T> nodes(coarseWidth * coarseWidth);
+  for (int i = 0; i <= coarseDivs; ++i)
+  {
+    nodes[i] = fnLow(xLow + i*coarseH);
+    nodes[coarseDivs*coarseWidth + i] = fnHigh(xLow + i*coarseH);
+  }
+  for (int y = 1; y < coarseDivs; ++y)
+  {
+    nodes[y*coarseWidth] = fnLeft(yLow + y*coarseH);
+    nodes[y*coarseWidth + coarseDivs] = fnRight(yLow + y*coarseH);
+    for (int x = 1; x < coarseDivs; ++x)
+    {
+      nodes[y*coarseWidth + x] = coarse[(x - 1) + (y - 1)*(coarseDivs - 1)];
+    }
+  }
+
+  MathVector<T> result((numDivs - 1)*(numDivs - 1));
+  T ratio = static_cast<T>(coarseDivs) / numDivs;
+  for (int y = 1; y < numDivs; ++y)
+  {
+    T coarseY = y*ratio;
+    int cellY = std::min<int>(coarseY, coarseDivs - 1);
+    T fracY = coarseY - cellY;
+    for (int x = 1; x < numDivs; ++x)
+    {
+      T coarseX = x*ratio;
+      int cellX = std::min<int>(coarseX, coarseDivs - 1);
+      T fracX = coarseX - cellX;
+
+      const T* below = &nodes[cellY*coarseWidth + cellX];
+      const T* above = below + coarseWidth;
+      result[getPointOffset(x, y)] =
+          (1 - fracY)*((1 - fracX)*below[0] + fracX*below[1]) +
+          fracY*((1 - fracX)*above[0] + fracX*above[1]);
+    }
+  }
+
+  return result;
+}
+
+template <class T, class Solver>
+template <class Low, class High, class Left, class Right>
+MathVector<T> DirichletPoisson<T, Solver>::nestedGuess(Identity source,
+    const Low& fnLow, const High& fnHigh, const Left& fnLeft,
+    const Right& fnRight) const
+{
+  if (myPrevious.source != source || myPrevious.numDivs == 0)
+  {
+    return MathVector<T>((numDivs - 1)*(numDivs - 1));
+  }
+  if (myPrevious.numDivs == numDivs)
+  {
+    return myPrevious.values;
+  }
+  return interpolate(myPrevious.values, myPrevious.numDivs, fnLow, fnHigh,
+      fnLeft, fnRight);
+}
+
+template <class T, class Solver>
+template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
+MathVector<T> DirichletPoisson<T, Solver>::getNestedSolution(int numDivisions)
+{
+  numDivs = numDivisions;
+  Identity source = functionsKey<fnLow, fnHigh, fnLeft, fnRight>();
+  MathVector<T> guess = nestedGuess(source, fnLow, fnHigh, fnLeft, fnRight);
+
+  MathVector<T> solution =
+      getSolution<fnLow, fnHigh, fnLeft, fnRight, fnForce>(numDivs, guess);
+
+  myPrevious.values = solution;
+  myPrevious.numDivs = numDivs;
+  myPrevious.source = source;
+  return solution;
+}
+
+template <class T, class Solver>
+MathVector<T> DirichletPoisson<T, Solver>::getNestedSolution(int numDivisions,
+    const PoissonProblem<T>& problem)
+{
+  numDivs = numDivisions;
+  MathVector<T> guess = nestedGuess(problem.identity(), problem.low(),
+      problem.high(), problem.left(), problem.right());
+
+  MathVector<T> solution = getSolution(numDivs, problem, guess);
+
+  myPrevious.values = solution;
+  myPrevious.numDivs = numDivs;
+  myPrevious.source = problem.identity();
+  return solution;
 }
 
-template <class T>
+template <class T, class Solver>
+template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T)>
+MathVector<T> DirichletPoisson<T, Solver>::interpolateSolution(
+    const MathVector<T>& coarse, int coarseDivs, int numDivisions)
+{
+  numDivs = numDivisions;
+  return interpolate(coarse, coarseDivs, fnLow, fnHigh, fnLeft, fnRight);
+}
+
+template <class T, class Solver>
+MathVector<T> DirichletPoisson<T, Solver>::interpolateSolution(
+    const MathVector<T>& coarse, int coarseDivs, int numDivisions,
+    const PoissonProblem<T>& problem)
+{
+  numDivs = numDivisions;
+  return interpolate(coarse, coarseDivs, problem.low(), problem.high(),
+      problem.left(), problem.right());
+}
+
+template <class T, class Solver>
+void DirichletPoisson<T, Solver>::clearNestedSolution()
+{
+  myPrevious = PreviousSolution();
+}
+
+template <class T, class Solver>
+const IMatrixFactorization<T>& DirichletPoisson<T, Solver>::factorization()
+{
+  std::unique_ptr<IMatrixFactorization<T> >& cached = myFactorizations[numDivs];
+  if (!cached)
+  {
+    int dimensions = (numDivs - 1)*(numDivs - 1);
+    MathMatrix<T> A(dimensions, dimensions);
+    generateOperator(A);
+    cached = mySolver.factor(std::move(A));
+  }
+  return *cached;
+}
+
+template <class T, class Solver>
+template <T fnLow(T), T fnHigh(T), T fnLeft(T), T fnRight(T), T fnForce(T, T)>
+MathVector<T> DirichletPoisson<T, Solver>::resolve(int numDivisions)
+{
+  numDivs = numDivisions;
+  const IMatrixFactorization<T>& factors = factorization();
+
+  MathVector<T> b((numDivs - 1)*(numDivs - 1));
+  generateConstants<fnLow, fnHigh, fnLeft, fnRight, fnForce>(b);
+  factors.solveInPlace(b);
+
+  return b;
+}
+
+template <class T, class Solver>
+MathVector<T> DirichletPoisson<T, Solver>::resolve(int numDivisions,
+    const PoissonProblem<T>& problem)
+{
+  numDivs = numDivisions;
+  const IMatrixFactorization<T>& factors = factorization();
+
+  MathVector<T> b((numDivs - 1)*(numDivs - 1));
+  generateConstants(b, problem);
+  factors.solveInPlace(b);
+
+  return b;
+}
+
+template <class T, class Solver>
+void DirichletPoisson<T, Solver>::clearOperatorCache()
+{
+  myFactorizations.clear();
+}
+
+template <class T, class Solver>
 template <T solution(T, T)>
-MathVector<T> DirichletPoisson<T>::getActualSolution(int numDivisions)
+MathVector<T> DirichletPoisson<T, Solver>::getActualSolution(int numDivisions)
 {
+  return getActualSolution(numDivisions, solution);
+}
+
+template <class T, class Solver>
+MathVector<T> DirichletPoisson<T, Solver>::getActualSolution(int numDivisions,
+    const std::function<T(T, T)>& solution)
+{
+  numDivs = numDivisions;
   MathVector<T> result((numDivisions - 1)*(numDivisions - 1));
   T h = length / numDivs;
   for (int x = 1; x < numDivisions; ++x)
@@ -91,14 +91,27 @@ std::istream& operator>>(std::istream& is, MathVector<T>& rhs);
 template <class T>
 class MathVector
 {
+  public:
+    // Vectors of up to inlineSize elements, such as points and stencil
+    // weights, are stored inside the MathVector and never allocate
+    static const std::size_t inlineSize = 4;
+
+    // Reductions sum blocks of this many elements serially and combine the
+    // block sums pairwise. The blocking never depends on the thread count,
+    // so results are bitwise reproducible, and vectors of up to one block
+    // are summed exactly as a serial loop would
+    static const std::size_t reductionBlockSize = 1024;
+
   private:
-    Array<T> myValues;
+    typedef Array<T, inlineSize> storage_type;
+
+    storage_type myValues;
 
   public:
-    typedef typename Array<T>::size_type size_type;
-    typedef typename Array<T>::value_type value_type;
-    typedef typename Array<T>::iterator iterator;
-    typedef typename Array<T>::const_iterator const_iterator;
+    typedef typename storage_type::size_type size_type;
+    typedef typename storage_type::value_type value_type;
+    typedef typename storage_type::iterator iterator;
+    typedef typename storage_type::const_iterator const_iterator;
 
     /*
     * brief   contrsuts a default vector object
@@ -169,7 +182,9 @@ class MathVector
     * brief   calculates the dotProduct between this an other
     * pre     other must have the same size as this else exception is thrown
     *         T::operator* and T::operator + must be defined 
-    * post    returns a copy of the result of the dotproduct
+    * post    returns a copy of the result of the dotproduct, computed in
+    *         parallel for long vectors with the same result for any
+    *         thread count
     */
     value_type dotProduct(const MathVector& other) const;
 
@@ -186,6 +201,21 @@ class MathVector
     */
     size_type size() const noexcept;
 
+    /*
+    * brief   returns the number of elements this vector can hold before
+    *         resize needs to allocate
+    * post    returns copy of the capacity of the underlying Array
+    */
+    size_type capacity() const noexcept;
+
+    /*
+    * brief   changes the length of this vector, only allocating when size is
+    *         larger than the current capacity
+    * post    this has size elements; existing values are kept and any new
+    *         elements are default constructed
+    */
+    void resize(size_type size);
+
     /*
     * brief   zeros out this vector
     * pre     T must be assignable to 0
@@ -11,6 +11,13 @@
 #include <cmath>
 
 #include "MathVector.h"
+#include "../parallel/ThreadPool.h"
+
+template <class T>
+const std::size_t MathVector<T>::inlineSize;
+
+template <class T>
+const std::size_t MathVector<T>::reductionBlockSize;
 
 template <class T>
 MathVector<T> operator+(MathVector<T> lhs, const MathVector<T>& rhs)
@@ -218,14 +225,22 @@ typename MathVector<T>::value_type MathVector<T>::dotProduct(const MathVector<T>
         "Both MathVectors must have the same size to compute dotProduct!");
   }
 
-  MathVector<T>::value_type result = 0;
-  for (auto thisIter = begin(), otherIter = other.begin(), endIter = end();
-      thisIter != endIter; ++thisIter, ++otherIter)
-  {
-    result += (*thisIter) * (*otherIter);
-  }
-
-  return result;
+  const_iterator lhs = begin();
+  const_iterator rhs = other.begin();
+  return parallelReduce(0, size(), reductionBlockSize, value_type(0),
+      [lhs, rhs](size_t first, size_t last)
+      {
+        value_type result = 0;
+        for (size_t i = first; i < last; ++i)
+        {
+          result += lhs[i] * rhs[i];
+        }
+        return result;
+      },
+      [](const value_type& left, const value_type& right)
+      {
+        return left + right;
+      });
 }
 
 template <class T>
@@ -240,6 +255,18 @@ typename MathVector<T>::size_type MathVector<T>::size() const noexcept
   return myValues.size();
 }
 
+template <class T>
+typename MathVector<T>::size_type MathVector<T>::capacity() const noexcept
+{
+  return myValues.capacity();
+}
+
+template <class T>
+void MathVector<T>::resize(MathVector<T>::size_type size)
+{
+  myValues.resize(size);
+}
+
 template <class T>
 void MathVector<T>::zero() noexcept
 {
@@ -3,6 +3,9 @@
  * PoissonFunctions.h : Set of functions for use with the Final Homework Problem
  */
 
+#ifndef POISSON_FUNCTIONS_H
+#define POISSON_FUNCTIONS_H
+
 double forcingFunction(double x, double y)
 {
   return -2*(x*x + y*y);
@@ -32,3 +35,5 @@ double Solution(double x, double y)
 {
   return (1-x*x)*(1+y*y);
 }
+
+#endif
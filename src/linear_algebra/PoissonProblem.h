@@ -0,0 +1,153 @@
+/*
+ * author Connor Walsh
+ * file   PoissonProblem.h
+ * brief  This class describes a Poisson problem by its boundary and forcing
+ *        functions so problems can be chosen at run time
+ */
+
+#ifndef POISSON_PROBLEM_H
+#define POISSON_PROBLEM_H
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+#include "MathVector.h"
+
+/*
+ * class  PoissonProblem
+ * brief  Holds the four boundary functions and the forcing function of a
+ *        Dirichlet Poisson problem as callable objects. forceRow may
+ *        optionally be set to evaluate the forcing function over a whole
+ *        grid row in one call, in which case it is used instead of force.
+ *        Every problem carries an identity that no other problem, copy or
+ *        set of template boundary functions shares, which DirichletPoisson
+ *        keys its caches on. The functions are only replaced through the
+ *        setters, which give the problem a new identity. DirichletPoisson
+ *        assembles grid rows in parallel, so force and forceRow are called
+ *        concurrently from several threads and must be safe to call that
+ *        way, e.g. any state they update must be atomic or locked
+ */
+template <class T>
+class PoissonProblem
+{
+  public:
+    typedef std::function<T(T)> Boundary;
+    typedef std::function<T(T, T)> Force;
+    typedef unsigned long long Identity;
+
+    /*
+     * brief  Fills values[i] with the forcing function at (x[i], y)
+     */
+    typedef std::function<void(T y, const MathVector<T>& x,
+        MathVector<T>& values)> ForceRow;
+
+    /*
+     * brief  Creates a problem from its boundary and forcing functions
+     * post   forceRow is empty so force is called one point at a time
+     */
+    PoissonProblem(Boundary fnLow, Boundary fnHigh, Boundary fnLeft,
+        Boundary fnRight, Force fnForce) : myLow(fnLow), myHigh(fnHigh),
+        myLeft(fnLeft), myRight(fnRight), myForce(fnForce),
+        myIdentity(nextIdentity()) {}
+
+    /*
+     * brief  Copies the functions of other
+     * post   The copy has an identity of its own
+     */
+    PoissonProblem(const PoissonProblem& other) : myLow(other.myLow),
+        myHigh(other.myHigh), myLeft(other.myLeft), myRight(other.myRight),
+        myForce(other.myForce), myForceRow(other.myForceRow),
+        myIdentity(nextIdentity()) {}
+    PoissonProblem& operator=(const PoissonProblem& other)
+    {
+      myLow = other.myLow;
+      myHigh = other.myHigh;
+      myLeft = other.myLeft;
+      myRight = other.myRight;
+      myForce = other.myForce;
+      myForceRow = other.myForceRow;
+      changed();
+      return *this;
+    }
+
+    /*
+     * brief  Functions for getting the boundary and forcing functions
+     */
+    const Boundary& low() const { return myLow; }
+    const Boundary& high() const { return myHigh; }
+    const Boundary& left() const { return myLeft; }
+    const Boundary& right() const { return myRight; }
+    const Force& force() const { return myForce; }
+    const ForceRow& forceRow() const { return myForceRow; }
+
+    /*
+     * brief  Functions for replacing the boundary and forcing functions
+     * post   The function is replaced and the problem has a new identity
+     */
+    void setLow(Boundary fnLow) { myLow = fnLow; changed(); }
+    void setHigh(Boundary fnHigh) { myHigh = fnHigh; changed(); }
+    void setLeft(Boundary fnLeft) { myLeft = fnLeft; changed(); }
+    void setRight(Boundary fnRight) { myRight = fnRight; changed(); }
+    void setForce(Force fnForce) { myForce = fnForce; changed(); }
+    void setForceRow(ForceRow fnForceRow)
+    {
+      myForceRow = fnForceRow;
+      changed();
+    }
+
+    /*
+     * brief  Returns the identity of the problem's current functions
+     */
+    Identity identity() const { return myIdentity; }
+
+    /*
+     * brief  Marks the functions as changed. The setters call this, callers
+     *        only need it when state the functions capture by reference
+     *        changes
+     * post   identity() returns a value never returned before, so cached
+     *        tables and solutions of the old functions are not used again
+     */
+    void changed() { myIdentity = nextIdentity(); }
+
+    /*
+     * brief  Returns a value never returned before, never zero
+     */
+    static Identity nextIdentity()
+    {
+      static std::atomic<Identity> next(1);
+      return next++;
+    }
+
+    /*
+     * brief  Evaluates the forcing function over one grid row
+     * pre    x and values must be the same size
+     * post   values[i] holds the forcing function at (x[i], y)
+     */
+    void evaluateForceRow(T y, const MathVector<T>& x,
+        MathVector<T>& values) const
+    {
+      if (myForceRow)
+      {
+        myForceRow(y, x, values);
+        return;
+      }
+
+      for (int i = 0, size = x.size(); i < size; ++i)
+      {
+        values[i] = myForce(x[i], y);
+      }
+    }
+
+  private:
+    Boundary myLow;
+    Boundary myHigh;
+    Boundary myLeft;
+    Boundary myRight;
+    Force myForce;
+    ForceRow myForceRow;
+    Identity myIdentity;
+};
+
+#endif
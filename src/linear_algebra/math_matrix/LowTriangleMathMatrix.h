@@ -32,7 +32,7 @@ class UpTriangleMathMatrix;
  *        transpose function
  */
 template <class T>
-class LowTriangleMathMatrix : public BaseMathMatrix<T, LowTriangleMathMatrix>
+class LowTriangleMathMatrix final : public BaseMathMatrix<T, LowTriangleMathMatrix>
 {
   public:
     /*
@@ -13,19 +13,26 @@
 #include <iostream>
 
 #include "../../containers/Array.h"
+#include "../../parallel/ThreadPool.h"
 #include "../MathVector.h"
 #include "BaseMathMatrix.h"
 #include "IMathMatrix.h"
 
+template <class T, bool Const = false>
+class MathMatrixView;
+template <class T>
+using ConstMathMatrixView = MathMatrixView<T, true>;
+
 /*
  * class  MathMatrix
  * brief  This class represents a matrix. This class implements the IMathMatrix
  *        interface and also includes operators for working with other
  *        matrices that derive from IMathMatrix. It also includes the
- *        transpose function
+ *        transpose function. The class is final so that calls made through
+ *        a MathMatrix reference can be resolved at compile time
  */
 template <class T>
-class MathMatrix : public BaseMathMatrix<T, MathMatrix>
+class MathMatrix final : public BaseMathMatrix<T, MathMatrix>
 {
   public:
     /*
@@ -186,6 +193,25 @@ class MathMatrix : public BaseMathMatrix<T, MathMatrix>
      */
     MathMatrix transpose() const;
 
+    /*
+     * brief  Functions for taking a non-owning view of part of this matrix
+     * pre    the described block must lie within this matrix else exception
+     *        is thrown. This matrix must outlive the returned view
+     * post   Returns a MathMatrixView of the requested rows/columns/block or
+     *        of the transpose, or a ConstMathMatrixView when this is const.
+     *        No element data is copied
+     */
+    MathMatrixView<T> block(size_t firstRow, size_t firstCol, size_t rows,
+        size_t cols);
+    ConstMathMatrixView<T> block(size_t firstRow, size_t firstCol,
+        size_t rows, size_t cols) const;
+    MathMatrixView<T> rowRange(size_t firstRow, size_t rows);
+    ConstMathMatrixView<T> rowRange(size_t firstRow, size_t rows) const;
+    MathMatrixView<T> colRange(size_t firstCol, size_t cols);
+    ConstMathMatrixView<T> colRange(size_t firstCol, size_t cols) const;
+    MathMatrixView<T> transposeView();
+    ConstMathMatrixView<T> transposeView() const;
+
     /*
      * brief  Function to swap two rows of this matrix
      * pre    row1 and row2 must specify valid rows of the matrix
@@ -193,6 +219,14 @@ class MathMatrix : public BaseMathMatrix<T, MathMatrix>
      */
     MathMatrix swapRows(size_t row1, size_t row2);
 
+    /*
+     * brief  Function to swap two rows of this matrix without copying
+     * pre    row1 and row2 must specify valid rows of the matrix else
+     *        exception is thrown
+     * post   this has row1 and row2 exchanged. Only the row pointers move
+     */
+    void swapRowsInPlace(size_t row1, size_t row2);
+
     /*
      * brief  Operators for returning an element in the matrix
      * pre    row and column must specify valid coordinates else exception
@@ -215,6 +249,16 @@ class MathMatrix : public BaseMathMatrix<T, MathMatrix>
      */
     void swap(MathMatrix& other);
 
+    /*
+     * brief  Function to change the dimensions of this matrix while reusing
+     *        the existing row storage. Rows only allocate when they need to
+     *        grow past their capacity and new rows are only allocated when
+     *        rows is larger than the current number of rows
+     * post   This is of size [rows, cols]; elements inside both the old and
+     *        new dimensions keep their values, new elements are zero
+     */
+    void resize(size_t rows, size_t cols);
+
     /*
      * brief  This function places a represntation of this matrix on the 
      *        given stream
@@ -247,5 +291,6 @@ MathMatrix<T> operator*(const T& scaler, MathMatrix<T> matrix)
 }
 
 #include "MathMatrix.hpp"
+#include "MathMatrixView.h"
 
 #endif
@@ -6,6 +6,7 @@
 
 #include <stdexcept>
 #include <sstream>
+#include <utility>
 
 #include "MathMatrix.h"
 
@@ -44,13 +45,9 @@ MathMatrix<T>::MathMatrix(const IMathMatrix<T>& other) : myColumns(other.cols())
 }
 
 template <class T>
-MathMatrix<T>::MathMatrix(MathMatrix<T>&& other) : myColumns(other.myColumns)
+MathMatrix<T>::MathMatrix(MathMatrix<T>&& other)
+  : myRows(std::move(other.myRows)), myColumns(other.myColumns)
 {
-  myRows = other.myRows;
-  for (auto& row : other.myRows)
-  {
-    row = nullptr;
-  }
   other.myColumns = 0;
 }
 
@@ -78,6 +75,30 @@ void MathMatrix<T>::swap(MathMatrix<T>& other)
   return;
 }
 
+template <class T>
+void MathMatrix<T>::resize(size_t rows, size_t cols)
+{
+  size_t oldRows = myRows.size();
+  for (size_t row = rows; row < oldRows; ++row)
+  {
+    delete(myRows[row]);
+  }
+
+  myRows.resize(rows);
+  for (size_t row = 0; row < rows; ++row)
+  {
+    if (row < oldRows)
+    {
+      myRows[row]->resize(cols);
+    }
+    else
+    {
+      myRows[row] = new MathVector<T>(cols);
+    }
+  }
+  myColumns = cols;
+}
+
 template <class T>
 bool MathMatrix<T>::opEquality(const IMathMatrix<T>& rhs) const
 {
@@ -120,13 +141,17 @@ MathMatrix<T>& MathMatrix<T>::opPlusEquals(const IMathMatrix<T>& rhs)
 {
   if (myRows.size() == rhs.rows() && myColumns == rhs.cols())
   {
-    for (int i = 0, numRows = getRows(); i < numRows; ++i)
-    {
-      for (int j = 0; j < (int)myColumns; ++j)
-      {
-        at(i, j) += rhs(i, j);
-      }
-    }
+    parallelFor(0, myRows.size(), ThreadPool::grainFor(myColumns),
+        [&](size_t firstRow, size_t lastRow)
+        {
+          for (size_t i = firstRow; i < lastRow; ++i)
+          {
+            for (size_t j = 0; j < myColumns; ++j)
+            {
+              at(i, j) += rhs(i, j);
+            }
+          }
+        });
     return *this;
   }
   else
@@ -140,13 +165,17 @@ MathMatrix<T>& MathMatrix<T>::opMinusEquals(const IMathMatrix<T>& rhs)
 {
   if (myRows.size() == rhs.rows() && myColumns == rhs.cols())
   {
-    for (int i = 0, numRows = getRows(); i < numRows; ++i)
-    {
-      for (int j = 0; j < (int)myColumns; ++j)
-      {
-        at(i, j) -= rhs(i, j);
-      }
-    }
+    parallelFor(0, myRows.size(), ThreadPool::grainFor(myColumns),
+        [&](size_t firstRow, size_t lastRow)
+        {
+          for (size_t i = firstRow; i < lastRow; ++i)
+          {
+            for (size_t j = 0; j < myColumns; ++j)
+            {
+              at(i, j) -= rhs(i, j);
+            }
+          }
+        });
     return *this;
   }
   else
@@ -166,10 +195,14 @@ MathMatrix<T>& MathMatrix<T>::opTimesEquals(const IMathMatrix<T>& rhs)
 template <class T>
 MathMatrix<T>& MathMatrix<T>::opTimesEquals(const T& scaler)
 {
-  for (auto& row : myRows)
-  {
-    (*row) *= scaler;
-  }
+  parallelFor(0, myRows.size(), ThreadPool::grainFor(myColumns),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        for (size_t i = firstRow; i < lastRow; ++i)
+        {
+          (*myRows[i]) *= scaler;
+        }
+      });
   return *this;
 }
 
@@ -182,13 +215,7 @@ MathMatrix<T> MathMatrix<T>::operator+(const IMathMatrix<T>& rhs) const
   }
 
   MathMatrix<T> result(*this);
-  for (int row = 0, numRows = myRows.size(); row < numRows; ++row)
-  {
-    for (int col = 0; col < (int)myColumns; ++col)
-    {
-      result.at(row, col) += rhs(row, col);
-    }
-  }
+  result.opPlusEquals(rhs);
 
   return result;
 }
@@ -202,13 +229,7 @@ MathMatrix<T> MathMatrix<T>::operator-(const IMathMatrix<T>& rhs) const
   }
 
   MathMatrix<T> result(*this);
-  for (int row = 0, numRows = myRows.size(); row < numRows; ++row)
-  {
-    for (int col = 0; col < (int)myColumns; ++col)
-    {
-      result.at(row, col) -= rhs(row, col);
-    }
-  }
+  result.opMinusEquals(rhs);
 
   return result;
 }
@@ -233,19 +254,23 @@ MathMatrix<T> MathMatrix<T>::operator*(const IMathMatrix<T>& rhs) const
   }
 
   MathMatrix<T> result(myRows.size(), rhs.cols());
-  T sum;
-  for (int lhsRow = 0, numRows = myRows.size(); lhsRow < numRows; ++lhsRow)
-  {
-    for (int rhsCol = 0, numCols = rhs.cols(); rhsCol < numCols; ++rhsCol)
-    {
-      sum = 0;
-      for (int element = 0; element < (int)myColumns; ++element)
+  size_t numCols = rhs.cols();
+  parallelFor(0, myRows.size(), ThreadPool::grainFor(numCols * myColumns),
+      [&](size_t firstRow, size_t lastRow)
       {
-        sum += at(lhsRow, element) * rhs(element, rhsCol);
-      }
-      result.at(lhsRow, rhsCol) = sum;
-    }
-  }
+        for (size_t lhsRow = firstRow; lhsRow < lastRow; ++lhsRow)
+        {
+          for (size_t rhsCol = 0; rhsCol < numCols; ++rhsCol)
+          {
+            T sum = 0;
+            for (size_t element = 0; element < myColumns; ++element)
+            {
+              sum += at(lhsRow, element) * rhs(element, rhsCol);
+            }
+            result.at(lhsRow, rhsCol) = sum;
+          }
+        }
+      });
   return result;
 }
 
@@ -264,18 +289,21 @@ MathVector<T> MathMatrix<T>::operator*(const MathVector<T>& rhs) const
     throw std::domain_error("Cannot multiply by MathVector of incorrect dimensions!");
   }
 
-  T sum;
   MathVector<T> result(myRows.size());
-  for (int i = 0, numRows = myRows.size(); i < numRows; ++i)
-  {
-    sum = 0;
-    for (int j = 0; j < (int)myColumns; ++j)
-    {
-      sum += at(i, j) * rhs[j];
-    }
-    result[i] = sum;
-  }
-  
+  parallelFor(0, myRows.size(), ThreadPool::grainFor(myColumns),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        for (size_t i = firstRow; i < lastRow; ++i)
+        {
+          T sum = 0;
+          for (size_t j = 0; j < myColumns; ++j)
+          {
+            sum += at(i, j) * rhs[j];
+          }
+          result[i] = sum;
+        }
+      });
+
   return result;
 }
 
@@ -315,6 +343,58 @@ MathMatrix<T> MathMatrix<T>::transpose() const
   return result;
 }
 
+template <class T>
+MathMatrixView<T> MathMatrix<T>::block(size_t firstRow, size_t firstCol,
+    size_t rows, size_t cols)
+{
+  return MathMatrixView<T>(*this, firstRow, firstCol, rows, cols);
+}
+
+template <class T>
+ConstMathMatrixView<T> MathMatrix<T>::block(size_t firstRow, size_t firstCol,
+    size_t rows, size_t cols) const
+{
+  return ConstMathMatrixView<T>(*this, firstRow, firstCol, rows, cols);
+}
+
+template <class T>
+MathMatrixView<T> MathMatrix<T>::rowRange(size_t firstRow, size_t rows)
+{
+  return block(firstRow, 0, rows, myColumns);
+}
+
+template <class T>
+ConstMathMatrixView<T> MathMatrix<T>::rowRange(size_t firstRow,
+    size_t rows) const
+{
+  return block(firstRow, 0, rows, myColumns);
+}
+
+template <class T>
+MathMatrixView<T> MathMatrix<T>::colRange(size_t firstCol, size_t cols)
+{
+  return block(0, firstCol, myRows.size(), cols);
+}
+
+template <class T>
+ConstMathMatrixView<T> MathMatrix<T>::colRange(size_t firstCol,
+    size_t cols) const
+{
+  return block(0, firstCol, myRows.size(), cols);
+}
+
+template <class T>
+MathMatrixView<T> MathMatrix<T>::transposeView()
+{
+  return MathMatrixView<T>(*this).transposed();
+}
+
+template <class T>
+ConstMathMatrixView<T> MathMatrix<T>::transposeView() const
+{
+  return ConstMathMatrixView<T>(*this).transposed();
+}
+
 template <class T>
 T& MathMatrix<T>::at(size_t row, size_t column)
 {
@@ -347,6 +427,12 @@ MathMatrix<T> MathMatrix<T>::swapRows(size_t row1, size_t row2)
   return result;
 }
 
+template <class T>
+void MathMatrix<T>::swapRowsInPlace(size_t row1, size_t row2)
+{
+  std::swap(myRows.at(row1), myRows.at(row2));
+}
+
 template <class T>
 void MathMatrix<T>::printToStream(std::ostream& os) const
 {
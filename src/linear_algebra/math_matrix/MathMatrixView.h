@@ -0,0 +1,221 @@
+/*
+ * author Connor Walsh
+ * file   MathMatrixView.h
+ * brief  Non-owning view onto a block of a MathMatrix implementing the
+ *        IMathMatrix interface, read-only when taken of a const MathMatrix
+ */
+
+#ifndef MATH_MATRIX_VIEW_H
+#define MATH_MATRIX_VIEW_H
+
+#pragma once
+
+#include <stddef.h>
+#include <iostream>
+#include <type_traits>
+
+#include "../MathVector.h"
+#include "BaseMathMatrix.h"
+#include "ReadOnlyMathMatrix.h"
+#include "IMathMatrix.h"
+#include "MathMatrix.h"
+
+/*
+ * brief  The writable view, named with a single parameter so it can be the
+ *        Derived of BaseMathMatrix
+ */
+template <class T>
+using WritableMathMatrixView = MathMatrixView<T, false>;
+
+/*
+ * brief  Selects the base of a view: the full IMathMatrix interface when it
+ *        may write its elements, only the reading half when it may not
+ */
+template <class T, bool Const>
+struct MathMatrixViewBase
+{
+  typedef BaseMathMatrix<T, WritableMathMatrixView> type;
+};
+
+template <class T>
+struct MathMatrixViewBase<T, true>
+{
+  typedef ReadOnlyMathMatrix<T, MathMatrixView<T, true> > type;
+};
+
+/*
+ * class  MathMatrixView
+ * brief  This class represents a rectangular, optionally strided and/or
+ *        transposed window onto the elements of a MathMatrix. It does not
+ *        own any storage, so taking a view never allocates and writes through
+ *        a view modify the viewed matrix. The viewed matrix must outlive
+ *        every view taken of it. Views of views refer directly to the
+ *        original matrix so blocked algorithms can recurse without cost.
+ *        A view with Const set, ConstMathMatrixView, is taken of a const
+ *        matrix and only reads it: its elements are const and the modifying
+ *        operations do not compile. A writable view converts to a read-only
+ *        view of the same elements, never the other way
+ */
+template <class T, bool Const>
+class MathMatrixView final : public MathMatrixViewBase<T, Const>::type
+{
+  public:
+    typedef typename std::conditional<Const, const MathMatrix<T>,
+            MathMatrix<T> >::type matrix_type;
+    typedef typename std::conditional<Const, const T, T>::type element_type;
+
+    /*
+     * brief  Creates a view covering all of matrix
+     * post   view(i, j) refers to matrix(i, j)
+     */
+    explicit MathMatrixView(matrix_type& matrix);
+
+    /*
+     * brief  Creates a view of a block of matrix
+     * pre    the block described must lie within matrix else exception
+     *        is thrown
+     * post   view(i, j) refers to matrix(firstRow + i * rowStride,
+     *        firstCol + j * colStride)
+     */
+    MathMatrixView(matrix_type& matrix, size_t firstRow, size_t firstCol,
+        size_t rows, size_t cols, size_t rowStride = 1, size_t colStride = 1);
+
+    /*
+     * brief  Copying a view creates another view of the same elements
+     * post   this refers to the same elements as other
+     */
+    MathMatrixView(const MathMatrixView& other) = default;
+
+    /*
+     * brief  Creates a read-only view of the elements a writable view
+     *        refers to
+     * post   this refers to the same elements as other
+     */
+    template <bool OtherConst, class = typename std::enable_if<
+      Const && !OtherConst>::type>
+    MathMatrixView(const MathMatrixView<T, OtherConst>& other);
+
+    /*
+     * brief  Views cannot be rebound, use assign() to copy values
+     */
+    MathMatrixView& operator=(const MathMatrixView& rhs) = delete;
+
+    ~MathMatrixView() {}
+
+    using IMathMatrix<T>::operator==;
+    using IMathMatrix<T>::operator!=;
+
+    /*
+     * brief  Implements the equality operator for the IMathMatrix interface
+     * pre    T must have the equality operation defined
+     * post   Returns true if this view has the same values as rhs otherwise
+     *        returns false
+     */
+    bool opEquality(const IMathMatrix<T>& rhs) const;
+
+    /*
+     * brief  Implementation methods for the +=, -= operators in IMathMatrix
+     * pre    rhs must be the same size as this or exception is thrown
+     * post   The viewed elements are equal to their previous values plus/minus
+     *        rhs values
+     */
+    MathMatrixView& opPlusEquals(const IMathMatrix<T>& rhs);
+    MathMatrixView& opMinusEquals(const IMathMatrix<T>& rhs);
+
+    /*
+     * brief  Implementation method for the *= operator in IMathMatrix
+     * pre    rhs must be square with dimension equal to cols() since a view
+     *        cannot change shape, else exception is thrown
+     * post   The viewed elements are equal to their previous values times rhs
+     */
+    MathMatrixView& opTimesEquals(const IMathMatrix<T>& rhs);
+
+    /*
+     * brief  Implementation method for the *= operator in IMathMatrix
+     * post   The viewed elements are scaled by scaler
+     */
+    MathMatrixView& opTimesEquals(const T& scaler);
+
+    /*
+     * brief  Copies the values of other into the viewed elements
+     * pre    other must be the same size as this else exception is thrown
+     * post   Every viewed element is equal to the matching element of other
+     */
+    MathMatrixView& assign(const IMathMatrix<T>& other);
+
+    /*
+     * brief  Operator for getting the product of this and a vector
+     * pre    rhs must have size equal to columns else exception is thrown
+     * post   Returns a new MathVector equal to this * rhs
+     */
+    MathVector<T> operator*(const MathVector<T>& rhs) const;
+
+    /*
+     * brief  Functions for taking a view of part of this view
+     * pre    the described block must lie within this view else exception
+     *        is thrown
+     * post   Returns a view of the requested rows/columns/block. No element
+     *        data is copied
+     */
+    MathMatrixView block(size_t firstRow, size_t firstCol, size_t rows,
+        size_t cols) const;
+    MathMatrixView rowRange(size_t firstRow, size_t rows) const;
+    MathMatrixView colRange(size_t firstCol, size_t cols) const;
+
+    /*
+     * brief  Takes every rowStep'th row and colStep'th column of this view
+     * pre    rowStep and colStep must be greater than zero
+     * post   Returns a view of the selected elements
+     */
+    MathMatrixView strided(size_t rowStep, size_t colStep) const;
+
+    /*
+     * brief  Function for getting the transpose of this view without copying
+     * post   Returns a view where element (i, j) refers to this' (j, i)
+     */
+    MathMatrixView transposed() const;
+
+    /*
+     * brief  Operators for returning an element in the view
+     * pre    row and column must specify valid coordinates else exception
+     *        is thrown
+     * post   returns a reference to the element specified
+     */
+    element_type& at(size_t row, size_t column);
+    const T& at(size_t row, size_t column) const;
+
+    /*
+     * brief  Method for getting the number of rows/cols in this view
+     * post   Returns a size_t holding the number of rows/cols in this view
+     */
+    size_t getRows() const;
+    size_t getCols() const;
+
+    /*
+     * brief  This function places a represntation of this view on the
+     *        given stream
+     * pre    T must have the << operator defined
+     * post   os contains a represntation of this view on it
+     */
+    void printToStream(std::ostream& os) const;
+
+    /*
+     * brief  Reads rows of values from the stream into the viewed elements
+     * post   The viewed elements hold the values read from is
+     */
+    void readFromStream(std::istream& is);
+
+  private:
+    template <class U, bool OtherConst>
+    friend class MathMatrixView;
+
+    matrix_type* myMatrix;
+    size_t myFirstRow, myFirstCol;
+    size_t myRows, myColumns;
+    size_t myRowStride, myColStride;
+    bool myTransposed;
+};
+
+#include "MathMatrixView.hpp"
+
+#endif
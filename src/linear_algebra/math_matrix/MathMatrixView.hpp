@@ -0,0 +1,344 @@
+/*
+ * author Connor Walsh
+ * file   MathMatrixView.hpp
+ * brief  Implementation file for MathMatrixView class
+ */
+
+#include <stdexcept>
+#include <sstream>
+
+#include "MathMatrix.h"
+#include "MathMatrixView.h"
+
+template <class T, bool Const>
+MathMatrixView<T, Const>::MathMatrixView(matrix_type& matrix)
+  : myMatrix(&matrix), myFirstRow(0), myFirstCol(0), myRows(matrix.getRows()),
+    myColumns(matrix.getCols()), myRowStride(1), myColStride(1),
+    myTransposed(false) {}
+
+template <class T, bool Const>
+MathMatrixView<T, Const>::MathMatrixView(matrix_type& matrix, size_t firstRow,
+    size_t firstCol, size_t rows, size_t cols, size_t rowStride,
+    size_t colStride)
+  : myMatrix(&matrix), myFirstRow(firstRow), myFirstCol(firstCol),
+    myRows(rows), myColumns(cols), myRowStride(rowStride),
+    myColStride(colStride), myTransposed(false)
+{
+  if (rowStride == 0 || colStride == 0)
+  {
+    throw std::domain_error("MathMatrixView strides must be positive!");
+  }
+
+  if ((rows != 0 && firstRow + (rows - 1) * rowStride >= matrix.getRows()) ||
+      (cols != 0 && firstCol + (cols - 1) * colStride >= matrix.getCols()))
+  {
+    throw std::out_of_range("MathMatrixView does not fit in the viewed matrix!");
+  }
+}
+
+template <class T, bool Const>
+template <bool OtherConst, class>
+MathMatrixView<T, Const>::MathMatrixView
+    (const MathMatrixView<T, OtherConst>& other)
+  : myMatrix(other.myMatrix), myFirstRow(other.myFirstRow),
+    myFirstCol(other.myFirstCol), myRows(other.myRows),
+    myColumns(other.myColumns), myRowStride(other.myRowStride),
+    myColStride(other.myColStride), myTransposed(other.myTransposed) {}
+
+template <class T, bool Const>
+bool MathMatrixView<T, Const>::opEquality(const IMathMatrix<T>& rhs) const
+{
+  if (myColumns != rhs.cols()) return false;
+  if (myRows != rhs.rows()) return false;
+
+  for (int i = 0, numRows = myRows; i < numRows; ++i)
+  {
+    for (int j = 0; j < (int)myColumns; ++j)
+    {
+      if (at(i, j) != rhs(i, j)) return false;
+    }
+  }
+  return true;
+}
+
+template <class T, bool Const>
+MathMatrixView<T, Const>& MathMatrixView<T, Const>::opPlusEquals
+    (const IMathMatrix<T>& rhs)
+{
+  static_assert(!Const, "A ConstMathMatrixView cannot be modified");
+  if (myRows != rhs.rows() || myColumns != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  for (int i = 0, numRows = myRows; i < numRows; ++i)
+  {
+    for (int j = 0; j < (int)myColumns; ++j)
+    {
+      at(i, j) += rhs(i, j);
+    }
+  }
+  return *this;
+}
+
+template <class T, bool Const>
+MathMatrixView<T, Const>& MathMatrixView<T, Const>::opMinusEquals
+    (const IMathMatrix<T>& rhs)
+{
+  static_assert(!Const, "A ConstMathMatrixView cannot be modified");
+  if (myRows != rhs.rows() || myColumns != rhs.cols())
+  {
+    throw std::domain_error("Cannot subtract two matrices of differing dimensions!");
+  }
+
+  for (int i = 0, numRows = myRows; i < numRows; ++i)
+  {
+    for (int j = 0; j < (int)myColumns; ++j)
+    {
+      at(i, j) -= rhs(i, j);
+    }
+  }
+  return *this;
+}
+
+template <class T, bool Const>
+MathMatrixView<T, Const>& MathMatrixView<T, Const>::opTimesEquals
+    (const IMathMatrix<T>& rhs)
+{
+  static_assert(!Const, "A ConstMathMatrixView cannot be modified");
+  if (myColumns != rhs.rows() || rhs.rows() != rhs.cols())
+  {
+    throw std::domain_error("Cannot multiply view by matrix of incorrect dimensions!");
+  }
+
+  // Each row of the result only depends on the same row of this
+  MathVector<T> rowResult(myColumns);
+  T sum;
+  for (int row = 0, numRows = myRows; row < numRows; ++row)
+  {
+    for (int col = 0; col < (int)myColumns; ++col)
+    {
+      sum = 0;
+      for (int element = 0; element < (int)myColumns; ++element)
+      {
+        sum += at(row, element) * rhs(element, col);
+      }
+      rowResult[col] = sum;
+    }
+    for (int col = 0; col < (int)myColumns; ++col)
+    {
+      at(row, col) = rowResult[col];
+    }
+  }
+  return *this;
+}
+
+template <class T, bool Const>
+MathMatrixView<T, Const>& MathMatrixView<T, Const>::opTimesEquals
+    (const T& scaler)
+{
+  static_assert(!Const, "A ConstMathMatrixView cannot be modified");
+  for (int i = 0, numRows = myRows; i < numRows; ++i)
+  {
+    for (int j = 0; j < (int)myColumns; ++j)
+    {
+      at(i, j) *= scaler;
+    }
+  }
+  return *this;
+}
+
+template <class T, bool Const>
+MathMatrixView<T, Const>& MathMatrixView<T, Const>::assign
+    (const IMathMatrix<T>& other)
+{
+  static_assert(!Const, "A ConstMathMatrixView cannot be modified");
+  if (myRows != other.rows() || myColumns != other.cols())
+  {
+    throw std::domain_error("Cannot assign matrix of differing dimensions to view!");
+  }
+
+  for (int i = 0, numRows = myRows; i < numRows; ++i)
+  {
+    for (int j = 0; j < (int)myColumns; ++j)
+    {
+      at(i, j) = other(i, j);
+    }
+  }
+  return *this;
+}
+
+template <class T, bool Const>
+MathVector<T> MathMatrixView<T, Const>::operator*
+    (const MathVector<T>& rhs) const
+{
+  if (myColumns != rhs.size()) {
+    throw std::domain_error("Cannot multiply by MathVector of incorrect dimensions!");
+  }
+
+  T sum;
+  MathVector<T> result(myRows);
+  for (int i = 0, numRows = myRows; i < numRows; ++i)
+  {
+    sum = 0;
+    for (int j = 0; j < (int)myColumns; ++j)
+    {
+      sum += at(i, j) * rhs[j];
+    }
+    result[i] = sum;
+  }
+
+  return result;
+}
+
+template <class T, bool Const>
+MathMatrixView<T, Const> MathMatrixView<T, Const>::block(size_t firstRow,
+    size_t firstCol, size_t rows, size_t cols) const
+{
+  if (firstRow + rows > myRows || firstCol + cols > myColumns)
+  {
+    throw std::out_of_range("Block does not fit in MathMatrixView!");
+  }
+
+  MathMatrixView<T, Const> result(*this);
+  result.myRows = rows;
+  result.myColumns = cols;
+  if (myTransposed)
+  {
+    result.myFirstRow += firstCol * myRowStride;
+    result.myFirstCol += firstRow * myColStride;
+  }
+  else
+  {
+    result.myFirstRow += firstRow * myRowStride;
+    result.myFirstCol += firstCol * myColStride;
+  }
+  return result;
+}
+
+template <class T, bool Const>
+MathMatrixView<T, Const> MathMatrixView<T, Const>::rowRange
+    (size_t firstRow, size_t rows) const
+{
+  return block(firstRow, 0, rows, myColumns);
+}
+
+template <class T, bool Const>
+MathMatrixView<T, Const> MathMatrixView<T, Const>::colRange
+    (size_t firstCol, size_t cols) const
+{
+  return block(0, firstCol, myRows, cols);
+}
+
+template <class T, bool Const>
+MathMatrixView<T, Const> MathMatrixView<T, Const>::strided
+    (size_t rowStep, size_t colStep) const
+{
+  if (rowStep == 0 || colStep == 0)
+  {
+    throw std::domain_error("MathMatrixView strides must be positive!");
+  }
+
+  MathMatrixView<T, Const> result(*this);
+  result.myRows = (myRows + rowStep - 1) / rowStep;
+  result.myColumns = (myColumns + colStep - 1) / colStep;
+  if (myTransposed)
+  {
+    result.myRowStride *= colStep;
+    result.myColStride *= rowStep;
+  }
+  else
+  {
+    result.myRowStride *= rowStep;
+    result.myColStride *= colStep;
+  }
+  return result;
+}
+
+template <class T, bool Const>
+MathMatrixView<T, Const> MathMatrixView<T, Const>::transposed() const
+{
+  MathMatrixView<T, Const> result(*this);
+  std::swap(result.myRows, result.myColumns);
+  result.myTransposed = !myTransposed;
+  return result;
+}
+
+template <class T, bool Const>
+typename MathMatrixView<T, Const>::element_type&
+    MathMatrixView<T, Const>::at(size_t row, size_t column)
+{
+  if (row >= myRows || column >= myColumns)
+  {
+    throw std::out_of_range("Invalid index to MathMatrixView::at()");
+  }
+
+  if (myTransposed) std::swap(row, column);
+  return myMatrix->at(myFirstRow + row * myRowStride,
+      myFirstCol + column * myColStride);
+}
+
+template <class T, bool Const>
+const T& MathMatrixView<T, Const>::at(size_t row, size_t column) const
+{
+  if (row >= myRows || column >= myColumns)
+  {
+    throw std::out_of_range("Invalid index to MathMatrixView::at()");
+  }
+
+  if (myTransposed) std::swap(row, column);
+  return myMatrix->at(myFirstRow + row * myRowStride,
+      myFirstCol + column * myColStride);
+}
+
+template <class T, bool Const>
+size_t MathMatrixView<T, Const>::getRows() const
+{
+  return myRows;
+}
+
+template <class T, bool Const>
+size_t MathMatrixView<T, Const>::getCols() const
+{
+  return myColumns;
+}
+
+template <class T, bool Const>
+void MathMatrixView<T, Const>::printToStream(std::ostream& os) const
+{
+  for (int i = 0, numRows = myRows; i < numRows; ++i)
+  {
+    for (int j = 0; j < (int)myColumns; ++j)
+    {
+      os << std::setw(10) << at(i, j) << " ";
+    }
+    os << "\n";
+  }
+}
+
+template <class T, bool Const>
+void MathMatrixView<T, Const>::readFromStream(std::istream& is)
+{
+  static_assert(!Const, "A ConstMathMatrixView cannot be modified");
+  std::string line;
+  for (int row = 0, numRows = myRows; row < numRows; ++row)
+  {
+    if (is.good())
+    {
+      getline(is, line);
+      std::istringstream lineStream(line);
+
+      for (int col = 0; col < (int)myColumns; ++col)
+      {
+        if (!(lineStream >> at(row, col)))
+        {
+          throw std::domain_error("Could not parse MathMatrixView from stream");
+        }
+      }
+    }
+    else
+    {
+      break;
+    }
+  }
+}
@@ -0,0 +1,93 @@
+/*
+ * author Connor Walsh
+ * file   ReadOnlyMathMatrix.h
+ * brief  This class forwards the reading half of the polymorphic interface
+ *        onto the Derived implementation functions and hides the writing half
+ */
+
+#ifndef READ_ONLY_MATH_MATRIX_H
+#define READ_ONLY_MATH_MATRIX_H
+
+#pragma once
+
+#include <stddef.h>
+#include <iostream>
+#include <stdexcept>
+
+#include "IMathMatrix.h"
+
+/*
+ * class  ReadOnlyMathMatrix
+ * brief  Base of matrices whose elements cannot be written, such as views of
+ *        a const MathMatrix. Such a matrix can still be read through a
+ *        const IMathMatrix reference. The modifying operations are private,
+ *        so calling them on the derived type does not compile; they are only
+ *        reachable by converting to a non-const IMathMatrix reference, and
+ *        then they throw an exception
+ */
+template <class T, class Derived>
+class ReadOnlyMathMatrix : public IMathMatrix<T> {
+  public:
+    virtual bool operator==(const IMathMatrix<T>& rhs) const
+    {
+      return static_cast<const Derived*>(this)->opEquality(rhs);
+    }
+
+    virtual bool operator!=(const IMathMatrix<T>& rhs) const
+    {
+      return !operator==(rhs);
+    }
+
+    virtual const T& operator()(size_t row, size_t column) const
+    {
+      return static_cast<const Derived*>(this)->at(row, column);
+    }
+
+    virtual size_t rows() const
+    {
+      return static_cast<const Derived*>(this)->getRows();
+    }
+
+    virtual size_t cols() const
+    {
+      return static_cast<const Derived*>(this)->getCols();
+    }
+
+    virtual void print(std::ostream& os) const
+    {
+      static_cast<const Derived*>(this)->printToStream(os);
+    }
+
+  private:
+    virtual IMathMatrix<T>& operator+=(const IMathMatrix<T>&)
+    {
+      throw std::domain_error("Cannot modify a read-only matrix!");
+    }
+
+    virtual IMathMatrix<T>& operator-=(const IMathMatrix<T>&)
+    {
+      throw std::domain_error("Cannot modify a read-only matrix!");
+    }
+
+    virtual IMathMatrix<T>& operator*=(const IMathMatrix<T>&)
+    {
+      throw std::domain_error("Cannot modify a read-only matrix!");
+    }
+
+    virtual IMathMatrix<T>& operator*=(const T&)
+    {
+      throw std::domain_error("Cannot modify a read-only matrix!");
+    }
+
+    virtual T& operator()(size_t, size_t)
+    {
+      throw std::domain_error("Cannot modify a read-only matrix!");
+    }
+
+    virtual void read(std::istream&)
+    {
+      throw std::domain_error("Cannot modify a read-only matrix!");
+    }
+};
+
+#endif
@@ -0,0 +1,185 @@
+/*
+ * author Connor Walsh
+ * file   SparseMathMatrix.h
+ * brief  Compressed sparse row matrix implementing the IMathMatrix interface
+ */
+
+#ifndef SPARSE_MATH_MATRIX_H
+#define SPARSE_MATH_MATRIX_H
+
+#pragma once
+
+#include <stddef.h>
+#include <iostream>
+#include <vector>
+
+#include "../MathVector.h"
+#include "../ordering/Permutation.h"
+#include "BaseMathMatrix.h"
+#include "IMathMatrix.h"
+#include "MathMatrix.h"
+
+/*
+ * class  SparseMathMatrix
+ * brief  This class stores only the entries of a matrix that are part of
+ *        its sparsity pattern, in compressed sparse row form. The entries of
+ *        row i are values()[k] for k in [rowStarts()[i], rowStarts()[i + 1]),
+ *        lying in columns columnIndices()[k] which increase along the row.
+ *        Entries outside the pattern are zero, read as zero and cannot be
+ *        assigned, so arithmetic that changes the pattern builds a new one
+ */
+template <class T>
+class SparseMathMatrix final : public BaseMathMatrix<T, SparseMathMatrix>
+{
+  public:
+    /*
+     * brief  Creates an empty matrix
+     */
+    SparseMathMatrix();
+
+    /*
+     * brief  Creates a zero matrix of size [rows, cols] with no entries
+     */
+    SparseMathMatrix(size_t rows, size_t cols);
+
+    /*
+     * brief  Creates a matrix from its compressed sparse row arrays
+     * pre    rowStarts must have rows + 1 nondecreasing offsets from zero to
+     *        columns.size(), values the same size as columns, and the
+     *        columns of each row must increase and be less than cols else
+     *        exception is thrown
+     */
+    SparseMathMatrix(size_t rows, size_t cols, std::vector<size_t> rowStarts,
+        std::vector<size_t> columns, MathVector<T> values);
+
+    /*
+     * brief  Creates a copy of other holding only its nonzero entries
+     */
+    SparseMathMatrix(const IMathMatrix<T>& other);
+    SparseMathMatrix(const SparseMathMatrix& other) = default;
+    SparseMathMatrix(SparseMathMatrix&& other);
+
+    SparseMathMatrix<T>& operator=(SparseMathMatrix rhs);
+
+    using IMathMatrix<T>::operator==;
+    using IMathMatrix<T>::operator!=;
+    bool opEquality(const IMathMatrix<T>& rhs) const;
+    bool operator==(const SparseMathMatrix& rhs) const;
+    bool operator!=(const SparseMathMatrix& rhs) const;
+
+    /*
+     * brief  Compound operators. The pattern of the result is the union of
+     *        the patterns involved. *= forms the product densely and keeps
+     *        its nonzero entries
+     */
+    SparseMathMatrix& opPlusEquals(const IMathMatrix<T>& rhs);
+    SparseMathMatrix& opMinusEquals(const IMathMatrix<T>& rhs);
+    SparseMathMatrix& opTimesEquals(const IMathMatrix<T>& rhs);
+    SparseMathMatrix& opTimesEquals(const T& scaler);
+
+    MathMatrix<T> operator+(const IMathMatrix<T>& rhs) const;
+    SparseMathMatrix operator+(const SparseMathMatrix& rhs) const;
+    MathMatrix<T> operator-(const IMathMatrix<T>& rhs) const;
+    SparseMathMatrix operator-(const SparseMathMatrix& rhs) const;
+    SparseMathMatrix operator-() const;
+    MathMatrix<T> operator*(const IMathMatrix<T>& rhs) const;
+    SparseMathMatrix operator*(const T& scaler) const;
+
+    /*
+     * brief  Multiplies this by rhs touching only the stored entries
+     * pre    rhs must have size cols() else exception is thrown
+     */
+    MathVector<T> operator*(const MathVector<T>& rhs) const;
+
+    /*
+     * brief  Computes y = Ax in the storage of y, in parallel over rows
+     * pre    x must have size cols() else exception is thrown
+     * post   y has size rows() and holds Ax
+     */
+    void multiply(const MathVector<T>& x, MathVector<T>& y) const;
+
+    SparseMathMatrix transpose() const;
+
+    /*
+     * brief  Returns the symmetrically reordered matrix, entry (k, l) of
+     *        which is entry (order(k), order(l)) of this
+     * pre    this must be square and of size permutation.size() else
+     *        exception is thrown
+     */
+    SparseMathMatrix permuted(const Permutation& permutation) const;
+
+    /*
+     * brief  Returns the largest |i - j| over the stored entries (i, j), so
+     *        a banded solver only has to touch that many diagonals on each
+     *        side of the main one
+     */
+    size_t bandwidth() const;
+
+    /*
+     * brief  Returns the sum over the rows i of i - j, j being the first
+     *        stored column of row i, or i if there is none below the
+     *        diagonal. This is the size of the lower envelope that a
+     *        profile (skyline) factorization fills
+     */
+    size_t profile() const;
+
+    /*
+     * brief  Returns the number of stored entries
+     */
+    size_t nonZeros() const { return myColumns.size(); }
+
+    /*
+     * brief  Accesses entry (row, column). Entries outside the pattern read
+     *        as zero but cannot be assigned
+     * pre    row must be less than rows() and column less than cols() else
+     *        exception is thrown, as is assigning outside the pattern
+     */
+    T& at(size_t row, size_t column);
+    const T& at(size_t row, size_t column) const;
+
+    /*
+     * brief  Direct access to the compressed sparse row arrays
+     */
+    const std::vector<size_t>& rowStarts() const { return myRowStarts; }
+    const std::vector<size_t>& columnIndices() const { return myColumns; }
+    MathVector<T>& values() { return myValues; }
+    const MathVector<T>& values() const { return myValues; }
+
+    size_t getRows() const;
+    size_t getCols() const;
+
+    void swap(SparseMathMatrix& other);
+    void printToStream(std::ostream& os) const;
+
+    /*
+     * brief  Reads rows() lines of cols() values each, as MathMatrix does,
+     *        keeping the nonzero values
+     */
+    void readFromStream(std::istream& is);
+
+  private:
+    /*
+     * brief  Returns the offset of entry (row, column) in values(), or
+     *        nonZeros() if it is outside the pattern
+     */
+    size_t find(size_t row, size_t column) const;
+
+    /*
+     * brief  Returns lhs + sign * rhs over the union of their patterns
+     * pre    lhs and rhs must have the same dimensions else exception is
+     *        thrown
+     */
+    static SparseMathMatrix combine(const SparseMathMatrix& lhs,
+        const SparseMathMatrix& rhs, T sign);
+
+    size_t myNumRows;
+    size_t myNumCols;
+    std::vector<size_t> myRowStarts;
+    std::vector<size_t> myColumns;
+    MathVector<T> myValues;
+    const T zero = 0;
+};
+
+#include "SparseMathMatrix.hpp"
+
+#endif
@@ -0,0 +1,529 @@
+/*
+ * author Connor Walsh
+ * file   SparseMathMatrix.hpp
+ * brief  Implementation file for the SparseMathMatrix class
+ */
+
+#include <stdexcept>
+#include <iomanip>
+#include <algorithm>
+#include <utility>
+
+#include "MathMatrix.h"
+#include "SparseMathMatrix.h"
+#include "../../parallel/ThreadPool.h"
+
+template <class T>
+SparseMathMatrix<T>::SparseMathMatrix()
+  : myNumRows(0), myNumCols(0), myRowStarts(1, 0) {}
+
+template <class T>
+SparseMathMatrix<T>::SparseMathMatrix(size_t rows, size_t cols)
+  : myNumRows(rows), myNumCols(cols), myRowStarts(rows + 1, 0) {}
+
+template <class T>
+SparseMathMatrix<T>::SparseMathMatrix(size_t rows, size_t cols,
+    std::vector<size_t> rowStarts, std::vector<size_t> columns,
+    MathVector<T> values) : myNumRows(rows), myNumCols(cols),
+    myRowStarts(std::move(rowStarts)), myColumns(std::move(columns)),
+    myValues(std::move(values))
+{
+  if (myRowStarts.size() != rows + 1 || myRowStarts[0] != 0 ||
+      myRowStarts[rows] != myColumns.size() ||
+      myValues.size() != myColumns.size())
+  {
+    throw std::domain_error("Cannot make a SparseMathMatrix from row starts"
+        " that do not match its entries!");
+  }
+
+  for (size_t i = 0; i < rows; ++i)
+  {
+    if (myRowStarts[i] > myRowStarts[i + 1])
+    {
+      throw std::domain_error("Cannot make a SparseMathMatrix from row starts"
+          " that decrease!");
+    }
+    for (size_t k = myRowStarts[i]; k < myRowStarts[i + 1]; ++k)
+    {
+      if (myColumns[k] >= cols ||
+          (k > myRowStarts[i] && myColumns[k] <= myColumns[k - 1]))
+      {
+        throw std::domain_error("Cannot make a SparseMathMatrix from columns"
+            " that are out of range or not increasing along a row!");
+      }
+    }
+  }
+}
+
+template <class T>
+SparseMathMatrix<T>::SparseMathMatrix(const IMathMatrix<T>& other)
+  : myNumRows(other.rows()), myNumCols(other.cols()),
+    myRowStarts(1, 0)
+{
+  const SparseMathMatrix<T>* sparse =
+    dynamic_cast<const SparseMathMatrix<T>*>(&other);
+  if (sparse != nullptr)
+  {
+    SparseMathMatrix<T> copy(*sparse);
+    swap(copy);
+    return;
+  }
+
+  std::vector<T> values;
+  for (size_t i = 0; i < myNumRows; ++i)
+  {
+    for (size_t j = 0; j < myNumCols; ++j)
+    {
+      if (other(i, j) != T(0))
+      {
+        myColumns.push_back(j);
+        values.push_back(other(i, j));
+      }
+    }
+    myRowStarts.push_back(myColumns.size());
+  }
+
+  myValues.resize(values.size());
+  std::copy(values.begin(), values.end(), myValues.begin());
+}
+
+template <class T>
+SparseMathMatrix<T>::SparseMathMatrix(SparseMathMatrix<T>&& other)
+  : SparseMathMatrix()
+{
+  swap(other);
+}
+
+template <class T>
+SparseMathMatrix<T>& SparseMathMatrix<T>::operator=(SparseMathMatrix<T> rhs)
+{
+  swap(rhs);
+  return *this;
+}
+
+template <class T>
+void SparseMathMatrix<T>::swap(SparseMathMatrix<T>& other)
+{
+  std::swap(myNumRows, other.myNumRows);
+  std::swap(myNumCols, other.myNumCols);
+  std::swap(myRowStarts, other.myRowStarts);
+  std::swap(myColumns, other.myColumns);
+  std::swap(myValues, other.myValues);
+}
+
+template <class T>
+size_t SparseMathMatrix<T>::find(size_t row, size_t column) const
+{
+  std::vector<size_t>::const_iterator first =
+    myColumns.begin() + myRowStarts[row];
+  std::vector<size_t>::const_iterator last =
+    myColumns.begin() + myRowStarts[row + 1];
+  std::vector<size_t>::const_iterator entry =
+    std::lower_bound(first, last, column);
+  if (entry == last || *entry != column) return nonZeros();
+  return entry - myColumns.begin();
+}
+
+template <class T>
+SparseMathMatrix<T> SparseMathMatrix<T>::combine
+    (const SparseMathMatrix<T>& lhs, const SparseMathMatrix<T>& rhs, T sign)
+{
+  if (lhs.myNumRows != rhs.myNumRows || lhs.myNumCols != rhs.myNumCols)
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  std::vector<size_t> rowStarts(1, 0);
+  std::vector<size_t> columns;
+  std::vector<T> values;
+  columns.reserve(std::max(lhs.nonZeros(), rhs.nonZeros()));
+  values.reserve(columns.capacity());
+
+  // Merge the two sorted rows
+  for (size_t i = 0; i < lhs.myNumRows; ++i)
+  {
+    size_t k = lhs.myRowStarts[i];
+    size_t l = rhs.myRowStarts[i];
+    size_t lhsEnd = lhs.myRowStarts[i + 1];
+    size_t rhsEnd = rhs.myRowStarts[i + 1];
+    while (k < lhsEnd || l < rhsEnd)
+    {
+      if (l == rhsEnd || (k < lhsEnd && lhs.myColumns[k] < rhs.myColumns[l]))
+      {
+        columns.push_back(lhs.myColumns[k]);
+        values.push_back(lhs.myValues[k++]);
+      }
+      else if (k == lhsEnd || rhs.myColumns[l] < lhs.myColumns[k])
+      {
+        columns.push_back(rhs.myColumns[l]);
+        values.push_back(sign * rhs.myValues[l++]);
+      }
+      else
+      {
+        columns.push_back(lhs.myColumns[k]);
+        values.push_back(lhs.myValues[k++] + sign * rhs.myValues[l++]);
+      }
+    }
+    rowStarts.push_back(columns.size());
+  }
+
+  MathVector<T> packed(values.size());
+  std::copy(values.begin(), values.end(), packed.begin());
+  return SparseMathMatrix<T>(lhs.myNumRows, lhs.myNumCols,
+      std::move(rowStarts), std::move(columns), std::move(packed));
+}
+
+template <class T>
+bool SparseMathMatrix<T>::opEquality(const IMathMatrix<T>& rhs) const
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols()) return false;
+
+  for (size_t i = 0; i < myNumRows; ++i)
+  {
+    for (size_t j = 0; j < myNumCols; ++j)
+    {
+      if (at(i, j) != rhs(i, j)) return false;
+    }
+  }
+  return true;
+}
+
+template <class T>
+bool SparseMathMatrix<T>::operator==(const SparseMathMatrix<T>& rhs) const
+{
+  if (myNumRows != rhs.myNumRows || myNumCols != rhs.myNumCols) return false;
+
+  // Patterns may differ by stored zeros, so compare the difference
+  SparseMathMatrix<T> difference = combine(*this, rhs, T(-1));
+  for (size_t k = 0; k < difference.nonZeros(); ++k)
+  {
+    if (difference.myValues[k] != T(0)) return false;
+  }
+  return true;
+}
+
+template <class T>
+bool SparseMathMatrix<T>::operator!=(const SparseMathMatrix<T>& rhs) const
+{
+  return !(*this == rhs);
+}
+
+template <class T>
+SparseMathMatrix<T>& SparseMathMatrix<T>::opPlusEquals
+    (const IMathMatrix<T>& rhs)
+{
+  SparseMathMatrix<T> result = combine(*this, SparseMathMatrix<T>(rhs), T(1));
+  swap(result);
+  return *this;
+}
+
+template <class T>
+SparseMathMatrix<T>& SparseMathMatrix<T>::opMinusEquals
+    (const IMathMatrix<T>& rhs)
+{
+  SparseMathMatrix<T> result = combine(*this, SparseMathMatrix<T>(rhs), T(-1));
+  swap(result);
+  return *this;
+}
+
+template <class T>
+SparseMathMatrix<T>& SparseMathMatrix<T>::opTimesEquals
+    (const IMathMatrix<T>& rhs)
+{
+  SparseMathMatrix<T> result((*this) * rhs);
+  swap(result);
+  return *this;
+}
+
+template <class T>
+SparseMathMatrix<T>& SparseMathMatrix<T>::opTimesEquals(const T& scaler)
+{
+  myValues *= scaler;
+  return *this;
+}
+
+template <class T>
+MathMatrix<T> SparseMathMatrix<T>::operator+(const IMathMatrix<T>& rhs) const
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  MathMatrix<T> result(rhs);
+  for (size_t i = 0; i < myNumRows; ++i)
+  {
+    for (size_t k = myRowStarts[i]; k < myRowStarts[i + 1]; ++k)
+    {
+      result(i, myColumns[k]) += myValues[k];
+    }
+  }
+  return result;
+}
+
+template <class T>
+SparseMathMatrix<T> SparseMathMatrix<T>::operator+
+    (const SparseMathMatrix<T>& rhs) const
+{
+  return combine(*this, rhs, T(1));
+}
+
+template <class T>
+MathMatrix<T> SparseMathMatrix<T>::operator-(const IMathMatrix<T>& rhs) const
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  MathMatrix<T> result(*this);
+  result -= rhs;
+  return result;
+}
+
+template <class T>
+SparseMathMatrix<T> SparseMathMatrix<T>::operator-
+    (const SparseMathMatrix<T>& rhs) const
+{
+  return combine(*this, rhs, T(-1));
+}
+
+template <class T>
+SparseMathMatrix<T> SparseMathMatrix<T>::operator-() const
+{
+  SparseMathMatrix<T> result(*this);
+  result *= T(-1);
+  return result;
+}
+
+template <class T>
+MathMatrix<T> SparseMathMatrix<T>::operator*(const IMathMatrix<T>& rhs) const
+{
+  if (myNumCols != rhs.rows())
+  {
+    throw std::domain_error("Cannot multiply matrices of incorrect dimensions!");
+  }
+
+  size_t numCols = rhs.cols();
+  MathMatrix<T> result(myNumRows, numCols);
+  for (size_t i = 0; i < myNumRows; ++i)
+  {
+    for (size_t k = myRowStarts[i]; k < myRowStarts[i + 1]; ++k)
+    {
+      for (size_t col = 0; col < numCols; ++col)
+      {
+        result(i, col) += myValues[k] * rhs(myColumns[k], col);
+      }
+    }
+  }
+  return result;
+}
+
+template <class T>
+SparseMathMatrix<T> SparseMathMatrix<T>::operator*(const T& scaler) const
+{
+  SparseMathMatrix<T> result(*this);
+  result *= scaler;
+  return result;
+}
+
+template <class T>
+MathVector<T> SparseMathMatrix<T>::operator*(const MathVector<T>& rhs) const
+{
+  MathVector<T> result;
+  multiply(rhs, result);
+  return result;
+}
+
+template <class T>
+void SparseMathMatrix<T>::multiply(const MathVector<T>& x,
+    MathVector<T>& y) const
+{
+  if (myNumCols != x.size())
+  {
+    throw std::domain_error("Cannot multiply by MathVector of incorrect dimensions!");
+  }
+
+  y.resize(myNumRows);
+  const T* source = x.begin();
+  const T* values = myValues.begin();
+  T* target = y.begin();
+  size_t perRow = (myNumRows == 0) ? 1 : nonZeros() / myNumRows + 1;
+  parallelFor(0, myNumRows, ThreadPool::grainFor(perRow),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        for (size_t i = firstRow; i < lastRow; ++i)
+        {
+          T sum = 0;
+          for (size_t k = myRowStarts[i]; k < myRowStarts[i + 1]; ++k)
+          {
+            sum += values[k] * source[myColumns[k]];
+          }
+          target[i] = sum;
+        }
+      });
+}
+
+template <class T>
+SparseMathMatrix<T> SparseMathMatrix<T>::transpose() const
+{
+  // Count the entries of every column, then place each entry at the next
+  // free slot of its column, which keeps the rows of the result sorted
+  std::vector<size_t> rowStarts(myNumCols + 1, 0);
+  for (size_t k = 0; k < nonZeros(); ++k)
+  {
+    ++rowStarts[myColumns[k] + 1];
+  }
+  for (size_t j = 0; j < myNumCols; ++j)
+  {
+    rowStarts[j + 1] += rowStarts[j];
+  }
+
+  std::vector<size_t> next(rowStarts.begin(), rowStarts.end() - 1);
+  std::vector<size_t> columns(nonZeros());
+  MathVector<T> values(nonZeros());
+  for (size_t i = 0; i < myNumRows; ++i)
+  {
+    for (size_t k = myRowStarts[i]; k < myRowStarts[i + 1]; ++k)
+    {
+      size_t slot = next[myColumns[k]]++;
+      columns[slot] = i;
+      values[slot] = myValues[k];
+    }
+  }
+  return SparseMathMatrix<T>(myNumCols, myNumRows, std::move(rowStarts),
+      std::move(columns), std::move(values));
+}
+
+template <class T>
+SparseMathMatrix<T> SparseMathMatrix<T>::permuted
+    (const Permutation& permutation) const
+{
+  if (myNumRows != myNumCols || permutation.size() != myNumRows)
+  {
+    throw std::domain_error("Cannot permute a matrix that is not square or"
+        " of the permutation's size!");
+  }
+
+  std::vector<size_t> rowStarts(1, 0);
+  std::vector<size_t> columns(nonZeros());
+  MathVector<T> values(nonZeros());
+  std::vector<std::pair<size_t, T> > row;
+  for (size_t k = 0; k < myNumRows; ++k)
+  {
+    size_t i = permutation.order(k);
+    row.clear();
+    for (size_t e = myRowStarts[i]; e < myRowStarts[i + 1]; ++e)
+    {
+      row.push_back(std::make_pair(permutation.position(myColumns[e]),
+            myValues[e]));
+    }
+    std::sort(row.begin(), row.end(),
+        [](const std::pair<size_t, T>& lhs, const std::pair<size_t, T>& rhs)
+        {
+          return lhs.first < rhs.first;
+        });
+
+    size_t start = rowStarts.back();
+    for (size_t e = 0; e < row.size(); ++e)
+    {
+      columns[start + e] = row[e].first;
+      values[start + e] = row[e].second;
+    }
+    rowStarts.push_back(start + row.size());
+  }
+  return SparseMathMatrix<T>(myNumRows, myNumCols, std::move(rowStarts),
+      std::move(columns), std::move(values));
+}
+
+template <class T>
+size_t SparseMathMatrix<T>::bandwidth() const
+{
+  size_t result = 0;
+  for (size_t i = 0; i < myNumRows; ++i)
+  {
+    for (size_t k = myRowStarts[i]; k < myRowStarts[i + 1]; ++k)
+    {
+      size_t j = myColumns[k];
+      result = std::max(result, (i > j) ? i - j : j - i);
+    }
+  }
+  return result;
+}
+
+template <class T>
+size_t SparseMathMatrix<T>::profile() const
+{
+  size_t result = 0;
+  for (size_t i = 0; i < myNumRows; ++i)
+  {
+    if (myRowStarts[i] < myRowStarts[i + 1] && myColumns[myRowStarts[i]] < i)
+    {
+      result += i - myColumns[myRowStarts[i]];
+    }
+  }
+  return result;
+}
+
+template <class T>
+T& SparseMathMatrix<T>::at(size_t row, size_t column)
+{
+  if (row >= myNumRows || column >= myNumCols)
+  {
+    throw std::out_of_range("Index out of range of SparseMathMatrix!");
+  }
+
+  size_t entry = find(row, column);
+  if (entry == nonZeros())
+  {
+    throw std::out_of_range("Cannot assign to values outside the pattern"
+        " of a SparseMathMatrix!");
+  }
+  return myValues[entry];
+}
+
+template <class T>
+const T& SparseMathMatrix<T>::at(size_t row, size_t column) const
+{
+  if (row >= myNumRows || column >= myNumCols)
+  {
+    throw std::out_of_range("Index out of range of SparseMathMatrix!");
+  }
+
+  size_t entry = find(row, column);
+  return (entry == nonZeros()) ? zero : myValues[entry];
+}
+
+template <class T>
+size_t SparseMathMatrix<T>::getRows() const
+{
+  return myNumRows;
+}
+
+template <class T>
+size_t SparseMathMatrix<T>::getCols() const
+{
+  return myNumCols;
+}
+
+template <class T>
+void SparseMathMatrix<T>::printToStream(std::ostream& os) const
+{
+  for (size_t i = 0; i < myNumRows; ++i)
+  {
+    for (size_t j = 0; j < myNumCols; ++j)
+    {
+      os << std::setw(10) << at(i, j) << " ";
+    }
+    os << "\n";
+  }
+}
+
+template <class T>
+void SparseMathMatrix<T>::readFromStream(std::istream& is)
+{
+  MathMatrix<T> dense(getRows(), getCols());
+  is >> dense;
+  SparseMathMatrix<T> result(dense);
+  swap(result);
+}
@@ -0,0 +1,160 @@
+/*
+ * author Connor Walsh
+ * file   SymmetricMathMatrix.h
+ * brief  Square symmetric matrix implementing the IMathMatrix interface
+ */
+
+#ifndef SYMMETRIC_MATH_MATRIX_H
+#define SYMMETRIC_MATH_MATRIX_H
+
+#pragma once
+
+#include <stddef.h>
+#include <iostream>
+
+#include "../MathVector.h"
+#include "BaseMathMatrix.h"
+#include "IMathMatrix.h"
+#include "MathMatrix.h"
+
+/*
+ * class  SymmetricMathMatrix
+ * brief  This class represents a square matrix equal to its transpose. Only
+ *        the lower triangle is stored, packed row after row as in
+ *        LowTriangleMathMatrix but in one contiguous vector, so row i starts
+ *        at offset i(i + 1) / 2. A(i, j) and A(j, i) refer to the same
+ *        stored value, so the matrix needs about half the memory of a
+ *        MathMatrix and its kernels read each stored value once
+ */
+template <class T>
+class SymmetricMathMatrix final
+  : public BaseMathMatrix<T, SymmetricMathMatrix>
+{
+  public:
+    /*
+     * brief  Creates an empty matrix
+     */
+    SymmetricMathMatrix() : mySize(0) {}
+
+    /*
+     * brief  Creates a zero matrix of size [size, size]
+     */
+    explicit SymmetricMathMatrix(size_t size);
+
+    /*
+     * brief  Creates a copy of other
+     * pre    other must be square and equal to its transpose else exception
+     *        is thrown
+     */
+    SymmetricMathMatrix(const IMathMatrix<T>& other);
+    SymmetricMathMatrix(const SymmetricMathMatrix& other) = default;
+    SymmetricMathMatrix(SymmetricMathMatrix&& other);
+
+    SymmetricMathMatrix<T>& operator=(SymmetricMathMatrix rhs);
+
+    using IMathMatrix<T>::operator==;
+    using IMathMatrix<T>::operator!=;
+    bool opEquality(const IMathMatrix<T>& rhs) const;
+    bool operator==(const SymmetricMathMatrix& rhs) const;
+    bool operator!=(const SymmetricMathMatrix& rhs) const;
+
+    /*
+     * brief  Compound operators. The result must be symmetric, so rhs of
+     *        += and -= and the product of *= must equal their transpose else
+     *        exception is thrown
+     */
+    SymmetricMathMatrix& opPlusEquals(const IMathMatrix<T>& rhs);
+    SymmetricMathMatrix& opMinusEquals(const IMathMatrix<T>& rhs);
+    SymmetricMathMatrix& opTimesEquals(const IMathMatrix<T>& rhs);
+    SymmetricMathMatrix& opTimesEquals(const T& scaler);
+
+    MathMatrix<T> operator+(const IMathMatrix<T>& rhs) const;
+    SymmetricMathMatrix operator+(const SymmetricMathMatrix& rhs) const;
+    MathMatrix<T> operator-(const IMathMatrix<T>& rhs) const;
+    SymmetricMathMatrix operator-(const SymmetricMathMatrix& rhs) const;
+    SymmetricMathMatrix operator-() const;
+    MathMatrix<T> operator*(const IMathMatrix<T>& rhs) const;
+    SymmetricMathMatrix operator*(const T& scaler) const;
+
+    /*
+     * brief  Multiplies this by rhs. Each stored A(i, j) below the diagonal
+     *        adds to both y[i] and y[j]
+     * pre    rhs must have size rows() else exception is thrown
+     */
+    MathVector<T> operator*(const MathVector<T>& rhs) const;
+
+    /*
+     * brief  Computes y = Ax in the storage of y, in parallel over blocks
+     *        of rows. Each block writes only its own entries of y, reading
+     *        its rows of the packed triangle and then the segments of the
+     *        later rows below them, so no thread needs a copy of y. Every
+     *        entry is summed in the same order for any number of threads
+     * pre    x must have size rows() else exception is thrown, and x and y
+     *        must be different vectors
+     * post   y has size rows() and holds Ax
+     */
+    void multiply(const MathVector<T>& x, MathVector<T>& y) const;
+
+    /*
+     * brief  Symmetric rank-k update, sets this to beta * this +
+     *        alpha * V * V^T computing only the stored lower triangle. With
+     *        beta of zero on a zero matrix and V = A^T this forms the
+     *        normal equation matrix A^T * A
+     * pre    V must have rows() rows else exception is thrown
+     * post   returns a reference to this
+     */
+    SymmetricMathMatrix& rankUpdate(const MathMatrix<T>& V, T alpha = 1,
+        T beta = 1);
+
+    SymmetricMathMatrix transpose() const;
+
+    /*
+     * brief  Accesses entry (row, column). Assigning to A(i, j) also
+     *        changes A(j, i) as both are the same stored value
+     * pre    row and column must be less than rows() else exception is
+     *        thrown
+     */
+    T& at(size_t row, size_t column);
+    const T& at(size_t row, size_t column) const;
+
+    /*
+     * brief  Direct access to the packed lower triangle, row i starting at
+     *        offset i(i + 1) / 2
+     * post   returns a vector of rows()(rows() + 1) / 2 values
+     */
+    MathVector<T>& packed() { return myValues; }
+    const MathVector<T>& packed() const { return myValues; }
+
+    size_t getRows() const;
+    size_t getCols() const;
+
+    void swap(SymmetricMathMatrix& other);
+    void printToStream(std::ostream& os) const;
+
+    /*
+     * brief  Reads rows() lines of rows() values each, as MathMatrix does
+     * pre    The values read must form a symmetric matrix else exception is
+     *        thrown
+     */
+    void readFromStream(std::istream& is);
+
+  private:
+    /*
+     * brief  Sets this to other
+     * pre    other must be square and equal to its transpose else exception
+     *        is thrown and this is unchanged
+     */
+    void assign(const IMathMatrix<T>& other);
+
+    /*
+     * brief  Returns the offset of the first stored value of row
+     */
+    static size_t rowOffset(size_t row) { return row * (row + 1) / 2; }
+
+    size_t mySize;
+    MathVector<T> myValues;
+};
+
+#include "SymmetricMathMatrix.hpp"
+
+#endif
@@ -0,0 +1,384 @@
+/*
+ * author Connor Walsh
+ * file   SymmetricMathMatrix.hpp
+ * brief  Implementation file for the SymmetricMathMatrix class
+ */
+
+#include <stdexcept>
+#include <iomanip>
+#include <algorithm>
+#include <utility>
+
+#include "MathMatrix.h"
+#include "SymmetricMathMatrix.h"
+#include "../../parallel/ThreadPool.h"
+
+template <class T>
+SymmetricMathMatrix<T>::SymmetricMathMatrix(size_t size)
+  : mySize(size), myValues(rowOffset(size)) {}
+
+template <class T>
+SymmetricMathMatrix<T>::SymmetricMathMatrix(const IMathMatrix<T>& other)
+  : mySize(0)
+{
+  assign(other);
+}
+
+template <class T>
+SymmetricMathMatrix<T>::SymmetricMathMatrix(SymmetricMathMatrix<T>&& other)
+  : mySize(other.mySize), myValues(std::move(other.myValues))
+{
+  other.mySize = 0;
+  other.myValues.resize(0);
+}
+
+template <class T>
+SymmetricMathMatrix<T>& SymmetricMathMatrix<T>::operator=
+    (SymmetricMathMatrix<T> rhs)
+{
+  swap(rhs);
+  return *this;
+}
+
+template <class T>
+void SymmetricMathMatrix<T>::swap(SymmetricMathMatrix<T>& other)
+{
+  std::swap(mySize, other.mySize);
+  std::swap(myValues, other.myValues);
+}
+
+template <class T>
+void SymmetricMathMatrix<T>::assign(const IMathMatrix<T>& other)
+{
+  size_t size = other.rows();
+  if (other.cols() != size)
+  {
+    throw std::domain_error("Cannot make a SymmetricMathMatrix from a"
+        " matrix that is not square!");
+  }
+
+  SymmetricMathMatrix<T> result(size);
+  T* values = result.myValues.begin();
+  for (size_t i = 0; i < size; ++i)
+  {
+    for (size_t j = 0; j < i; ++j)
+    {
+      if (other(i, j) != other(j, i))
+      {
+        throw std::domain_error("Cannot make a SymmetricMathMatrix from a"
+            " matrix that is not symmetric!");
+      }
+    }
+    for (size_t j = 0; j <= i; ++j)
+    {
+      *values++ = other(i, j);
+    }
+  }
+  swap(result);
+}
+
+template <class T>
+bool SymmetricMathMatrix<T>::opEquality(const IMathMatrix<T>& rhs) const
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols()) return false;
+
+  for (size_t i = 0; i < mySize; ++i)
+  {
+    for (size_t j = 0; j < mySize; ++j)
+    {
+      if (at(i, j) != rhs(i, j)) return false;
+    }
+  }
+  return true;
+}
+
+template <class T>
+bool SymmetricMathMatrix<T>::operator==
+    (const SymmetricMathMatrix<T>& rhs) const
+{
+  return mySize == rhs.mySize && myValues == rhs.myValues;
+}
+
+template <class T>
+bool SymmetricMathMatrix<T>::operator!=
+    (const SymmetricMathMatrix<T>& rhs) const
+{
+  return !(*this == rhs);
+}
+
+template <class T>
+SymmetricMathMatrix<T>& SymmetricMathMatrix<T>::opPlusEquals
+    (const IMathMatrix<T>& rhs)
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  SymmetricMathMatrix<T> other(rhs);
+  myValues += other.myValues;
+  return *this;
+}
+
+template <class T>
+SymmetricMathMatrix<T>& SymmetricMathMatrix<T>::opMinusEquals
+    (const IMathMatrix<T>& rhs)
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  SymmetricMathMatrix<T> other(rhs);
+  myValues -= other.myValues;
+  return *this;
+}
+
+template <class T>
+SymmetricMathMatrix<T>& SymmetricMathMatrix<T>::opTimesEquals
+    (const IMathMatrix<T>& rhs)
+{
+  assign((*this) * rhs);
+  return *this;
+}
+
+template <class T>
+SymmetricMathMatrix<T>& SymmetricMathMatrix<T>::opTimesEquals
+    (const T& scaler)
+{
+  myValues *= scaler;
+  return *this;
+}
+
+template <class T>
+MathMatrix<T> SymmetricMathMatrix<T>::operator+
+    (const IMathMatrix<T>& rhs) const
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  MathMatrix<T> result(rhs);
+  result += *this;
+  return result;
+}
+
+template <class T>
+SymmetricMathMatrix<T> SymmetricMathMatrix<T>::operator+
+    (const SymmetricMathMatrix<T>& rhs) const
+{
+  if (mySize != rhs.mySize)
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  SymmetricMathMatrix<T> result(*this);
+  result.myValues += rhs.myValues;
+  return result;
+}
+
+template <class T>
+MathMatrix<T> SymmetricMathMatrix<T>::operator-
+    (const IMathMatrix<T>& rhs) const
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  MathMatrix<T> result(*this);
+  result -= rhs;
+  return result;
+}
+
+template <class T>
+SymmetricMathMatrix<T> SymmetricMathMatrix<T>::operator-
+    (const SymmetricMathMatrix<T>& rhs) const
+{
+  if (mySize != rhs.mySize)
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  SymmetricMathMatrix<T> result(*this);
+  result.myValues -= rhs.myValues;
+  return result;
+}
+
+template <class T>
+SymmetricMathMatrix<T> SymmetricMathMatrix<T>::operator-() const
+{
+  SymmetricMathMatrix<T> result(*this);
+  result *= T(-1);
+  return result;
+}
+
+template <class T>
+MathMatrix<T> SymmetricMathMatrix<T>::operator*
+    (const IMathMatrix<T>& rhs) const
+{
+  if (mySize != rhs.rows())
+  {
+    throw std::domain_error("Cannot multiply matrices of incorrect dimensions!");
+  }
+
+  return MathMatrix<T>(*this) * rhs;
+}
+
+template <class T>
+SymmetricMathMatrix<T> SymmetricMathMatrix<T>::operator*
+    (const T& scaler) const
+{
+  SymmetricMathMatrix<T> result(*this);
+  result *= scaler;
+  return result;
+}
+
+template <class T>
+MathVector<T> SymmetricMathMatrix<T>::operator*
+    (const MathVector<T>& rhs) const
+{
+  MathVector<T> result;
+  multiply(rhs, result);
+  return result;
+}
+
+template <class T>
+void SymmetricMathMatrix<T>::multiply(const MathVector<T>& x,
+    MathVector<T>& y) const
+{
+  if (mySize != x.size())
+  {
+    throw std::domain_error("Cannot multiply by MathVector of incorrect dimensions!");
+  }
+
+  // Each block owns its entries of y. Row i of the triangle gives the part
+  // of y[i] left of the diagonal, and the part right of it is column i below
+  // the diagonal, which for a block of entries is a consecutive segment of
+  // every later row
+  const T* values = myValues.begin();
+  const T* source = x.begin();
+  y.resize(mySize);
+  T* target = y.begin();
+  parallelFor(0, mySize, ThreadPool::grainFor(mySize),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        for (size_t i = firstRow; i < lastRow; ++i)
+        {
+          const T* row = values + rowOffset(i);
+          T sum = 0;
+          for (size_t j = 0; j <= i; ++j)
+          {
+            sum += row[j] * source[j];
+          }
+          target[i] = sum;
+        }
+
+        for (size_t k = firstRow + 1; k < mySize; ++k)
+        {
+          const T* row = values + rowOffset(k);
+          T xk = source[k];
+          for (size_t i = firstRow, end = std::min(lastRow, k); i < end; ++i)
+          {
+            target[i] += row[i] * xk;
+          }
+        }
+      });
+}
+
+template <class T>
+SymmetricMathMatrix<T>& SymmetricMathMatrix<T>::rankUpdate
+    (const MathMatrix<T>& V, T alpha, T beta)
+{
+  if (V.rows() != mySize)
+  {
+    throw std::domain_error("Cannot update a SymmetricMathMatrix with a"
+        " matrix of incorrect dimensions!");
+  }
+
+  // Each row i of the triangle only touches its own i + 1 stored values
+  size_t rank = V.cols();
+  T* values = myValues.begin();
+  parallelFor(0, mySize, ThreadPool::grainFor(mySize * rank / 2 + 1),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        for (size_t i = firstRow; i < lastRow; ++i)
+        {
+          T* row = values + rowOffset(i);
+          const T* left = V[i].begin();
+          for (size_t j = 0; j <= i; ++j)
+          {
+            const T* right = V[j].begin();
+            T sum = 0;
+            for (size_t k = 0; k < rank; ++k)
+            {
+              sum += left[k] * right[k];
+            }
+            row[j] = (beta == T(0)) ? alpha * sum : beta * row[j] + alpha * sum;
+          }
+        }
+      });
+  return *this;
+}
+
+template <class T>
+SymmetricMathMatrix<T> SymmetricMathMatrix<T>::transpose() const
+{
+  return *this;
+}
+
+template <class T>
+T& SymmetricMathMatrix<T>::at(size_t row, size_t column)
+{
+  if (row >= mySize || column >= mySize)
+  {
+    throw std::out_of_range("Index out of range of SymmetricMathMatrix!");
+  }
+  if (row < column) std::swap(row, column);
+  return myValues[rowOffset(row) + column];
+}
+
+template <class T>
+const T& SymmetricMathMatrix<T>::at(size_t row, size_t column) const
+{
+  if (row >= mySize || column >= mySize)
+  {
+    throw std::out_of_range("Index out of range of SymmetricMathMatrix!");
+  }
+  if (row < column) std::swap(row, column);
+  return myValues[rowOffset(row) + column];
+}
+
+template <class T>
+size_t SymmetricMathMatrix<T>::getRows() const
+{
+  return mySize;
+}
+
+template <class T>
+size_t SymmetricMathMatrix<T>::getCols() const
+{
+  return mySize;
+}
+
+template <class T>
+void SymmetricMathMatrix<T>::printToStream(std::ostream& os) const
+{
+  for (size_t i = 0; i < mySize; ++i)
+  {
+    for (size_t j = 0; j < mySize; ++j)
+    {
+      os << std::setw(10) << at(i, j) << " ";
+    }
+    os << "\n";
+  }
+}
+
+template <class T>
+void SymmetricMathMatrix<T>::readFromStream(std::istream& is)
+{
+  MathMatrix<T> dense(getRows(), getCols());
+  is >> dense;
+  assign(dense);
+}
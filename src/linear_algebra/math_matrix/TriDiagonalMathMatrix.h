@@ -0,0 +1,143 @@
+/*
+ * author Connor Walsh
+ * file   TriDiagonalMathMatrix.h
+ * brief  Square tridiagonal matrix implementing the IMathMatrix interface
+ */
+
+#ifndef TRI_DIAGONAL_MATH_MATRIX_H
+#define TRI_DIAGONAL_MATH_MATRIX_H
+
+#pragma once
+
+#include <stddef.h>
+#include <iostream>
+
+#include "../MathVector.h"
+#include "BaseMathMatrix.h"
+#include "IMathMatrix.h"
+#include "MathMatrix.h"
+
+/*
+ * class  TriDiagonalMathMatrix
+ * brief  This class represents a square matrix whose only nonzero entries
+ *        are on the diagonal and the two diagonals beside it. The three
+ *        diagonals are stored as vectors of rows() entries each, so storage
+ *        and the matrix vector product are O(n). Entry i of lower() is
+ *        A(i, i - 1) and entry i of upper() is A(i, i + 1); lower()[0] and
+ *        upper()[n - 1] lie outside the matrix and are always zero
+ */
+template <class T>
+class TriDiagonalMathMatrix final
+  : public BaseMathMatrix<T, TriDiagonalMathMatrix>
+{
+  public:
+    /*
+     * brief  Creates an empty matrix
+     */
+    TriDiagonalMathMatrix() {}
+
+    /*
+     * brief  Creates a zero matrix of size [size, size]
+     */
+    explicit TriDiagonalMathMatrix(size_t size);
+
+    /*
+     * brief  Creates a matrix with constant diagonals, lower below the
+     *        diagonal and upper above it
+     * post   creates a matrix of size [size, size]
+     */
+    TriDiagonalMathMatrix(size_t size, T lower, T diagonal, T upper);
+
+    /*
+     * brief  Creates a copy of other
+     * pre    other must be square with zeros off the three diagonals else
+     *        exception is thrown
+     */
+    TriDiagonalMathMatrix(const IMathMatrix<T>& other);
+    TriDiagonalMathMatrix(const TriDiagonalMathMatrix& other) = default;
+    TriDiagonalMathMatrix(TriDiagonalMathMatrix&& other) = default;
+
+    TriDiagonalMathMatrix<T>& operator=(TriDiagonalMathMatrix rhs);
+
+    using IMathMatrix<T>::operator==;
+    using IMathMatrix<T>::operator!=;
+    bool opEquality(const IMathMatrix<T>& rhs) const;
+    bool operator==(const TriDiagonalMathMatrix& rhs) const;
+    bool operator!=(const TriDiagonalMathMatrix& rhs) const;
+
+    /*
+     * brief  Compound operators. The result must be tridiagonal, so rhs of
+     *        += and -= and the product of *= may only have entries on the
+     *        three diagonals else exception is thrown
+     */
+    TriDiagonalMathMatrix& opPlusEquals(const IMathMatrix<T>& rhs);
+    TriDiagonalMathMatrix& opMinusEquals(const IMathMatrix<T>& rhs);
+    TriDiagonalMathMatrix& opTimesEquals(const IMathMatrix<T>& rhs);
+    TriDiagonalMathMatrix& opTimesEquals(const T& scaler);
+
+    MathMatrix<T> operator+(const IMathMatrix<T>& rhs) const;
+    TriDiagonalMathMatrix operator+(const TriDiagonalMathMatrix& rhs) const;
+    MathMatrix<T> operator-(const IMathMatrix<T>& rhs) const;
+    TriDiagonalMathMatrix operator-(const TriDiagonalMathMatrix& rhs) const;
+    TriDiagonalMathMatrix operator-() const;
+    MathMatrix<T> operator*(const IMathMatrix<T>& rhs) const;
+    TriDiagonalMathMatrix operator*(const T& scaler) const;
+
+    /*
+     * brief  Multiplies this by rhs in O(n)
+     * pre    rhs must have size rows() else exception is thrown
+     */
+    MathVector<T> operator*(const MathVector<T>& rhs) const;
+
+    TriDiagonalMathMatrix transpose() const;
+
+    /*
+     * brief  Accesses entry (row, column). Entries off the three diagonals
+     *        read as zero but cannot be assigned
+     * pre    row and column must be less than rows() else exception is
+     *        thrown, as is assigning off the three diagonals
+     */
+    T& at(size_t row, size_t column);
+    const T& at(size_t row, size_t column) const;
+
+    /*
+     * brief  Direct access to the three diagonals
+     * post   The entries outside the matrix must be left zero
+     */
+    MathVector<T>& lower() { return myLower; }
+    const MathVector<T>& lower() const { return myLower; }
+    MathVector<T>& diagonal() { return myDiagonal; }
+    const MathVector<T>& diagonal() const { return myDiagonal; }
+    MathVector<T>& upper() { return myUpper; }
+    const MathVector<T>& upper() const { return myUpper; }
+
+    size_t getRows() const;
+    size_t getCols() const;
+
+    void swap(TriDiagonalMathMatrix& other);
+    void printToStream(std::ostream& os) const;
+
+    /*
+     * brief  Reads rows() lines of rows() values each, as MathMatrix does
+     * pre    Values off the three diagonals must be zero else exception is
+     *        thrown
+     */
+    void readFromStream(std::istream& is);
+
+  private:
+    /*
+     * brief  Sets this to other
+     * pre    other must be square with zeros off the three diagonals else
+     *        exception is thrown and this is unchanged
+     */
+    void assign(const IMathMatrix<T>& other);
+
+    MathVector<T> myLower;
+    MathVector<T> myDiagonal;
+    MathVector<T> myUpper;
+    const T zero = 0;
+};
+
+#include "TriDiagonalMathMatrix.hpp"
+
+#endif
@@ -0,0 +1,361 @@
+/*
+ * author Connor Walsh
+ * file   TriDiagonalMathMatrix.hpp
+ * brief  Implementation file for the TriDiagonalMathMatrix class
+ */
+
+#include <stdexcept>
+#include <iomanip>
+#include <utility>
+
+#include "MathMatrix.h"
+#include "TriDiagonalMathMatrix.h"
+
+template <class T>
+TriDiagonalMathMatrix<T>::TriDiagonalMathMatrix(size_t size)
+  : myLower(size), myDiagonal(size), myUpper(size) {}
+
+template <class T>
+TriDiagonalMathMatrix<T>::TriDiagonalMathMatrix(size_t size, T lower,
+    T diagonal, T upper) : myLower(size), myDiagonal(size), myUpper(size)
+{
+  for (size_t i = 0; i < size; ++i)
+  {
+    myLower[i] = (i > 0) ? lower : T(0);
+    myDiagonal[i] = diagonal;
+    myUpper[i] = (i + 1 < size) ? upper : T(0);
+  }
+}
+
+template <class T>
+TriDiagonalMathMatrix<T>::TriDiagonalMathMatrix(const IMathMatrix<T>& other)
+{
+  assign(other);
+}
+
+template <class T>
+TriDiagonalMathMatrix<T>& TriDiagonalMathMatrix<T>::operator=
+    (TriDiagonalMathMatrix<T> rhs)
+{
+  swap(rhs);
+  return *this;
+}
+
+template <class T>
+void TriDiagonalMathMatrix<T>::swap(TriDiagonalMathMatrix<T>& other)
+{
+  std::swap(myLower, other.myLower);
+  std::swap(myDiagonal, other.myDiagonal);
+  std::swap(myUpper, other.myUpper);
+}
+
+template <class T>
+void TriDiagonalMathMatrix<T>::assign(const IMathMatrix<T>& other)
+{
+  size_t size = other.rows();
+  if (other.cols() != size)
+  {
+    throw std::domain_error("Cannot make a TriDiagonalMathMatrix from a"
+        " matrix that is not square!");
+  }
+
+  TriDiagonalMathMatrix<T> result(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    for (size_t j = 0; j < size; ++j)
+    {
+      if (j + 1 == i)
+      {
+        result.myLower[i] = other(i, j);
+      }
+      else if (j == i)
+      {
+        result.myDiagonal[i] = other(i, j);
+      }
+      else if (j == i + 1)
+      {
+        result.myUpper[i] = other(i, j);
+      }
+      else if (other(i, j) != 0)
+      {
+        throw std::domain_error("Cannot make a TriDiagonalMathMatrix from a"
+            " matrix with entries off the three diagonals!");
+      }
+    }
+  }
+  swap(result);
+}
+
+template <class T>
+bool TriDiagonalMathMatrix<T>::opEquality(const IMathMatrix<T>& rhs) const
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols()) return false;
+
+  for (size_t i = 0, size = getRows(); i < size; ++i)
+  {
+    for (size_t j = 0; j < size; ++j)
+    {
+      if (at(i, j) != rhs(i, j)) return false;
+    }
+  }
+  return true;
+}
+
+template <class T>
+bool TriDiagonalMathMatrix<T>::operator==
+    (const TriDiagonalMathMatrix<T>& rhs) const
+{
+  return myLower == rhs.myLower && myDiagonal == rhs.myDiagonal &&
+    myUpper == rhs.myUpper;
+}
+
+template <class T>
+bool TriDiagonalMathMatrix<T>::operator!=
+    (const TriDiagonalMathMatrix<T>& rhs) const
+{
+  return !(*this == rhs);
+}
+
+template <class T>
+TriDiagonalMathMatrix<T>& TriDiagonalMathMatrix<T>::opPlusEquals
+    (const IMathMatrix<T>& rhs)
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  TriDiagonalMathMatrix<T> other(rhs);
+  myLower += other.myLower;
+  myDiagonal += other.myDiagonal;
+  myUpper += other.myUpper;
+  return *this;
+}
+
+template <class T>
+TriDiagonalMathMatrix<T>& TriDiagonalMathMatrix<T>::opMinusEquals
+    (const IMathMatrix<T>& rhs)
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  TriDiagonalMathMatrix<T> other(rhs);
+  myLower -= other.myLower;
+  myDiagonal -= other.myDiagonal;
+  myUpper -= other.myUpper;
+  return *this;
+}
+
+template <class T>
+TriDiagonalMathMatrix<T>& TriDiagonalMathMatrix<T>::opTimesEquals
+    (const IMathMatrix<T>& rhs)
+{
+  assign((*this) * rhs);
+  return *this;
+}
+
+template <class T>
+TriDiagonalMathMatrix<T>& TriDiagonalMathMatrix<T>::opTimesEquals
+    (const T& scaler)
+{
+  myLower *= scaler;
+  myDiagonal *= scaler;
+  myUpper *= scaler;
+  return *this;
+}
+
+template <class T>
+MathMatrix<T> TriDiagonalMathMatrix<T>::operator+
+    (const IMathMatrix<T>& rhs) const
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  MathMatrix<T> result(rhs);
+  for (size_t i = 0, size = getRows(); i < size; ++i)
+  {
+    if (i > 0) result(i, i - 1) += myLower[i];
+    result(i, i) += myDiagonal[i];
+    if (i + 1 < size) result(i, i + 1) += myUpper[i];
+  }
+  return result;
+}
+
+template <class T>
+TriDiagonalMathMatrix<T> TriDiagonalMathMatrix<T>::operator+
+    (const TriDiagonalMathMatrix<T>& rhs) const
+{
+  TriDiagonalMathMatrix<T> result(*this);
+  result += rhs;
+  return result;
+}
+
+template <class T>
+MathMatrix<T> TriDiagonalMathMatrix<T>::operator-
+    (const IMathMatrix<T>& rhs) const
+{
+  if (getRows() != rhs.rows() || getCols() != rhs.cols())
+  {
+    throw std::domain_error("Cannot add two matrices of differing dimensions!");
+  }
+
+  MathMatrix<T> result(*this);
+  result -= rhs;
+  return result;
+}
+
+template <class T>
+TriDiagonalMathMatrix<T> TriDiagonalMathMatrix<T>::operator-
+    (const TriDiagonalMathMatrix<T>& rhs) const
+{
+  TriDiagonalMathMatrix<T> result(*this);
+  result -= rhs;
+  return result;
+}
+
+template <class T>
+TriDiagonalMathMatrix<T> TriDiagonalMathMatrix<T>::operator-() const
+{
+  TriDiagonalMathMatrix<T> result(*this);
+  result *= T(-1);
+  return result;
+}
+
+template <class T>
+MathMatrix<T> TriDiagonalMathMatrix<T>::operator*
+    (const IMathMatrix<T>& rhs) const
+{
+  size_t size = getRows();
+  if (size != rhs.rows())
+  {
+    throw std::domain_error("Cannot multiply matrices of incorrect dimensions!");
+  }
+
+  MathMatrix<T> result(size, rhs.cols());
+  for (size_t i = 0; i < size; ++i)
+  {
+    for (size_t col = 0, numCols = rhs.cols(); col < numCols; ++col)
+    {
+      T sum = myDiagonal[i] * rhs(i, col);
+      if (i > 0) sum += myLower[i] * rhs(i - 1, col);
+      if (i + 1 < size) sum += myUpper[i] * rhs(i + 1, col);
+      result(i, col) = sum;
+    }
+  }
+  return result;
+}
+
+template <class T>
+TriDiagonalMathMatrix<T> TriDiagonalMathMatrix<T>::operator*
+    (const T& scaler) const
+{
+  TriDiagonalMathMatrix<T> result(*this);
+  result *= scaler;
+  return result;
+}
+
+template <class T>
+MathVector<T> TriDiagonalMathMatrix<T>::operator*
+    (const MathVector<T>& rhs) const
+{
+  size_t size = getRows();
+  if (size != rhs.size())
+  {
+    throw std::domain_error("Cannot multiply by MathVector of incorrect dimensions!");
+  }
+
+  MathVector<T> result(size);
+  if (size == 0)
+  {
+    return result;
+  }
+
+  result[0] = myDiagonal[0] * rhs[0];
+  for (size_t i = 1; i < size; ++i)
+  {
+    result[i] = myLower[i] * rhs[i - 1] + myDiagonal[i] * rhs[i];
+  }
+  for (size_t i = 0; i + 1 < size; ++i)
+  {
+    result[i] += myUpper[i] * rhs[i + 1];
+  }
+  return result;
+}
+
+template <class T>
+TriDiagonalMathMatrix<T> TriDiagonalMathMatrix<T>::transpose() const
+{
+  size_t size = getRows();
+  TriDiagonalMathMatrix<T> result(size);
+  result.myDiagonal = myDiagonal;
+  for (size_t i = 0; i + 1 < size; ++i)
+  {
+    result.myLower[i + 1] = myUpper[i];
+    result.myUpper[i] = myLower[i + 1];
+  }
+  return result;
+}
+
+template <class T>
+T& TriDiagonalMathMatrix<T>::at(size_t row, size_t column)
+{
+  if (row >= getRows() || column >= getCols())
+  {
+    throw std::out_of_range("Index out of range of TriDiagonalMathMatrix!");
+  }
+  if (column == row) return myDiagonal[row];
+  if (column + 1 == row) return myLower[row];
+  if (column == row + 1) return myUpper[row];
+  throw std::out_of_range("Cannot assign to values off the three diagonals"
+      " of a TriDiagonalMathMatrix!");
+}
+
+template <class T>
+const T& TriDiagonalMathMatrix<T>::at(size_t row, size_t column) const
+{
+  if (row >= getRows() || column >= getCols())
+  {
+    throw std::out_of_range("Index out of range of TriDiagonalMathMatrix!");
+  }
+  if (column == row) return myDiagonal[row];
+  if (column + 1 == row) return myLower[row];
+  if (column == row + 1) return myUpper[row];
+  return zero;
+}
+
+template <class T>
+size_t TriDiagonalMathMatrix<T>::getRows() const
+{
+  return myDiagonal.size();
+}
+
+template <class T>
+size_t TriDiagonalMathMatrix<T>::getCols() const
+{
+  return myDiagonal.size();
+}
+
+template <class T>
+void TriDiagonalMathMatrix<T>::printToStream(std::ostream& os) const
+{
+  for (size_t i = 0, size = getRows(); i < size; ++i)
+  {
+    for (size_t j = 0; j < size; ++j)
+    {
+      os << std::setw(10) << at(i, j) << " ";
+    }
+    os << "\n";
+  }
+}
+
+template <class T>
+void TriDiagonalMathMatrix<T>::readFromStream(std::istream& is)
+{
+  MathMatrix<T> dense(getRows(), getCols());
+  is >> dense;
+  assign(dense);
+}
@@ -20,7 +20,7 @@
 #include "LowTriangleMathMatrix.h"
 
 template <class T>
-class UpTriangleMathMatrix : public BaseMathMatrix<T, UpTriangleMathMatrix>
+class UpTriangleMathMatrix final : public BaseMathMatrix<T, UpTriangleMathMatrix>
 {
   public:
     UpTriangleMathMatrix() : myColumns(0) {}
@@ -0,0 +1,101 @@
+/*
+ * author Connor Walsh
+ * file   ADISolver.h
+ * brief  Alternating direction implicit (Peaceman-Rachford) iteration for
+ *        the DirichletPoisson grid
+ */
+
+#ifndef ADI_SOLVER_H
+#define ADI_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+#include <stdexcept>
+
+#include "IterativeSolver.h"
+#include "ThomasFactorization.h"
+#include "../MathVector.h"
+#include "../math_matrix/TriDiagonalMathMatrix.h"
+
+/*
+ * class  ADISolver
+ * brief  Solves the system DirichletPoisson generates for numDivs divisions
+ *        on the grid without forming A. A splits into H + V, the couplings
+ *        along grid rows and along grid columns, each a set of independent
+ *        tridiagonal systems. Each iteration solves
+ *          (H + rI) u' = b - (V - rI) u   along every row, then
+ *          (V + rI) u  = b - (H - rI) u'  along every column
+ *        with the shift r cycling through values spread geometrically
+ *        between the smallest and largest eigenvalues of H. Every line has
+ *        the same tridiagonal system, so one ThomasFactorization per shift
+ *        serves them all. Rows are solved in parallel, and the columns are
+ *        solved together a grid row at a time through solveLanes so the
+ *        column solves also run over consecutive memory. One iteration is
+ *        a row and a column half step
+ */
+template <class T>
+class ADISolver : public IterativeSolver<T, GridSolver>
+{
+  public:
+    /*
+     * brief  Creates a solver with a relative residual tolerance, a limit on
+     *        the number of iterations and the number of shifts per cycle
+     * post   A maxIterations of zero allows one iteration per unknown, and
+     *        at least 100. A numShifts of zero picks a number that grows
+     *        with the log of the spread of the eigenvalues
+     */
+    ADISolver(T tolerance = 1e-10, size_t maxIterations = 0,
+        size_t numShifts = 0)
+      : IterativeSolver<T, GridSolver>(tolerance, maxIterations),
+      myNumShifts(numShifts) {}
+
+    /*
+     * brief  Function to change the number of shifts per cycle
+     * post   Later solves use the new value
+     */
+    void setNumShifts(size_t numShifts) { myNumShifts = numShifts; }
+
+    /*
+     * brief  Returns the cycle of shifts used for numDivs divisions
+     * pre    numDivs must be greater than 1
+     * post   returns the shifts in increasing order
+     */
+    MathVector<T> shifts(int numDivs) const;
+
+    /*
+     * brief  Solves Ax = b starting from the zero vector or initialGuess
+     * pre    b and initialGuess have (numDivs - 1)^2 entries ordered as in
+     *        DirichletPoisson, numDivs > 1
+     * post   returns x. Throws an exception if the tolerance is not met
+     *        within the iteration limit
+     */
+    MathVector<T> solve(const MathVector<T>& b, int numDivs) const;
+    MathVector<T> solve(const MathVector<T>& b, int numDivs,
+        const MathVector<T>& initialGuess) const;
+
+  private:
+    /*
+     * brief  The row half step, solving (H + rI) half = b - (V - rI) x
+     */
+    static void rowStep(const ThomasFactorization<T>& factors, T shift, int width,
+        const MathVector<T>& b, const MathVector<T>& x, MathVector<T>& half);
+
+    /*
+     * brief  The column half step, solving (V + rI) x = b - (H - rI) half
+     */
+    static void columnStep(const ThomasFactorization<T>& factors, T shift, int width,
+        const MathVector<T>& b, const MathVector<T>& half, MathVector<T>& x);
+
+    /*
+     * brief  Returns the squared norm of the residual b - Ax
+     */
+    static T residualSquares(int width, const MathVector<T>& b,
+        const MathVector<T>& x);
+
+    size_t myNumShifts;
+};
+
+#include "ADISolver.hpp"
+
+#endif
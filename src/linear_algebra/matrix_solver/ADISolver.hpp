@@ -0,0 +1,207 @@
+/*
+ * author Connor Walsh
+ * file   ADISolver.hpp
+ * brief  Implementation file for the ADISolver class
+ */
+
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+#include "ADISolver.h"
+#include "../../parallel/ThreadPool.h"
+
+template <class T>
+MathVector<T> ADISolver<T>::shifts(int numDivs) const
+{
+  if (numDivs < 2)
+  {
+    throw std::domain_error("ADI requires at least two divisions!");
+  }
+
+  // Eigenvalues of H along one line are (1 - cos(k pi / numDivs)) / 2
+  T pi = std::acos(T(-1));
+  T smallest = (1 - std::cos(pi / numDivs)) / 2;
+  T largest = (1 + std::cos(pi / numDivs)) / 2;
+  T spread = largest / smallest;
+
+  size_t numShifts = myNumShifts;
+  if (numShifts == 0)
+  {
+    numShifts = std::max<size_t>(1, std::ceil(std::log(spread) / 2));
+  }
+
+  MathVector<T> result(numShifts);
+  for (size_t j = 0; j < numShifts; ++j)
+  {
+    result[j] = smallest * std::pow(spread, (j + T(0.5)) / numShifts);
+  }
+  return result;
+}
+
+template <class T>
+void ADISolver<T>::rowStep(const ThomasFactorization<T>& factors, T shift, int width,
+    const MathVector<T>& b, const MathVector<T>& x, MathVector<T>& half)
+{
+  parallelFor(0, width, ThreadPool::grainFor(16 * width),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        for (int j = firstRow; j < (int)lastRow; ++j)
+        {
+          T* line = &half[j * width];
+          const T* current = &x[j * width];
+          const T* constants = &b[j * width];
+          for (int i = 0; i < width; ++i)
+          {
+            line[i] = constants[i] + (shift - 0.5) * current[i];
+          }
+          if (j > 0)
+          {
+            const T* below = current - width;
+            for (int i = 0; i < width; ++i)
+            {
+              line[i] += 0.25 * below[i];
+            }
+          }
+          if (j + 1 < width)
+          {
+            const T* above = current + width;
+            for (int i = 0; i < width; ++i)
+            {
+              line[i] += 0.25 * above[i];
+            }
+          }
+          factors.solveInPlace(line);
+        }
+      });
+}
+
+template <class T>
+void ADISolver<T>::columnStep(const ThomasFactorization<T>& factors, T shift,
+    int width, const MathVector<T>& b, const MathVector<T>& half,
+    MathVector<T>& x)
+{
+  parallelFor(0, width, ThreadPool::grainFor(8 * width),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        for (int j = firstRow; j < (int)lastRow; ++j)
+        {
+          T* line = &x[j * width];
+          const T* current = &half[j * width];
+          const T* constants = &b[j * width];
+          for (int i = 0; i < width; ++i)
+          {
+            line[i] = constants[i] + (shift - 0.5) * current[i];
+          }
+          for (int i = 1; i < width; ++i)
+          {
+            line[i] += 0.25 * current[i - 1];
+          }
+          for (int i = 0; i + 1 < width; ++i)
+          {
+            line[i] += 0.25 * current[i + 1];
+          }
+        }
+      });
+
+  // Every column is eliminated at once, grid row j holding entry j of all
+  // of them, so each step is a loop over consecutive lanes
+  parallelFor(0, width, ThreadPool::grainFor(8 * width),
+      [&](size_t firstLane, size_t lastLane)
+      {
+        factors.solveLanes(&x[0], width, firstLane, lastLane);
+      });
+}
+
+template <class T>
+T ADISolver<T>::residualSquares(int width, const MathVector<T>& b,
+    const MathVector<T>& x)
+{
+  // Blocks of rows depend only on the grid, so the norm is the same for any
+  // number of threads
+  return parallelReduce(0, width, ThreadPool::grainFor(8 * width), T(0),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        T squares = 0;
+        for (int j = firstRow; j < (int)lastRow; ++j)
+        {
+          for (int i = 0; i < width; ++i)
+          {
+            T neighbours = 0;
+            if (i > 0)
+            {
+              neighbours += x[j * width + i - 1];
+            }
+            if (i + 1 < width)
+            {
+              neighbours += x[j * width + i + 1];
+            }
+            if (j > 0)
+            {
+              neighbours += x[(j - 1) * width + i];
+            }
+            if (j + 1 < width)
+            {
+              neighbours += x[(j + 1) * width + i];
+            }
+            T residual = b[j * width + i] - x[j * width + i] + 0.25 * neighbours;
+            squares += residual * residual;
+          }
+        }
+        return squares;
+      },
+      [](T lhs, T rhs) { return lhs + rhs; });
+}
+
+template <class T>
+MathVector<T> ADISolver<T>::solve(const MathVector<T>& b, int numDivs) const
+{
+  MathVector<T> zero(b.size());
+  return solve(b, numDivs, zero);
+}
+
+template <class T>
+MathVector<T> ADISolver<T>::solve(const MathVector<T>& b, int numDivs,
+    const MathVector<T>& initialGuess) const
+{
+  size_t numPoints = (numDivs - 1) * (numDivs - 1);
+  if (numDivs < 2 || b.size() != numPoints || initialGuess.size() != numPoints)
+  {
+    throw std::domain_error("Cannot perform ADI on vectors of incorrect"
+        " dimensions!");
+  }
+
+  int width = numDivs - 1;
+  MathVector<T> cycle = shifts(numDivs);
+  std::vector<ThomasFactorization<T> > factors;
+  for (size_t j = 0; j < cycle.size(); ++j)
+  {
+    factors.push_back(ThomasFactorization<T>(
+        TriDiagonalMathMatrix<T>(width, -0.25, T(0.5) + cycle[j], -0.25)));
+  }
+
+  MathVector<T> x(initialGuess);
+  MathVector<T> half(numPoints);
+  T threshold = this->myTolerance * this->myTolerance * b.dotProduct(b);
+  size_t maxIterations = this->iterationLimit(
+      std::max<size_t>(100, numPoints), 1);
+  size_t& iterations = this->myIterations;
+  iterations = 0;
+
+  while (residualSquares(width, b, x) > threshold)
+  {
+    if (iterations == maxIterations)
+    {
+      throw std::domain_error("ADI did not converge within the iteration"
+          " limit!");
+    }
+
+    size_t shift = iterations % cycle.size();
+    rowStep(factors[shift], cycle[shift], width, b, x, half);
+    columnStep(factors[shift], cycle[shift], width, b, half, x);
+    ++iterations;
+  }
+
+  return x;
+}
@@ -0,0 +1,67 @@
+/*
+ * author Connor Walsh
+ * file   BatchedGaussianSolver.h
+ * brief  Solves a batch of small systems together with Gaussian elimination
+ */
+
+#ifndef BATCHED_GAUSSIAN_SOLVER_H
+#define BATCHED_GAUSSIAN_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "BatchedSystems.h"
+#include "../../parallel/ThreadPool.h"
+
+/*
+ * class  BatchedGaussianSolver
+ * brief  Runs the same Gaussian elimination as GaussianEliminationSolver on
+ *        every system of a BatchedSystems at once. Every step is applied to
+ *        all lanes in a tight loop over consecutive memory so it vectorizes
+ *        across the batch, and ranges of lanes are solved on different
+ *        threads. Each system gets exactly the result
+ *        GaussianEliminationSolver would give it
+ */
+template <class T>
+class BatchedGaussianSolver
+{
+  public:
+    /*
+     * brief  Lanes below this many per task leave vector registers and
+     *        cache lines partly empty
+     */
+    static const size_t minLanesPerTask = 16;
+
+    /*
+     * brief  Creates a solver that uses partial pivoting or not
+     */
+    BatchedGaussianSolver(bool partialPivot = false) : usePivot(partialPivot) {}
+
+    /*
+     * brief  Function to change whether the pivoting technique is used
+     * post   Solver will use piviting if true, and not if false
+     */
+    void setUsePivot(bool pivot) { usePivot = pivot; }
+
+    /*
+     * brief  Solves every system of the batch in place
+     * post   The constants of each system hold its solution and the
+     *        coefficients hold its eliminated form. Throws an exception if
+     *        any system needs a division by zero
+     */
+    void solveInPlace(BatchedSystems<T>& systems) const;
+
+  private:
+    /*
+     * brief  Solves lanes [first, last) of systems
+     */
+    static void solveLanes(BatchedSystems<T>& systems, size_t first,
+        size_t last, bool partialPivot);
+
+    bool usePivot;
+};
+
+#include "BatchedGaussianSolver.hpp"
+
+#endif
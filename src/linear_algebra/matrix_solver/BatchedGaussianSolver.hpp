@@ -0,0 +1,137 @@
+/*
+ * author Connor Walsh
+ * file   BatchedGaussianSolver.hpp
+ * brief  Implementation file for the BatchedGaussianSolver class
+ */
+
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+#include <cmath>
+
+#include "BatchedGaussianSolver.h"
+
+template <class T>
+const size_t BatchedGaussianSolver<T>::minLanesPerTask;
+
+template <class T>
+void BatchedGaussianSolver<T>::solveInPlace(BatchedSystems<T>& systems) const
+{
+  size_t size = systems.size();
+  size_t grain = std::max<size_t>(minLanesPerTask,
+      ThreadPool::grainFor(size * size * size));
+  bool partialPivot = usePivot;
+
+  parallelFor(0, systems.count(), grain,
+      [&systems, partialPivot](size_t first, size_t last)
+      {
+        solveLanes(systems, first, last, partialPivot);
+      });
+}
+
+template <class T>
+void BatchedGaussianSolver<T>::solveLanes(BatchedSystems<T>& systems,
+    size_t first, size_t last, bool partialPivot)
+{
+  int size = systems.size();
+  size_t width = last - first;
+  // The lane loops index the scratch row through a raw pointer so they stay
+  // free of bounds checks and vectorize
+  MathVector<double> ratioVector(width);
+  double* ratios = ratioVector.begin();
+
+  for (int k = 0; k < size - 1; ++k)
+  {
+    if (partialPivot)
+    {
+      // Pivot rows differ between systems so exchanges are made lane by lane
+      for (size_t lane = first; lane < last; ++lane)
+      {
+        int pivotRow = k;
+        for (int row = k + 1; row < size; ++row)
+        {
+          if (std::abs(systems.coefficient(lane, row, k)) >
+              std::abs(systems.coefficient(lane, pivotRow, k)))
+          {
+            pivotRow = row;
+          }
+        }
+        if (pivotRow != k)
+        {
+          for (int col = 0; col < size; ++col)
+          {
+            std::swap(systems.coefficient(lane, k, col),
+                systems.coefficient(lane, pivotRow, col));
+          }
+          std::swap(systems.constant(lane, k), systems.constant(lane, pivotRow));
+        }
+      }
+    }
+
+    const T* pivot = systems.coefficientLanes(k, k) + first;
+    for (size_t lane = 0; lane < width; ++lane)
+    {
+      if (pivot[lane] == 0)
+      {
+        throw std::domain_error(partialPivot ? "Divide by zero encountered in "
+            "Gaussian Forward Elimination! Unable to Pivot!" : "Divide by zero "
+            "encountered in Gaussian Forward Elimination!");
+      }
+    }
+
+    const T* pivotConstants = systems.constantLanes(k) + first;
+    for (int i = k + 1; i < size; ++i)
+    {
+      T* multipliers = systems.coefficientLanes(i, k) + first;
+      for (size_t lane = 0; lane < width; ++lane)
+      {
+        ratios[lane] = static_cast<double>(multipliers[lane]) / pivot[lane];
+      }
+
+      for (int j = k + 1; j < size; ++j)
+      {
+        T* row = systems.coefficientLanes(i, j) + first;
+        const T* pivotRow = systems.coefficientLanes(k, j) + first;
+        for (size_t lane = 0; lane < width; ++lane)
+        {
+          row[lane] -= static_cast<T>(ratios[lane] * pivotRow[lane]);
+        }
+      }
+
+      T* constants = systems.constantLanes(i) + first;
+      for (size_t lane = 0; lane < width; ++lane)
+      {
+        constants[lane] -= static_cast<T>(ratios[lane] * pivotConstants[lane]);
+        multipliers[lane] = static_cast<T>(ratios[lane]);
+      }
+    }
+  }
+
+  for (int i = size - 1; i >= 0; --i)
+  {
+    T* constants = systems.constantLanes(i) + first;
+    for (int j = i + 1; j < size; ++j)
+    {
+      const T* coefficients = systems.coefficientLanes(i, j) + first;
+      const T* solved = systems.constantLanes(j) + first;
+      for (size_t lane = 0; lane < width; ++lane)
+      {
+        constants[lane] -= coefficients[lane] * solved[lane];
+      }
+    }
+
+    const T* diagonal = systems.coefficientLanes(i, i) + first;
+    for (size_t lane = 0; lane < width; ++lane)
+    {
+      if (diagonal[lane] == 0)
+      {
+        throw std::domain_error("Divide by zero encountered in backSubstitution!");
+      }
+    }
+    for (size_t lane = 0; lane < width; ++lane)
+    {
+      constants[lane] = static_cast<T>(constants[lane] /
+          static_cast<double>(diagonal[lane]));
+    }
+  }
+}
@@ -0,0 +1,119 @@
+/*
+ * author Connor Walsh
+ * file   BatchedSystems.h
+ * brief  Storage for many small systems Ax = b of the same size laid out so
+ *        they can be solved together
+ */
+
+#ifndef BATCHED_SYSTEMS_H
+#define BATCHED_SYSTEMS_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "../../containers/Array.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+
+/*
+ * class  BatchedSystems
+ * brief  Holds count systems of size unknowns in an interleaved (structure
+ *        of arrays) layout: the same entry of every system is stored
+ *        contiguously, one lane per system. An operation applied to one
+ *        entry of all systems therefore walks consecutive memory, which lets
+ *        the compiler vectorize across the batch. After a batched solve the
+ *        constants hold the solutions
+ */
+template <class T>
+class BatchedSystems
+{
+  public:
+    /*
+     * brief  Creates count zeroed systems of size unknowns
+     * post   Every coefficient and constant is T()
+     */
+    BatchedSystems(size_t count, size_t size);
+
+    /*
+     * brief  Returns the number of systems in the batch
+     */
+    size_t count() const { return myCount; }
+
+    /*
+     * brief  Returns the number of unknowns of each system
+     */
+    size_t size() const { return mySize; }
+
+    /*
+     * brief  Returns the coefficient A(row, col) of system number system
+     * pre    All indices must be in range, behaviour is undefined otherwise
+     */
+    T& coefficient(size_t system, size_t row, size_t col)
+    {
+      return myCoefficients[(row * mySize + col) * myCount + system];
+    }
+    const T& coefficient(size_t system, size_t row, size_t col) const
+    {
+      return myCoefficients[(row * mySize + col) * myCount + system];
+    }
+
+    /*
+     * brief  Returns the constant b[row] of system number system, which
+     *        holds x[row] after the batch has been solved
+     * pre    All indices must be in range, behaviour is undefined otherwise
+     */
+    T& constant(size_t system, size_t row)
+    {
+      return myConstants[row * myCount + system];
+    }
+    const T& constant(size_t system, size_t row) const
+    {
+      return myConstants[row * myCount + system];
+    }
+
+    /*
+     * brief  Returns the entry A(row, col) of every system, one per lane
+     * post   returns a pointer to count() consecutive values
+     */
+    T* coefficientLanes(size_t row, size_t col)
+    {
+      return myCoefficients.begin() + (row * mySize + col) * myCount;
+    }
+
+    /*
+     * brief  Returns the entry b[row] of every system, one per lane
+     * post   returns a pointer to count() consecutive values
+     */
+    T* constantLanes(size_t row)
+    {
+      return myConstants.begin() + row * myCount;
+    }
+
+    /*
+     * brief  Copies A and b into system number system
+     * pre    system < count() and A and b must be of size size() else
+     *        exception is thrown
+     * post   the system holds A and b
+     */
+    void setSystem(size_t system, const IMathMatrix<T>& A,
+        const MathVector<T>& b);
+
+    /*
+     * brief  Returns the constants of system number system, which are the
+     *        solution once the batch has been solved
+     * pre    system < count() else exception is thrown
+     * post   returns a vector of size() values
+     */
+    MathVector<T> solution(size_t system) const;
+
+  private:
+    size_t myCount;
+    size_t mySize;
+    Array<T> myCoefficients;
+    Array<T> myConstants;
+};
+
+#include "BatchedSystems.hpp"
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * author Connor Walsh
+ * file   BatchedSystems.hpp
+ * brief  Implementation file for the BatchedSystems class
+ */
+
+#include <stdexcept>
+
+#include "BatchedSystems.h"
+
+template <class T>
+BatchedSystems<T>::BatchedSystems(size_t count, size_t size)
+  : myCount(count), mySize(size), myCoefficients(count * size * size),
+    myConstants(count * size) {}
+
+template <class T>
+void BatchedSystems<T>::setSystem(size_t system, const IMathMatrix<T>& A,
+    const MathVector<T>& b)
+{
+  if (system >= myCount)
+  {
+    throw std::out_of_range("Invalid system index to BatchedSystems!");
+  }
+  if (A.rows() != mySize || A.cols() != mySize || b.size() != mySize)
+  {
+    throw std::domain_error("Cannot add a system of incorrect dimensions"
+        " to BatchedSystems!");
+  }
+
+  for (size_t row = 0; row < mySize; ++row)
+  {
+    for (size_t col = 0; col < mySize; ++col)
+    {
+      coefficient(system, row, col) = A(row, col);
+    }
+    constant(system, row) = b[row];
+  }
+}
+
+template <class T>
+MathVector<T> BatchedSystems<T>::solution(size_t system) const
+{
+  if (system >= myCount)
+  {
+    throw std::out_of_range("Invalid system index to BatchedSystems!");
+  }
+
+  MathVector<T> result(mySize);
+  for (size_t row = 0; row < mySize; ++row)
+  {
+    result[row] = constant(system, row);
+  }
+  return result;
+}
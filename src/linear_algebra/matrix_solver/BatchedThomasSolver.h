@@ -0,0 +1,54 @@
+/*
+ * author Connor Walsh
+ * file   BatchedThomasSolver.h
+ * brief  Solves a batch of tridiagonal systems together with the Thomas
+ *        algorithm
+ */
+
+#ifndef BATCHED_THOMAS_SOLVER_H
+#define BATCHED_THOMAS_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "BatchedTriDiagonalSystems.h"
+#include "../../parallel/ThreadPool.h"
+
+/*
+ * class  BatchedThomasSolver
+ * brief  Runs the same elimination as ThomasFactorization on every system
+ *        of a BatchedTriDiagonalSystems at once. Every step is a loop over
+ *        consecutive lanes and ranges of lanes are solved on different
+ *        threads. Each system gets exactly the result ThomasSolver would
+ *        give it
+ */
+template <class T>
+class BatchedThomasSolver
+{
+  public:
+    /*
+     * brief  Lanes below this many per task leave vector registers and
+     *        cache lines partly empty
+     */
+    static const size_t minLanesPerTask = 16;
+
+    /*
+     * brief  Solves every system of the batch in place
+     * post   The constants of each system hold its solution, the diagonals
+     *        hold its factors. Throws an exception if any system has a zero
+     *        pivot
+     */
+    void solveInPlace(BatchedTriDiagonalSystems<T>& systems) const;
+
+  private:
+    /*
+     * brief  Solves lanes [first, last) of systems
+     */
+    static void solveLanes(BatchedTriDiagonalSystems<T>& systems,
+        size_t first, size_t last);
+};
+
+#include "BatchedThomasSolver.hpp"
+
+#endif
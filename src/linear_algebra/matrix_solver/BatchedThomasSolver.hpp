@@ -0,0 +1,94 @@
+/*
+ * author Connor Walsh
+ * file   BatchedThomasSolver.hpp
+ * brief  Implementation file for the BatchedThomasSolver class
+ */
+
+#include <stdexcept>
+#include <algorithm>
+
+#include "BatchedThomasSolver.h"
+
+template <class T>
+const size_t BatchedThomasSolver<T>::minLanesPerTask;
+
+template <class T>
+void BatchedThomasSolver<T>::solveInPlace(
+    BatchedTriDiagonalSystems<T>& systems) const
+{
+  size_t grain = std::max<size_t>(minLanesPerTask,
+      ThreadPool::grainFor(8 * systems.size()));
+  parallelFor(0, systems.count(), grain,
+      [&systems](size_t first, size_t last)
+      {
+        solveLanes(systems, first, last);
+      });
+}
+
+template <class T>
+void BatchedThomasSolver<T>::solveLanes(BatchedTriDiagonalSystems<T>& systems,
+    size_t first, size_t last)
+{
+  int size = systems.size();
+  size_t width = last - first;
+
+  // Forward elimination leaves the reciprocal pivots in the diagonal and
+  // the upper diagonal divided by its pivot in the upper diagonal
+  for (int i = 0; i < size; ++i)
+  {
+    const T* lower = systems.lowerLanes(i) + first;
+    T* inverse = systems.diagonalLanes(i) + first;
+    T* upper = systems.upperLanes(i) + first;
+    T* constants = systems.constantLanes(i) + first;
+    if (i > 0)
+    {
+      const T* previousUpper = systems.upperLanes(i - 1) + first;
+      for (size_t lane = 0; lane < width; ++lane)
+      {
+        inverse[lane] -= lower[lane] * previousUpper[lane];
+      }
+    }
+
+    for (size_t lane = 0; lane < width; ++lane)
+    {
+      if (inverse[lane] == 0)
+      {
+        throw std::domain_error("Divide by zero encountered in the Thomas"
+            " algorithm!");
+      }
+    }
+    for (size_t lane = 0; lane < width; ++lane)
+    {
+      inverse[lane] = 1 / inverse[lane];
+      upper[lane] *= inverse[lane];
+    }
+
+    if (i > 0)
+    {
+      const T* previous = systems.constantLanes(i - 1) + first;
+      for (size_t lane = 0; lane < width; ++lane)
+      {
+        constants[lane] = (constants[lane] - lower[lane] * previous[lane]) *
+          inverse[lane];
+      }
+    }
+    else
+    {
+      for (size_t lane = 0; lane < width; ++lane)
+      {
+        constants[lane] *= inverse[lane];
+      }
+    }
+  }
+
+  for (int i = size - 2; i >= 0; --i)
+  {
+    const T* upper = systems.upperLanes(i) + first;
+    T* constants = systems.constantLanes(i) + first;
+    const T* next = systems.constantLanes(i + 1) + first;
+    for (size_t lane = 0; lane < width; ++lane)
+    {
+      constants[lane] -= upper[lane] * next[lane];
+    }
+  }
+}
@@ -0,0 +1,90 @@
+/*
+ * author Connor Walsh
+ * file   BatchedTriDiagonalSystems.h
+ * brief  Storage for many tridiagonal systems Ax = b of the same size laid
+ *        out so they can be solved together
+ */
+
+#ifndef BATCHED_TRI_DIAGONAL_SYSTEMS_H
+#define BATCHED_TRI_DIAGONAL_SYSTEMS_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "../../containers/Array.h"
+#include "../MathVector.h"
+#include "../math_matrix/TriDiagonalMathMatrix.h"
+
+/*
+ * class  BatchedTriDiagonalSystems
+ * brief  Holds count tridiagonal systems of size unknowns in the same
+ *        interleaved layout as BatchedSystems: entry row of a diagonal or of
+ *        b is stored for every system contiguously, one lane per system.
+ *        Diagonals use the TriDiagonalMathMatrix convention, lower(s, 0) and
+ *        upper(s, size - 1) being outside the matrix. After a batched solve
+ *        the constants hold the solutions
+ */
+template <class T>
+class BatchedTriDiagonalSystems
+{
+  public:
+    /*
+     * brief  Creates count zeroed systems of size unknowns
+     */
+    BatchedTriDiagonalSystems(size_t count, size_t size);
+
+    size_t count() const { return myCount; }
+    size_t size() const { return mySize; }
+
+    /*
+     * brief  Return A(row, row - 1), A(row, row), A(row, row + 1) and b[row]
+     *        of system number system
+     * pre    All indices must be in range, behaviour is undefined otherwise
+     */
+    T& lower(size_t system, size_t row) { return myLower[row * myCount + system]; }
+    T& diagonal(size_t system, size_t row) { return myDiagonal[row * myCount + system]; }
+    T& upper(size_t system, size_t row) { return myUpper[row * myCount + system]; }
+    T& constant(size_t system, size_t row) { return myConstants[row * myCount + system]; }
+    const T& constant(size_t system, size_t row) const
+    {
+      return myConstants[row * myCount + system];
+    }
+
+    /*
+     * brief  Return entry row of a diagonal or of b for every system
+     * post   returns a pointer to count() consecutive values
+     */
+    T* lowerLanes(size_t row) { return myLower.begin() + row * myCount; }
+    T* diagonalLanes(size_t row) { return myDiagonal.begin() + row * myCount; }
+    T* upperLanes(size_t row) { return myUpper.begin() + row * myCount; }
+    T* constantLanes(size_t row) { return myConstants.begin() + row * myCount; }
+
+    /*
+     * brief  Copies A and b into system number system
+     * pre    system < count() and A and b must be of size size() else
+     *        exception is thrown
+     * post   the system holds A and b
+     */
+    void setSystem(size_t system, const TriDiagonalMathMatrix<T>& A,
+        const MathVector<T>& b);
+
+    /*
+     * brief  Returns the constants of system number system, which are the
+     *        solution once the batch has been solved
+     * pre    system < count() else exception is thrown
+     */
+    MathVector<T> solution(size_t system) const;
+
+  private:
+    size_t myCount;
+    size_t mySize;
+    Array<T> myLower;
+    Array<T> myDiagonal;
+    Array<T> myUpper;
+    Array<T> myConstants;
+};
+
+#include "BatchedTriDiagonalSystems.hpp"
+
+#endif
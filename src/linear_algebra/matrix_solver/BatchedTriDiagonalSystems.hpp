@@ -0,0 +1,54 @@
+/*
+ * author Connor Walsh
+ * file   BatchedTriDiagonalSystems.hpp
+ * brief  Implementation file for the BatchedTriDiagonalSystems class
+ */
+
+#include <stdexcept>
+
+#include "BatchedTriDiagonalSystems.h"
+
+template <class T>
+BatchedTriDiagonalSystems<T>::BatchedTriDiagonalSystems(size_t count,
+    size_t size) : myCount(count), mySize(size), myLower(count * size),
+    myDiagonal(count * size), myUpper(count * size), myConstants(count * size)
+{}
+
+template <class T>
+void BatchedTriDiagonalSystems<T>::setSystem(size_t system,
+    const TriDiagonalMathMatrix<T>& A, const MathVector<T>& b)
+{
+  if (system >= myCount)
+  {
+    throw std::out_of_range("Invalid system index to BatchedTriDiagonalSystems!");
+  }
+  if (A.rows() != mySize || b.size() != mySize)
+  {
+    throw std::domain_error("Cannot add a system of incorrect dimensions"
+        " to BatchedTriDiagonalSystems!");
+  }
+
+  for (size_t row = 0; row < mySize; ++row)
+  {
+    lower(system, row) = A.lower()[row];
+    diagonal(system, row) = A.diagonal()[row];
+    upper(system, row) = A.upper()[row];
+    constant(system, row) = b[row];
+  }
+}
+
+template <class T>
+MathVector<T> BatchedTriDiagonalSystems<T>::solution(size_t system) const
+{
+  if (system >= myCount)
+  {
+    throw std::out_of_range("Invalid system index to BatchedTriDiagonalSystems!");
+  }
+
+  MathVector<T> result(mySize);
+  for (size_t row = 0; row < mySize; ++row)
+  {
+    result[row] = constant(system, row);
+  }
+  return result;
+}
@@ -0,0 +1,91 @@
+/*
+ * author Connor Walsh
+ * file   BiCGSTABSolver.h
+ * brief  Class which implements the IMatrixSolver interface using the
+ *        biconjugate gradient stabilized method
+ */
+
+#ifndef BICGSTAB_SOLVER_H
+#define BICGSTAB_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "KrylovSolver.h"
+#include "SolverWorkspace.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+#include "../math_matrix/MathMatrix.h"
+
+/*
+ * class  BiCGSTABSolver
+ * brief  This class implements the IMatrixSolver interface with BiCGSTAB
+ *        for nonsingular matrices that need not be symmetric. Each
+ *        iteration takes a biconjugate gradient step against a fixed shadow
+ *        residual followed by a one dimensional minimal residual step,
+ *        which smooths the convergence of BiCG. It costs two products with
+ *        A and four dot products per iteration in seven vectors of storage,
+ *        fixed unlike GMRES, but may break down on a zero inner product
+ */
+template <class T>
+class BiCGSTABSolver : public KrylovSolver<T>
+{
+  mutable SolverWorkspace<T> myWorkspace;
+
+  public:
+    typedef typename KrylovSolver<T>::Side Side;
+
+    /*
+     * brief  Creates a solver with a relative residual tolerance and a limit
+     *        on the number of iterations
+     * post   A maxIterations of zero allows twice the number of unknowns
+     */
+    BiCGSTABSolver(T tolerance = 1e-10, size_t maxIterations = 0)
+      : KrylovSolver<T>(tolerance, maxIterations), myWorkspace(numVectors) {}
+
+    /*
+     * brief  Gives access to the scratch storage reused between solves
+     * post   returns a const reference to the solver's workspace
+     */
+    const SolverWorkspace<T>& workspace() const { return myWorkspace; }
+
+    /*
+    * brief   Solves Ax = b starting from the zero vector
+    * pre     A must be nonsingular and b of size A.rows()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> operator()
+      (const IMathMatrix<T>& A, const MathVector<T>& b) const;
+
+    /*
+    * brief   Solves Ax = b starting from initialGuess
+    * pre     Same as operator() and initialGuess of size A.cols()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> solveFrom(const IMathMatrix<T>& A,
+        const MathVector<T>& b, const MathVector<T>& initialGuess) const;
+    virtual MathVector<T> solveFrom(MathMatrix<T>&& A, MathVector<T>&& b,
+        const MathVector<T>& initialGuess) const;
+
+    /*
+    * brief   Statically dispatched versions of the function operator and
+    *         solveFrom. Matrix may be any concrete IMathMatrix type
+    * pre     Same as operator() and solveFrom
+    * post    returns the vector x in Ax = b. Throws an exception if the
+    *         iteration breaks down or the tolerance is not met within the
+    *         iteration limit
+    */
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b) const;
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b,
+        const MathVector<T>& initialGuess) const;
+
+  private:
+    static const size_t numVectors = 7;
+};
+
+#include "BiCGSTABSolver.hpp"
+
+#endif
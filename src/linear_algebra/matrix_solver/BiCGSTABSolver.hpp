@@ -0,0 +1,145 @@
+/*
+ * author Connor Walsh
+ * file   BiCGSTABSolver.hpp
+ * brief  Implementation file for the BiCGSTABSolver class
+ */
+
+#include <stdexcept>
+
+#include "BiCGSTABSolver.h"
+#include "KrylovKernels.h"
+
+template <class T>
+const size_t BiCGSTABSolver<T>::numVectors;
+
+template <class T>
+MathVector<T> BiCGSTABSolver<T>::operator()
+  (const IMathMatrix<T>& A, const MathVector<T>& b) const
+{
+  return solve(A, b);
+}
+
+template <class T>
+MathVector<T> BiCGSTABSolver<T>::solveFrom(const IMathMatrix<T>& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+MathVector<T> BiCGSTABSolver<T>::solveFrom(MathMatrix<T>&& A,
+    MathVector<T>&& b, const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> BiCGSTABSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b) const
+{
+  MathVector<T> zero(A.cols());
+  return solve(A, b, zero);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> BiCGSTABSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  this->checkDimensions(A, b, initialGuess, "Cannot perform BiCGSTAB on"
+      " matrix and vectors of incorrect dimensions!");
+
+  size_t size = b.size();
+  MathVector<T> x(initialGuess);
+  MathVector<T>& residual = myWorkspace.vector(0, size);
+  MathVector<T>& shadow = myWorkspace.vector(1, size);
+  MathVector<T>& direction = myWorkspace.vector(2, size);
+  MathVector<T>& product = myWorkspace.vector(3, size);
+  MathVector<T>& stabilizer = myWorkspace.vector(4, size);
+  MathVector<T>& preconditionedDirection = myWorkspace.vector(5, size);
+  MathVector<T>& preconditionedResidual = myWorkspace.vector(6, size);
+
+  // Under right preconditioning the steps in x are M^-1 times the steps
+  // the iteration takes, which applyOperator leaves in its scratch vector
+  bool right = this->preconditioned(Side::Right);
+  const MathVector<T>& directionStep = right ? preconditionedDirection :
+    direction;
+  const MathVector<T>& residualStep = right ? preconditionedResidual :
+    residual;
+
+  T threshold = this->myTolerance * this->targetNorm(b, product);
+  size_t maxIterations = this->iterationLimit(size, 2);
+  size_t& iterations = this->myIterations;
+  T residualNorm = this->residualOf(A, x, b, residual, product);
+  iterations = 0;
+
+  shadow.zero();
+  KrylovKernels<T>::axpy(T(1), residual, shadow);
+  T rho = 1;
+  T alpha = 1;
+  T omega = 1;
+
+  while (residualNorm > threshold)
+  {
+    if (iterations == maxIterations)
+    {
+      throw std::domain_error("BiCGSTAB did not converge within the"
+          " iteration limit!");
+    }
+
+    T nextRho = shadow.dotProduct(residual);
+    if (nextRho == T(0))
+    {
+      throw std::domain_error("BiCGSTAB broke down on a residual orthogonal"
+          " to its shadow!");
+    }
+    if (iterations == 0)
+    {
+      direction.zero();
+      KrylovKernels<T>::axpy(T(1), residual, direction);
+    }
+    else
+    {
+      KrylovKernels<T>::axpy(-omega, product, direction);
+      KrylovKernels<T>::xpby(residual, (nextRho / rho) * (alpha / omega),
+          direction);
+    }
+    rho = nextRho;
+    ++iterations;
+
+    this->applyOperator(A, direction, product, preconditionedDirection);
+    T sigma = shadow.dotProduct(product);
+    if (sigma == T(0))
+    {
+      throw std::domain_error("BiCGSTAB broke down on a direction orthogonal"
+          " to its shadow!");
+    }
+    alpha = rho / sigma;
+
+    // The biconjugate gradient step, the residual becoming s
+    KrylovKernels<T>::axpy(-alpha, product, residual);
+    KrylovKernels<T>::axpy(alpha, directionStep, x);
+    residualNorm = residual.getMagnitude();
+    if (residualNorm <= threshold)
+    {
+      break;
+    }
+
+    // The minimal residual step along t = As
+    this->applyOperator(A, residual, stabilizer, preconditionedResidual);
+    T stabilizerNorm = stabilizer.dotProduct(stabilizer);
+    omega = (stabilizerNorm == T(0)) ? T(0) :
+      stabilizer.dotProduct(residual) / stabilizerNorm;
+    if (omega == T(0))
+    {
+      throw std::domain_error("BiCGSTAB broke down on a stabilizing step of"
+          " zero!");
+    }
+    KrylovKernels<T>::axpy(omega, residualStep, x);
+    KrylovKernels<T>::axpy(-omega, stabilizer, residual);
+    residualNorm = residual.getMagnitude();
+  }
+
+  return x;
+}
@@ -0,0 +1,85 @@
+/*
+ * author Connor Walsh
+ * file   ConjugateGradientSolver.h
+ * brief  Class which implements the IMatrixSolver interface using the
+ *        conjugate gradient method
+ */
+
+#ifndef CONJUGATE_GRADIENT_SOLVER_H
+#define CONJUGATE_GRADIENT_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+#include <stdexcept>
+
+#include "IterativeSolver.h"
+#include "KrylovKernels.h"
+#include "SolverWorkspace.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+#include "../math_matrix/MathMatrix.h"
+
+/*
+ * class  ConjugateGradientSolver
+ * brief  This class implements the IMatrixSolver interface with the
+ *        conjugate gradient method for symmetric positive definite matrices.
+ *        Products with A go through KrylovKernels, so packed symmetric and
+ *        sparse matrices use their own kernels
+ */
+template <class T>
+class ConjugateGradientSolver : public IterativeSolver<T>
+{
+  mutable SolverWorkspace<T> myWorkspace;
+
+  public:
+    /*
+     * brief  Creates a solver with a relative residual tolerance and a limit
+     *        on the number of iterations
+     * post   A maxIterations of zero allows twice the number of unknowns
+     */
+    ConjugateGradientSolver(T tolerance = 1e-10, size_t maxIterations = 0)
+      : IterativeSolver<T>(tolerance, maxIterations) {}
+
+    /*
+     * brief  Gives access to the scratch storage reused between solves
+     * post   returns a const reference to the solver's workspace
+     */
+    const SolverWorkspace<T>& workspace() const { return myWorkspace; }
+
+    /*
+    * brief   Solves Ax = b starting from the zero vector
+    * pre     A must be symmetric positive definite and b of size A.rows()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> operator()
+      (const IMathMatrix<T>& A, const MathVector<T>& b) const;
+
+    /*
+    * brief   Solves Ax = b starting from initialGuess
+    * pre     Same as operator() and initialGuess of size A.cols()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> solveFrom(const IMathMatrix<T>& A,
+        const MathVector<T>& b, const MathVector<T>& initialGuess) const;
+    virtual MathVector<T> solveFrom(MathMatrix<T>&& A, MathVector<T>&& b,
+        const MathVector<T>& initialGuess) const;
+
+    /*
+    * brief   Statically dispatched versions of the function operator and
+    *         solveFrom. Matrix may be any concrete IMathMatrix type
+    * pre     Same as operator() and solveFrom
+    * post    returns the vector x in Ax = b. Throws an exception if A is
+    *         found not to be positive definite or the tolerance is not met
+    *         within the iteration limit
+    */
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b) const;
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b,
+        const MathVector<T>& initialGuess) const;
+};
+
+#include "ConjugateGradientSolver.hpp"
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * author Connor Walsh
+ * file   ConjugateGradientSolver.hpp
+ * brief  Implementation file for the ConjugateGradientSolver class
+ */
+
+#include <stdexcept>
+#include <cmath>
+
+#include "ConjugateGradientSolver.h"
+
+template <class T>
+MathVector<T> ConjugateGradientSolver<T>::operator()
+  (const IMathMatrix<T>& A, const MathVector<T>& b) const
+{
+  return solve(A, b);
+}
+
+template <class T>
+MathVector<T> ConjugateGradientSolver<T>::solveFrom(const IMathMatrix<T>& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+MathVector<T> ConjugateGradientSolver<T>::solveFrom(MathMatrix<T>&& A,
+    MathVector<T>&& b, const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> ConjugateGradientSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b) const
+{
+  MathVector<T> zero(A.cols());
+  return solve(A, b, zero);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> ConjugateGradientSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  size_t size = b.size();
+  if (A.rows() != A.cols() || A.rows() != size || initialGuess.size() != size)
+  {
+    throw std::domain_error("Cannot perform ConjugateGradient on matrix and"
+        " vectors of incorrect dimensions!");
+  }
+
+  MathVector<T> x(initialGuess);
+  MathVector<T>& residual = myWorkspace.vector(0, size);
+  MathVector<T>& direction = myWorkspace.vector(1, size);
+  MathVector<T>& product = myWorkspace.vector(2, size);
+
+  KrylovKernels<T>::multiply(A, x, product);
+  for (size_t i = 0; i < size; ++i)
+  {
+    residual[i] = b[i] - product[i];
+    direction[i] = residual[i];
+  }
+
+  T threshold = this->myTolerance * this->myTolerance * b.dotProduct(b);
+  size_t maxIterations = this->iterationLimit(size, 2);
+  size_t& iterations = this->myIterations;
+  T residualNorm = residual.dotProduct(residual);
+  iterations = 0;
+
+  while (residualNorm > threshold)
+  {
+    if (iterations == maxIterations)
+    {
+      throw std::domain_error("ConjugateGradient did not converge within the"
+          " iteration limit!");
+    }
+    ++iterations;
+
+    KrylovKernels<T>::multiply(A, direction, product);
+    T curvature = direction.dotProduct(product);
+    if (!(curvature > 0))
+    {
+      throw std::domain_error("Cannot perform ConjugateGradient on a matrix"
+          " that is not positive definite!");
+    }
+
+    T alpha = residualNorm / curvature;
+    for (size_t i = 0; i < size; ++i)
+    {
+      x[i] += alpha * direction[i];
+      residual[i] -= alpha * product[i];
+    }
+
+    T nextNorm = residual.dotProduct(residual);
+    T beta = nextNorm / residualNorm;
+    residualNorm = nextNorm;
+    for (size_t i = 0; i < size; ++i)
+    {
+      direction[i] = residual[i] + beta * direction[i];
+    }
+  }
+
+  return x;
+}
@@ -0,0 +1,102 @@
+/*
+ * author Connor Walsh
+ * file   GMRESSolver.h
+ * brief  Class which implements the IMatrixSolver interface using the
+ *        restarted generalized minimal residual method
+ */
+
+#ifndef GMRES_SOLVER_H
+#define GMRES_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "KrylovSolver.h"
+#include "SolverWorkspace.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+#include "../math_matrix/MathMatrix.h"
+
+/*
+ * class  GMRESSolver
+ * brief  This class implements the IMatrixSolver interface with GMRES(m)
+ *        for nonsingular matrices that need not be symmetric. Each cycle
+ *        builds an orthonormal basis of up to m Krylov vectors by modified
+ *        Gram-Schmidt and takes the x in their span with the least
+ *        residual, the small least squares problem being kept triangular by
+ *        Givens rotations. The cycle then restarts from the new residual, so
+ *        storage is m + 4 workspace vectors however many iterations are
+ *        taken
+ */
+template <class T>
+class GMRESSolver : public KrylovSolver<T>
+{
+  mutable SolverWorkspace<T> myWorkspace;
+
+  public:
+    typedef typename KrylovSolver<T>::Side Side;
+
+    /*
+     * brief  Creates a solver restarting every restart iterations with a
+     *        relative residual tolerance and a limit on the number of
+     *        iterations
+     * pre    restart must be positive else exception is thrown
+     * post   A maxIterations of zero allows twice the number of unknowns
+     */
+    explicit GMRESSolver(size_t restart = 30, T tolerance = 1e-10,
+        size_t maxIterations = 0);
+
+    /*
+     * brief  Returns the number of iterations between restarts
+     */
+    size_t restart() const { return myRestart; }
+
+    /*
+     * brief  Gives access to the scratch storage reused between solves
+     * post   returns a const reference to the solver's workspace
+     */
+    const SolverWorkspace<T>& workspace() const { return myWorkspace; }
+
+    /*
+    * brief   Solves Ax = b starting from the zero vector
+    * pre     A must be nonsingular and b of size A.rows()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> operator()
+      (const IMathMatrix<T>& A, const MathVector<T>& b) const;
+
+    /*
+    * brief   Solves Ax = b starting from initialGuess
+    * pre     Same as operator() and initialGuess of size A.cols()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> solveFrom(const IMathMatrix<T>& A,
+        const MathVector<T>& b, const MathVector<T>& initialGuess) const;
+    virtual MathVector<T> solveFrom(MathMatrix<T>&& A, MathVector<T>&& b,
+        const MathVector<T>& initialGuess) const;
+
+    /*
+    * brief   Statically dispatched versions of the function operator and
+    *         solveFrom. Matrix may be any concrete IMathMatrix type
+    * pre     Same as operator() and solveFrom
+    * post    returns the vector x in Ax = b. Throws an exception if A is
+    *         found to be singular or the tolerance is not met within the
+    *         iteration limit
+    */
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b) const;
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b,
+        const MathVector<T>& initialGuess) const;
+
+  private:
+    // Workspace slots before the first basis vector
+    static const size_t basisSlot = 3;
+
+    size_t myRestart;
+};
+
+#include "GMRESSolver.hpp"
+
+#endif
@@ -0,0 +1,184 @@
+/*
+ * author Connor Walsh
+ * file   GMRESSolver.hpp
+ * brief  Implementation file for the GMRESSolver class
+ */
+
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "GMRESSolver.h"
+#include "KrylovKernels.h"
+
+template <class T>
+const size_t GMRESSolver<T>::basisSlot;
+
+template <class T>
+GMRESSolver<T>::GMRESSolver(size_t restart, T tolerance, size_t maxIterations)
+  : KrylovSolver<T>(tolerance, maxIterations),
+  myWorkspace(basisSlot + restart + 1), myRestart(restart)
+{
+  if (restart == 0)
+  {
+    throw std::domain_error("Cannot restart GMRES after zero iterations!");
+  }
+}
+
+template <class T>
+MathVector<T> GMRESSolver<T>::operator()
+  (const IMathMatrix<T>& A, const MathVector<T>& b) const
+{
+  return solve(A, b);
+}
+
+template <class T>
+MathVector<T> GMRESSolver<T>::solveFrom(const IMathMatrix<T>& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+MathVector<T> GMRESSolver<T>::solveFrom(MathMatrix<T>&& A,
+    MathVector<T>&& b, const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> GMRESSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b) const
+{
+  MathVector<T> zero(A.cols());
+  return solve(A, b, zero);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> GMRESSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  this->checkDimensions(A, b, initialGuess, "Cannot perform GMRES on matrix"
+      " and vectors of incorrect dimensions!");
+
+  size_t size = b.size();
+  MathVector<T> x(initialGuess);
+  MathVector<T>& residual = myWorkspace.vector(0, size);
+  MathVector<T>& update = myWorkspace.vector(1, size);
+  MathVector<T>& scratch = myWorkspace.vector(2, size);
+
+  size_t restart = std::min(myRestart, size);
+
+  // Columns of the Hessenberg matrix, column k holding rows 0 to k + 1
+  size_t height = restart + 1;
+  std::vector<T> hessenberg(height * restart);
+  std::vector<T> cosines(restart);
+  std::vector<T> sines(restart);
+  std::vector<T> projected(height);
+
+  T threshold = this->myTolerance * this->targetNorm(b, scratch);
+  size_t maxIterations = this->iterationLimit(size, 2);
+  size_t& iterations = this->myIterations;
+  T residualNorm = this->residualOf(A, x, b, residual, scratch);
+  iterations = 0;
+
+  while (residualNorm > threshold)
+  {
+    MathVector<T>& start = myWorkspace.vector(basisSlot, size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      start[i] = residual[i] / residualNorm;
+    }
+    std::fill(projected.begin(), projected.end(), T(0));
+    projected[0] = residualNorm;
+
+    size_t k = 0;
+    while (k < restart)
+    {
+      if (iterations == maxIterations)
+      {
+        throw std::domain_error("GMRES did not converge within the iteration"
+            " limit!");
+      }
+      ++iterations;
+
+      MathVector<T>& next = myWorkspace.vector(basisSlot + k + 1, size);
+      this->applyOperator(A, myWorkspace.vector(basisSlot + k, size), next,
+          scratch);
+
+      T* column = &hessenberg[k * height];
+      for (size_t i = 0; i <= k; ++i)
+      {
+        const MathVector<T>& basis = myWorkspace.vector(basisSlot + i, size);
+        column[i] = next.dotProduct(basis);
+        KrylovKernels<T>::axpy(-column[i], basis, next);
+      }
+      column[k + 1] = next.getMagnitude();
+      if (column[k + 1] != T(0))
+      {
+        next *= T(1) / column[k + 1];
+      }
+
+      for (size_t i = 0; i < k; ++i)
+      {
+        T rotated = cosines[i] * column[i] + sines[i] * column[i + 1];
+        column[i + 1] = cosines[i] * column[i + 1] - sines[i] * column[i];
+        column[i] = rotated;
+      }
+      T radius = std::sqrt(column[k] * column[k] +
+          column[k + 1] * column[k + 1]);
+      if (radius == T(0))
+      {
+        throw std::domain_error("Cannot perform GMRES on a singular"
+            " matrix!");
+      }
+      cosines[k] = column[k] / radius;
+      sines[k] = column[k + 1] / radius;
+      column[k] = radius;
+      column[k + 1] = 0;
+      projected[k + 1] = -sines[k] * projected[k];
+      projected[k] *= cosines[k];
+
+      ++k;
+      if (std::abs(projected[k]) <= threshold)
+      {
+        break;
+      }
+    }
+
+    // Back substitution through the rotated Hessenberg matrix leaves the
+    // coefficients of the basis in projected
+    for (size_t i = k; i-- > 0;)
+    {
+      T sum = projected[i];
+      for (size_t j = i + 1; j < k; ++j)
+      {
+        sum -= hessenberg[j * height + i] * projected[j];
+      }
+      projected[i] = sum / hessenberg[i * height + i];
+    }
+
+    update.zero();
+    for (size_t i = 0; i < k; ++i)
+    {
+      KrylovKernels<T>::axpy(projected[i],
+          myWorkspace.vector(basisSlot + i, size), update);
+    }
+    if (this->preconditioned(Side::Right))
+    {
+      this->precondition(update, scratch);
+      KrylovKernels<T>::axpy(T(1), scratch, x);
+    }
+    else
+    {
+      KrylovKernels<T>::axpy(T(1), update, x);
+    }
+
+    residualNorm = this->residualOf(A, x, b, residual, scratch);
+  }
+
+  return x;
+}
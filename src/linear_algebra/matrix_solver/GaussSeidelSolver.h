@@ -0,0 +1,36 @@
+/*
+ * author Connor Walsh
+ * file   GaussSeidelSolver.h
+ * brief  Class which implements the IMatrixSolver interface using
+ *        Gauss-Seidel iteration
+ */
+
+#ifndef GAUSS_SEIDEL_SOLVER_H
+#define GAUSS_SEIDEL_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "SORSolver.h"
+
+/*
+ * class  GaussSeidelSolver
+ * brief  Gauss-Seidel iteration, which is SOR with a relaxation factor of
+ *        one. Converges for symmetric positive definite and for strictly
+ *        diagonally dominant matrices
+ */
+template <class T>
+class GaussSeidelSolver : public SORSolver<T>
+{
+  public:
+    /*
+     * brief  Creates a solver with a relative residual tolerance and a limit
+     *        on the number of sweeps
+     * post   A maxIterations of zero allows 100 sweeps per unknown
+     */
+    GaussSeidelSolver(T tolerance = 1e-10, size_t maxIterations = 0)
+      : SORSolver<T>(1, tolerance, maxIterations) {}
+};
+
+#endif
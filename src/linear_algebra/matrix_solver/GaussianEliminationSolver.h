@@ -13,6 +13,8 @@
 #include <stdexcept>
 
 #include "IMatrixSolver.h"
+#include "LUFactorization.h"
+#include "SolverWorkspace.h"
 #include "../MathVector.h"
 #include "../math_matrix/IMathMatrix.h"
 #include "../math_matrix/MathMatrix.h"
@@ -26,6 +28,7 @@ template <class T>
 class GaussianEliminationSolver : public IMatrixSolver<T>
 {
   bool usePivot = false;
+  mutable SolverWorkspace<T> myWorkspace;
 
   private:
     /*
@@ -35,13 +38,37 @@ class GaussianEliminationSolver : public IMatrixSolver<T>
      *        T must have the == and < operators defined
      * post   returns the row index of the row to swap with to achieve pivoting
      */
-    static int getMaxColumnValueRow(const IMathMatrix<T>& matrix, int column,
+    template <class Matrix>
+    static int getMaxColumnValueRow(const Matrix& matrix, int column,
         int startRow);
 
+    /*
+     * brief  Exchanges two rows of matrix in place. The MathMatrix overload
+     *        only swaps row pointers
+     * pre    row1 and row2 must be valid rows of matrix
+     * post   matrix has row1 and row2 exchanged
+     */
+    template <class Matrix>
+    static void exchangeRows(Matrix& matrix, int row1, int row2);
+    static void exchangeRows(MathMatrix<T>& matrix, int row1, int row2);
+
+    /*
+     * brief  Gaussian forward elimination in place on A, applying the same
+     *        row operations to b if it is not null and recording the row
+     *        exchanged with each pivot row in pivots if it is not null
+     * pre    A must be square, b must have size A.rows() and pivots must
+     *        have size A.rows()
+     * post   Same as forwardEliminationInPlace
+     */
+    template <class Matrix>
+    static void eliminateInPlace(Matrix& A, MathVector<T>* b,
+        Array<size_t>* pivots, bool partialPivot);
+
   public:
     /*
      * brief  Constructor taking a single parameter
-     * post   Creates a GaussianEliminationSolver that uses pivoting or not
+     * post   Creates a GaussianEliminationSolver that uses partial pivoting,
+     *        choosing the largest magnitude value of each column, or not
      *        based on input parameter
      */
     GaussianEliminationSolver(bool partialPivot = false) : usePivot(partialPivot) {}
@@ -52,6 +79,12 @@ class GaussianEliminationSolver : public IMatrixSolver<T>
      */
     void setUsePivot(bool pivot) { usePivot = pivot; }
 
+    /*
+     * brief  Gives access to the scratch storage reused between solves
+     * post   returns a const reference to the solver's workspace
+     */
+    const SolverWorkspace<T>& workspace() const { return myWorkspace; }
+
     /*
     * brief   This function operator performs the Gaussian elimination on a 
     *         given Matrix and constants. Can also perform partial pivoting
@@ -62,6 +95,61 @@ class GaussianEliminationSolver : public IMatrixSolver<T>
     virtual MathVector<T> operator()
       (const IMathMatrix<T>& A, const MathVector<T>& b) const;
 
+    /*
+    * brief   Statically dispatched version of the function operator. Matrix
+    *         may be any concrete IMathMatrix type so element access is
+    *         resolved at compile time
+    * pre     A and b must be of compatible dimensions
+    * post    returns the vector x in Ax = b
+    */
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b) const;
+
+    /*
+    * brief   Version of solve writing into a caller provided vector. A and b
+    *         are copied into the solver's workspace, whose storage is reused
+    *         by later solves
+    * pre     A and b must be of compatible dimensions
+    * post    x holds the solution to Ax = b
+    */
+    template <class Matrix>
+    void solve(const Matrix& A, const MathVector<T>& b, MathVector<T>& x) const;
+
+    /*
+    * brief   Consuming version of the function operator. The elimination is
+    *         performed directly in the storage of A and b so no copy of the
+    *         system is made
+    * pre     A and b must be of compatible dimensions
+    * post    returns the vector x in Ax = b, A and b are consumed
+    */
+    virtual MathVector<T> operator()(MathMatrix<T>&& A, MathVector<T>&& b) const;
+
+    /*
+    * brief   Solves Ax = b in the caller's storage. Matrix must provide
+    *         mutable element access, e.g. MathMatrix or MathMatrixView.
+    *         With pivoting on, every column brings its largest magnitude
+    *         value onto the diagonal, not only columns that meet a zero
+    *         there as forwardElimination does, so the result can differ
+    *         from it in the last bits. Without pivoting a zero on the
+    *         diagonal throws an exception
+    * pre     A must be square and b must have size A.rows()
+    * post    A holds the eliminated upper triangle with the multipliers below
+    *         the diagonal and b holds the solution x
+    */
+    template <class Matrix>
+    void solveInPlace(Matrix& A, MathVector<T>& b) const;
+
+    /*
+    * brief   Eliminates A once so it can be solved against many b, each
+    *         solve costing O(n^2). Pivots if the solver is set to
+    * pre     A must be square
+    * post    returns an LUFactorization. Throws an exception if a zero
+    *         pivot is encountered
+    */
+    using IMatrixSolver<T>::factor;
+    virtual std::unique_ptr<IMatrixFactorization<T> >
+      factor(MathMatrix<T>&& A) const;
+
     /*
     * brief   This function creates an augmented matrix from a set of coefficients
     *         and a constants MathVector
@@ -69,18 +157,21 @@ class GaussianEliminationSolver : public IMatrixSolver<T>
     * post    returns a matrix of size coefficients.rows() x 
     *         coefficients.columns() + 1 that is an augmented matrix of the inputs
     */
-    static MathMatrix<T> augmentedMatrix(const IMathMatrix<T>& coefficients,
+    template <class Matrix>
+    static MathMatrix<T> augmentedMatrix(const Matrix& coefficients,
         const MathVector<T>& constants);
 
     /*
-    * brief   Performs Gaussian forward elimination in place on an augmented
-    *         IMathMatrix
+    * brief   Performs Gaussian forward elimination on a copy of an
+    *         augmented IMathMatrix. With pivoting on, rows are only
+    *         exchanged when a zero reaches the diagonal
     * pre     augmented must be a matrix that is of format created by
     *         member function augmentedMatrix
     * post    returns a new augmented matrix that is in eschelon form with the
     *         multipliers in the zero places
     */
-    static MathMatrix<T> forwardElimination(const IMathMatrix<T>& augmented,
+    template <class Matrix>
+    static MathMatrix<T> forwardElimination(const Matrix& augmented,
         bool usePartialPivot = false);
 
     /*
@@ -89,7 +180,27 @@ class GaussianEliminationSolver : public IMatrixSolver<T>
     * post    returns a new MathVector with the solutions to the equation Ax=b 
     *         represented by augmented
     */
-    static MathVector<T> backSubstitution(const IMathMatrix<T>& augmented);
+    template <class Matrix>
+    static MathVector<T> backSubstitution(const Matrix& augmented);
+
+    /*
+    * brief   Performs Gaussian forward elimination in place on A, applying
+    *         the same row operations to b
+    * pre     A must be square and b must have size A.rows()
+    * post    A is in echelon form with the multipliers stored below the
+    *         diagonal and b holds the matching transformed constants
+    */
+    template <class Matrix>
+    static void forwardEliminationInPlace(Matrix& A, MathVector<T>& b,
+        bool usePartialPivot = false);
+
+    /*
+    * brief   Back substitution in place on an echelon form matrix
+    * pre     A is in echelon form and b has size A.rows()
+    * post    b holds the solution to the equation Ax=b
+    */
+    template <class Matrix>
+    static void backSubstitutionInPlace(const Matrix& A, MathVector<T>& b);
 };
 
 #include "GaussianEliminationSolver.hpp"
@@ -5,14 +5,19 @@
  */
 
 #include <stdexcept>
+#include <cmath>
+#include <utility>
+#include <algorithm>
 
 #include "GaussianEliminationSolver.h"
 #include "../math_matrix/IMathMatrix.h"
 #include "../math_matrix/MathMatrix.h"
 #include "../MathVector.h"
+#include "../../parallel/ThreadPool.h"
 
 template <class T>
-int GaussianEliminationSolver<T>::getMaxColumnValueRow(const IMathMatrix<T>& matrix,
+template <class Matrix>
+int GaussianEliminationSolver<T>::getMaxColumnValueRow(const Matrix& matrix,
     int column, int startRow)
 {
   T maxSoFar = 0;
@@ -27,10 +32,44 @@ int GaussianEliminationSolver<T>::getMaxColumnValueRow(const IMathMatrix<T>& mat
   return startRow;
 }
 
+template <class T>
+template <class Matrix>
+void GaussianEliminationSolver<T>::exchangeRows(Matrix& matrix, int row1,
+    int row2)
+{
+  for (int col = 0, numCols = matrix.cols(); col < numCols; ++col)
+  {
+    std::swap(matrix(row1, col), matrix(row2, col));
+  }
+}
+
+template <class T>
+void GaussianEliminationSolver<T>::exchangeRows(MathMatrix<T>& matrix,
+    int row1, int row2)
+{
+  matrix.swapRowsInPlace(row1, row2);
+}
+
 template <class T>
 MathVector<T> GaussianEliminationSolver<T>::operator()
   (const IMathMatrix<T>& coefficients,
     const MathVector<T>& constants) const
+{
+  return solve(coefficients, constants);
+}
+
+template <class T>
+MathVector<T> GaussianEliminationSolver<T>::operator()
+  (MathMatrix<T>&& coefficients, MathVector<T>&& constants) const
+{
+  solveInPlace(coefficients, constants);
+  return std::move(constants);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> GaussianEliminationSolver<T>::solve
+  (const Matrix& coefficients, const MathVector<T>& constants) const
 {
   if (coefficients.cols() != constants.size())
   {
@@ -38,17 +77,78 @@ MathVector<T> GaussianEliminationSolver<T>::operator()
         " of incorrect dimensions!");
   }
 
-  MathMatrix<T> augmented = augmentedMatrix(coefficients, constants);
-  augmented = forwardElimination(augmented, usePivot);
-
-  MathVector<T> result = backSubstitution(augmented);
+  MathVector<T> result(constants.size());
+  solve(coefficients, constants, result);
 
   return result;
 }
 
 template <class T>
+template <class Matrix>
+void GaussianEliminationSolver<T>::solve(const Matrix& coefficients,
+    const MathVector<T>& constants, MathVector<T>& x) const
+{
+  if (coefficients.cols() != constants.size())
+  {
+    throw std::domain_error("Cannot perform GaussianElimination on matrix and vector"
+        " of incorrect dimensions!");
+  }
+
+  int numRows = coefficients.rows();
+  int numCols = coefficients.cols();
+  MathMatrix<T>& A = myWorkspace.matrix(numRows, numCols);
+  for (int row = 0; row < numRows; ++row)
+  {
+    for (int col = 0; col < numCols; ++col)
+    {
+      A(row, col) = coefficients(row, col);
+    }
+  }
+
+  x.resize(constants.size());
+  std::copy(constants.begin(), constants.end(), x.begin());
+
+  solveInPlace(A, x);
+}
+
+template <class T>
+template <class Matrix>
+void GaussianEliminationSolver<T>::solveInPlace(Matrix& A, MathVector<T>& b) const
+{
+  if (A.cols() != b.size() || A.rows() != A.cols())
+  {
+    throw std::domain_error("Cannot perform GaussianElimination on matrix and vector"
+        " of incorrect dimensions!");
+  }
+
+  forwardEliminationInPlace(A, b, usePivot);
+  backSubstitutionInPlace(A, b);
+}
+
+template <class T>
+std::unique_ptr<IMatrixFactorization<T> >
+  GaussianEliminationSolver<T>::factor(MathMatrix<T>&& A) const
+{
+  if (A.rows() != A.cols())
+  {
+    throw std::domain_error("Cannot factor a matrix that is not square!");
+  }
+
+  Array<size_t> pivots(A.rows());
+  if (A.rows() > 0)
+  {
+    pivots[A.rows() - 1] = A.rows() - 1;
+  }
+  eliminateInPlace(A, nullptr, &pivots, usePivot);
+
+  return std::unique_ptr<IMatrixFactorization<T> >(
+      new LUFactorization<T>(std::move(A), std::move(pivots)));
+}
+
+template <class T>
+template <class Matrix>
 MathMatrix<T> GaussianEliminationSolver<T>::augmentedMatrix
-    (const IMathMatrix<T>& A, const MathVector<T>& b)
+    (const Matrix& A, const MathVector<T>& b)
 {
   if (A.cols() != b.size())
   {
@@ -76,8 +176,9 @@ MathMatrix<T> GaussianEliminationSolver<T>::augmentedMatrix
 }
 
 template <class T>
+template <class Matrix>
 MathMatrix<T> GaussianEliminationSolver<T>::forwardElimination
-    (const IMathMatrix<T>& augmented, bool partialPivot)
+    (const Matrix& augmented, bool partialPivot)
 {
   MathMatrix<T> result(augmented);
   for (int k = 0, kSize = result.rows() - 1; k < kSize; ++k)
@@ -92,7 +193,7 @@ MathMatrix<T> GaussianEliminationSolver<T>::forwardElimination
           int swapRow = getMaxColumnValueRow(result, k, k);
           if (swapRow != k)
           {
-            result.swapRows(k, swapRow);
+            exchangeRows(result, k, swapRow);
           }
           else
           {
@@ -116,8 +217,9 @@ MathMatrix<T> GaussianEliminationSolver<T>::forwardElimination
 }
 
 template <class T>
+template <class Matrix>
 MathVector<T> GaussianEliminationSolver<T>::backSubstitution
-    (const IMathMatrix<T>& augmented)
+    (const Matrix& augmented)
 {
   MathVector<T> result(augmented.rows());
   T tempSolution;
@@ -139,3 +241,96 @@ MathVector<T> GaussianEliminationSolver<T>::backSubstitution
   return result;
 }
 
+template <class T>
+template <class Matrix>
+void GaussianEliminationSolver<T>::forwardEliminationInPlace(Matrix& A,
+    MathVector<T>& b, bool partialPivot)
+{
+  eliminateInPlace(A, &b, nullptr, partialPivot);
+}
+
+template <class T>
+template <class Matrix>
+void GaussianEliminationSolver<T>::eliminateInPlace(Matrix& A,
+    MathVector<T>* b, Array<size_t>* pivots, bool partialPivot)
+{
+  for (int k = 0, size = A.rows(); k < size - 1; ++k)
+  {
+    if (pivots != nullptr)
+    {
+      (*pivots)[k] = k;
+    }
+
+    if (partialPivot)
+    {
+      // Bring the largest magnitude value of column k onto the diagonal
+      int pivotRow = k;
+      for (int row = k + 1; row < size; ++row)
+      {
+        if (std::abs(A(row, k)) > std::abs(A(pivotRow, k)))
+        {
+          pivotRow = row;
+        }
+      }
+      if (pivotRow != k)
+      {
+        exchangeRows(A, k, pivotRow);
+        if (b != nullptr)
+        {
+          std::swap((*b)[k], (*b)[pivotRow]);
+        }
+        if (pivots != nullptr)
+        {
+          (*pivots)[k] = pivotRow;
+        }
+      }
+    }
+
+    if (A(k, k) == 0)
+    {
+      throw std::domain_error(partialPivot ? "Divide by zero encountered in "
+          "Gaussian Forward Elimination! Unable to Pivot!" : "Divide by zero "
+          "encountered in Gaussian Forward Elimination!");
+    }
+
+    // Rows below the pivot are independent of each other
+    parallelFor(k + 1, size, ThreadPool::grainFor(size - k),
+        [&](size_t firstRow, size_t lastRow)
+        {
+          for (int i = firstRow; i < (int)lastRow; ++i)
+          {
+            double ratio = static_cast<double>(A(i, k)) / A(k, k);
+            for (int j = k + 1; j < size; ++j)
+            {
+              A(i, j) -= static_cast<T>(ratio * A(k, j));
+            }
+            if (b != nullptr)
+            {
+              (*b)[i] -= static_cast<T>(ratio * (*b)[k]);
+            }
+            A(i, k) = static_cast<T>(ratio);
+          }
+        });
+  }
+}
+
+template <class T>
+template <class Matrix>
+void GaussianEliminationSolver<T>::backSubstitutionInPlace(const Matrix& A,
+    MathVector<T>& b)
+{
+  T tempSolution;
+  for (int i = A.rows() - 1; i >= 0; --i)
+  {
+    tempSolution = b[i];
+    for (int j = i + 1, jSize = A.rows(); j < jSize; ++j)
+    {
+      tempSolution -= A(i, j) * b[j];
+    }
+    if (A(i, i) == 0)
+    {
+      throw std::domain_error("Divide by zero encountered in backSubstitution!");
+    }
+    b[i] = static_cast<T>(tempSolution / static_cast<double>(A(i, i)));
+  }
+}
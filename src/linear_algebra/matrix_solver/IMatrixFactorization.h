@@ -0,0 +1,109 @@
+/*
+ * author Connor Walsh
+ * file   IMatrixFactorization.h
+ * brief  This file defines an interface for a factored matrix that can solve
+ *        Ax = b for many b without repeating the factorization
+ */
+
+#ifndef I_MATRIX_FACTORIZATION_H
+#define I_MATRIX_FACTORIZATION_H
+
+#pragma once
+
+#include <stddef.h>
+#include <stdexcept>
+#include <utility>
+
+#include "../MathVector.h"
+#include "../math_matrix/MathMatrix.h"
+
+/*
+ * class  IMatrixFactorization
+ * brief  Polymorphic interface for the result of IMatrixSolver::factor. All
+ *        of the work that only depends on A is done when the factorization
+ *        is created, so each solve only costs the substitution steps
+ */
+template <class T>
+class IMatrixFactorization
+{
+  public:
+    virtual ~IMatrixFactorization() {}
+
+    /*
+     * brief  Returns the number of rows of the factored matrix
+     * post   b passed to solve must have this size
+     */
+    virtual size_t rows() const = 0;
+
+    /*
+     * brief  Returns the number of columns of the factored matrix
+     * post   Solutions returned by solve have this size
+     */
+    virtual size_t cols() const = 0;
+
+    /*
+     * brief  Solves Ax = b in the storage of b
+     * pre    b must have size rows() else exception is thrown
+     * post   b holds the solution x and has size cols()
+     */
+    virtual void solveInPlace(MathVector<T>& b) const = 0;
+
+    /*
+     * brief  Solves Ax = b
+     * pre    b must have size rows() else exception is thrown
+     * post   returns the solution x
+     */
+    MathVector<T> solve(const MathVector<T>& b) const
+    {
+      MathVector<T> x(b);
+      solveInPlace(x);
+      return x;
+    }
+
+    /*
+     * brief  Solves AX = B for every column of B in the storage of B.
+     *        Factorizations override this to substitute all columns at once
+     *        rather than one vector at a time
+     * pre    B must have rows() rows else exception is thrown
+     * post   B holds X and has size [cols(), B.cols()]
+     */
+    virtual void solveInPlace(MathMatrix<T>& B) const
+    {
+      if (B.rows() != rows())
+      {
+        throw std::domain_error("Cannot solve factorization with a matrix"
+            " of incorrect dimensions!");
+      }
+
+      MathMatrix<T> X(cols(), B.cols());
+      MathVector<T> column(rows());
+      for (size_t col = 0; col < B.cols(); ++col)
+      {
+        column.resize(rows());
+        for (size_t row = 0; row < rows(); ++row)
+        {
+          column[row] = B(row, col);
+        }
+        solveInPlace(column);
+        for (size_t row = 0; row < cols(); ++row)
+        {
+          X(row, col) = column[row];
+        }
+      }
+      B = std::move(X);
+    }
+
+    /*
+     * brief  Solves AX = B for every column of B
+     * pre    B must have rows() rows else exception is thrown
+     * post   returns X
+     */
+    MathMatrix<T> solve(const MathMatrix<T>& B) const
+    {
+      MathMatrix<T> X(B);
+      solveInPlace(X);
+      return X;
+    }
+};
+
+#endif
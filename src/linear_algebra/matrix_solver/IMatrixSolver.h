@@ -1,7 +1,7 @@
 /*
  * author Connor Walsh
- * file   IMathMatrixSolver.h 
- * brief  This file defines an interface used to solve matrix equations of 
+ * file   IMathMatrixSolver.h
+ * brief  This file defines an interface used to solve matrix equations of
  *        the form Ax = b.
  */
 
@@ -10,16 +10,158 @@
 
 #pragma once
 
+#include <memory>
+#include <utility>
+#include <stdexcept>
+
+#include "IMatrixFactorization.h"
 #include "../MathVector.h"
 #include "../math_matrix/IMathMatrix.h"
+#include "../math_matrix/MathMatrix.h"
 
+/*
+ * class  IMatrixSolver
+ * brief  Polymorphic interface for solving Ax = b. Concrete solvers also
+ *        provide a templated solve() taking the concrete matrix type so the
+ *        arithmetic can be dispatched at compile time; operator() is the thin
+ *        virtual adapter onto solve() for IMathMatrix.
+ *        Although solving is const, a solver keeps state between calls in
+ *        mutable members: its SolverWorkspace, iteration counts and reports,
+ *        and cached analyses. A solver instance must therefore not be used
+ *        from two threads at once; give each thread its own solver. The
+ *        factorizations a solver returns hold no such state and may be
+ *        solved against from any number of threads
+ */
 template <class T>
 class IMatrixSolver
 {
   public:
+    virtual ~IMatrixSolver() {}
+
     virtual MathVector<T> operator()
       (const IMathMatrix<T>& A, const MathVector<T>& b) const = 0;
+
+    /*
+     * brief  Consuming overload for callers that build A and b only to solve
+     *        them. Solvers override this to work directly in the storage of
+     *        A and b instead of copying them
+     * post   returns the vector x in Ax = b, A and b are left in a valid but
+     *        unspecified state
+     */
+    virtual MathVector<T> operator()(MathMatrix<T>&& A, MathVector<T>&& b) const
+    {
+      return (*this)(static_cast<const IMathMatrix<T>&>(A),
+          static_cast<const MathVector<T>&>(b));
+    }
+
+    /*
+     * brief  Solves Ax = b starting from initialGuess. Iterative solvers
+     *        override this to start iterating at the guess, so a guess close
+     *        to x, e.g. the solution of a slightly different problem, saves
+     *        most of the iterations. Direct solvers ignore the guess
+     * pre    initialGuess must have size A.cols() for solvers that use it
+     * post   returns the vector x in Ax = b, the consuming overload leaves A
+     *        and b in a valid but unspecified state
+     */
+    virtual MathVector<T> solveFrom(const IMathMatrix<T>& A,
+        const MathVector<T>& b, const MathVector<T>& initialGuess) const
+    {
+      static_cast<void>(initialGuess);
+      return (*this)(A, b);
+    }
+    virtual MathVector<T> solveFrom(MathMatrix<T>&& A, MathVector<T>&& b,
+        const MathVector<T>& initialGuess) const
+    {
+      static_cast<void>(initialGuess);
+      return (*this)(std::move(A), std::move(b));
+    }
+
+    /*
+     * brief  Forwards to the virtual function operator. Gives code that is
+     *        templated on the solver type a single spelling that works for
+     *        both this interface and the concrete solvers
+     * post   returns the vector x in Ax = b
+     */
+    MathVector<T> solve(const IMathMatrix<T>& A, const MathVector<T>& b) const
+    {
+      return (*this)(A, b);
+    }
+
+    /*
+     * brief  Factors A once so it can be solved against many b. Solvers
+     *        without a factorization of their own return one that keeps A
+     *        and calls this solver for every b, so the solver must outlive
+     *        the factorization
+     * pre    A must be of dimensions the solver accepts
+     * post   returns the factorization, the consuming overload leaves A in
+     *        a valid but unspecified state
+     */
+    virtual std::unique_ptr<IMatrixFactorization<T> >
+      factor(MathMatrix<T>&& A) const;
+    std::unique_ptr<IMatrixFactorization<T> >
+      factor(const IMathMatrix<T>& A) const
+    {
+      return factor(MathMatrix<T>(A));
+    }
+
+    /*
+     * brief  Solves AX = B for all columns of B at once. A is factored a
+     *        single time and the substitution steps run over every column
+     *        together
+     * pre    B must have A.rows() rows
+     * post   returns X, the consuming overload reusing the storage of B
+     */
+    MathMatrix<T> solveMultiple(const IMathMatrix<T>& A,
+        const MathMatrix<T>& B) const
+    {
+      return factor(A)->solve(B);
+    }
+    MathMatrix<T> solveMultiple(MathMatrix<T>&& A, MathMatrix<T>&& B) const
+    {
+      factor(std::move(A))->solveInPlace(B);
+      return std::move(B);
+    }
 };
 
+/*
+ * class  StoredMatrixFactorization
+ * brief  Default factorization which keeps a copy of A and runs the full
+ *        solver for each right hand side
+ */
+template <class T>
+class StoredMatrixFactorization : public IMatrixFactorization<T>
+{
+  public:
+    StoredMatrixFactorization(MathMatrix<T>&& A, const IMatrixSolver<T>& solver)
+      : myMatrix(std::move(A)), mySolver(solver) {}
+
+    virtual size_t rows() const { return myMatrix.rows(); }
+    virtual size_t cols() const { return myMatrix.cols(); }
+
+    using IMatrixFactorization<T>::solveInPlace;
+
+    virtual void solveInPlace(MathVector<T>& b) const
+    {
+      if (b.size() != myMatrix.rows())
+      {
+        throw std::domain_error("Cannot solve factorization with a vector"
+            " of incorrect dimensions!");
+      }
+      b = mySolver(myMatrix, b);
+    }
+
+  private:
+    MathMatrix<T> myMatrix;
+    const IMatrixSolver<T>& mySolver;
+};
+
+template <class T>
+std::unique_ptr<IMatrixFactorization<T> >
+  IMatrixSolver<T>::factor(MathMatrix<T>&& A) const
+{
+  return std::unique_ptr<IMatrixFactorization<T> >(
+      new StoredMatrixFactorization<T>(std::move(A), *this));
+}
+
 #endif
 
@@ -0,0 +1,41 @@
+/*
+ * author Connor Walsh
+ * file   IPreconditioner.h
+ * brief  This file defines an interface for approximate inverses used to
+ *        speed up the Krylov solvers
+ */
+
+#ifndef I_PRECONDITIONER_H
+#define I_PRECONDITIONER_H
+
+#pragma once
+
+#include "../MathVector.h"
+
+/*
+ * class  IPreconditioner
+ * brief  Polymorphic interface for a matrix M close to A whose systems are
+ *        cheap to solve. A Krylov solver applies M^-1 once or twice per
+ *        iteration, so the better M^-1 approximates A^-1 the fewer
+ *        iterations it takes
+ */
+template <class T>
+class IPreconditioner
+{
+  public:
+    virtual ~IPreconditioner() {}
+
+    /*
+     * brief  Returns the number of unknowns M acts on
+     */
+    virtual size_t size() const = 0;
+
+    /*
+     * brief  Solves Mz = r
+     * pre    r must have size size() else exception is thrown
+     * post   z holds M^-1 r, z may not be r
+     */
+    virtual void apply(const MathVector<T>& r, MathVector<T>& z) const = 0;
+};
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * author Connor Walsh
+ * file   IterativeSolver.h
+ * brief  This file defines the stopping criteria shared by the iterative
+ *        implementations of IMatrixSolver
+ */
+
+#ifndef ITERATIVE_SOLVER_H
+#define ITERATIVE_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "IMatrixSolver.h"
+
+/*
+ * class  GridSolver
+ * brief  Base of the solvers that work directly on the DirichletPoisson grid
+ *        rather than on a matrix, so have no IMatrixSolver interface
+ */
+struct GridSolver {};
+
+/*
+ * class  IterativeSolver
+ * brief  Base of the solvers that improve a guess until the residual norm is
+ *        at most tolerance times the norm of b. The number of iterations of
+ *        the last solve is kept. A maxIterations of zero lets each solver
+ *        pick a limit proportional to the number of unknowns. Interface is
+ *        the interface the solver implements
+ */
+template <class T, class Interface = IMatrixSolver<T> >
+class IterativeSolver : public Interface
+{
+  public:
+    IterativeSolver(T tolerance, size_t maxIterations)
+      : myTolerance(tolerance), myMaxIterations(maxIterations),
+      myIterations(0) {}
+
+    /*
+     * brief  Functions to change the stopping criteria
+     * post   Later solves use the new tolerance or iteration limit
+     */
+    void setTolerance(T tolerance) { myTolerance = tolerance; }
+    void setMaxIterations(size_t maxIterations) { myMaxIterations = maxIterations; }
+
+    /*
+     * brief  Returns the relative residual tolerance
+     */
+    T tolerance() const { return myTolerance; }
+
+    /*
+     * brief  Returns the number of iterations the last solve took
+     * post   Returns zero if the initial guess already met the tolerance
+     */
+    size_t iterations() const { return myIterations; }
+
+  protected:
+    /*
+     * brief  Returns the iteration limit for a system of size unknowns
+     * post   Returns maxIterations if set, else perUnknown * size
+     */
+    size_t iterationLimit(size_t size, size_t perUnknown) const
+    {
+      return (myMaxIterations == 0) ? perUnknown * size : myMaxIterations;
+    }
+
+    T myTolerance;
+    size_t myMaxIterations;
+    mutable size_t myIterations;
+};
+
+#endif
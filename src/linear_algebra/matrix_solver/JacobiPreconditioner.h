@@ -0,0 +1,47 @@
+/*
+ * author Connor Walsh
+ * file   JacobiPreconditioner.h
+ * brief  Class which implements the IPreconditioner interface with the
+ *        diagonal of A
+ */
+
+#ifndef JACOBI_PRECONDITIONER_H
+#define JACOBI_PRECONDITIONER_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "IPreconditioner.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+
+/*
+ * class  JacobiPreconditioner
+ * brief  This class implements the IPreconditioner interface with M the
+ *        diagonal of A. It costs one multiply per unknown to apply and
+ *        evens out rows of very different scale, as varying coefficients
+ *        produce
+ */
+template <class T>
+class JacobiPreconditioner : public IPreconditioner<T>
+{
+  public:
+    /*
+     * brief  Creates the preconditioner from the diagonal of A
+     * pre    A must be square with no zero on its diagonal else exception
+     *        is thrown
+     */
+    explicit JacobiPreconditioner(const IMathMatrix<T>& A);
+
+    virtual size_t size() const { return myInverseDiagonal.size(); }
+
+    virtual void apply(const MathVector<T>& r, MathVector<T>& z) const;
+
+  private:
+    MathVector<T> myInverseDiagonal;
+};
+
+#include "JacobiPreconditioner.hpp"
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * author Connor Walsh
+ * file   JacobiPreconditioner.hpp
+ * brief  Implementation file for the JacobiPreconditioner class
+ */
+
+#include <stdexcept>
+
+#include "JacobiPreconditioner.h"
+#include "../../parallel/ThreadPool.h"
+
+template <class T>
+JacobiPreconditioner<T>::JacobiPreconditioner(const IMathMatrix<T>& A)
+  : myInverseDiagonal(A.rows())
+{
+  if (A.rows() != A.cols())
+  {
+    throw std::domain_error("Cannot precondition with the diagonal of a"
+        " matrix that is not square!");
+  }
+
+  for (size_t i = 0; i < A.rows(); ++i)
+  {
+    T diagonal = A(i, i);
+    if (diagonal == T(0))
+    {
+      throw std::domain_error("Cannot precondition with a diagonal that has"
+          " a zero!");
+    }
+    myInverseDiagonal[i] = T(1) / diagonal;
+  }
+}
+
+template <class T>
+void JacobiPreconditioner<T>::apply(const MathVector<T>& r,
+    MathVector<T>& z) const
+{
+  if (r.size() != size())
+  {
+    throw std::domain_error("Cannot precondition a vector of incorrect"
+        " dimensions!");
+  }
+
+  z.resize(r.size());
+  const T* in = r.begin();
+  const T* scale = myInverseDiagonal.begin();
+  T* out = z.begin();
+  parallelFor(0, r.size(), ThreadPool::grainFor(1),
+      [=](size_t first, size_t last)
+      {
+        for (size_t i = first; i < last; ++i)
+        {
+          out[i] = scale[i] * in[i];
+        }
+      });
+}
@@ -0,0 +1,86 @@
+/*
+ * author Connor Walsh
+ * file   JacobiSolver.h
+ * brief  Class which implements the IMatrixSolver interface using Jacobi
+ *        iteration
+ */
+
+#ifndef JACOBI_SOLVER_H
+#define JACOBI_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+#include <stdexcept>
+
+#include "IterativeSolver.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+#include "../math_matrix/MathMatrix.h"
+
+/*
+ * class  JacobiSolver
+ * brief  This class implements the IMatrixSolver interface with Jacobi
+ *        iteration, which converges for strictly diagonally dominant
+ *        matrices among others. Every unknown of a sweep is updated from the
+ *        previous iterate only, so the rows of a sweep run in parallel
+ */
+template <class T>
+class JacobiSolver : public IterativeSolver<T>
+{
+  private:
+    /*
+     * brief  Performs one Jacobi sweep from x into next
+     * pre    A is square with a nonzero diagonal, all vectors of its size
+     * post   next holds the new iterate, returns the squared norm of the
+     *        residual b - Ax of the old iterate
+     */
+    template <class Matrix>
+    static T sweep(const Matrix& A, const MathVector<T>& b,
+        const MathVector<T>& x, MathVector<T>& next);
+
+  public:
+    /*
+     * brief  Creates a solver with a relative residual tolerance and a limit
+     *        on the number of sweeps
+     * post   A maxIterations of zero allows 100 sweeps per unknown
+     */
+    JacobiSolver(T tolerance = 1e-10, size_t maxIterations = 0)
+      : IterativeSolver<T>(tolerance, maxIterations) {}
+
+    /*
+    * brief   Solves Ax = b starting from the zero vector
+    * pre     A must be square with a nonzero diagonal and b of size A.rows()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> operator()
+      (const IMathMatrix<T>& A, const MathVector<T>& b) const;
+
+    /*
+    * brief   Solves Ax = b starting from initialGuess
+    * pre     Same as operator() and initialGuess of size A.cols()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> solveFrom(const IMathMatrix<T>& A,
+        const MathVector<T>& b, const MathVector<T>& initialGuess) const;
+    virtual MathVector<T> solveFrom(MathMatrix<T>&& A, MathVector<T>&& b,
+        const MathVector<T>& initialGuess) const;
+
+    /*
+    * brief   Statically dispatched versions of the function operator and
+    *         solveFrom. Matrix may be any concrete IMathMatrix type
+    * pre     Same as operator() and solveFrom
+    * post    returns the vector x in Ax = b. Throws an exception if the
+    *         diagonal has a zero or the tolerance is not met within the
+    *         iteration limit
+    */
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b) const;
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b,
+        const MathVector<T>& initialGuess) const;
+};
+
+#include "JacobiSolver.hpp"
+
+#endif
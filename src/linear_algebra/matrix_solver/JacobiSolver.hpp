@@ -0,0 +1,110 @@
+/*
+ * author Connor Walsh
+ * file   JacobiSolver.hpp
+ * brief  Implementation file for the JacobiSolver class
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "JacobiSolver.h"
+#include "../../parallel/ThreadPool.h"
+
+template <class T>
+template <class Matrix>
+T JacobiSolver<T>::sweep(const Matrix& A, const MathVector<T>& b,
+    const MathVector<T>& x, MathVector<T>& next)
+{
+  size_t size = b.size();
+
+  // Blocks depend only on the size, so the residual is the same for any
+  // number of threads
+  return parallelReduce(0, size, ThreadPool::grainFor(size), T(0),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        T squares = 0;
+        for (size_t i = firstRow; i < lastRow; ++i)
+        {
+          T residual = b[i];
+          for (size_t j = 0; j < size; ++j)
+          {
+            residual -= A(i, j) * x[j];
+          }
+          next[i] = x[i] + residual / A(i, i);
+          squares += residual * residual;
+        }
+        return squares;
+      },
+      [](T lhs, T rhs) { return lhs + rhs; });
+}
+
+template <class T>
+MathVector<T> JacobiSolver<T>::operator()
+  (const IMathMatrix<T>& A, const MathVector<T>& b) const
+{
+  return solve(A, b);
+}
+
+template <class T>
+MathVector<T> JacobiSolver<T>::solveFrom(const IMathMatrix<T>& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+MathVector<T> JacobiSolver<T>::solveFrom(MathMatrix<T>&& A,
+    MathVector<T>&& b, const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> JacobiSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b) const
+{
+  MathVector<T> zero(A.cols());
+  return solve(A, b, zero);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> JacobiSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  size_t size = b.size();
+  if (A.rows() != A.cols() || A.rows() != size || initialGuess.size() != size)
+  {
+    throw std::domain_error("Cannot perform Jacobi iteration on matrix and"
+        " vectors of incorrect dimensions!");
+  }
+  for (size_t i = 0; i < size; ++i)
+  {
+    if (A(i, i) == 0)
+    {
+      throw std::domain_error("Cannot perform Jacobi iteration on a matrix"
+          " with a zero on the diagonal!");
+    }
+  }
+
+  MathVector<T> x(initialGuess);
+  MathVector<T> next(size);
+  T threshold = this->myTolerance * this->myTolerance * b.dotProduct(b);
+  size_t maxIterations = this->iterationLimit(size, 100);
+  size_t& iterations = this->myIterations;
+  iterations = 0;
+
+  while (sweep(A, b, x, next) > threshold)
+  {
+    if (iterations == maxIterations)
+    {
+      throw std::domain_error("Jacobi iteration did not converge within the"
+          " iteration limit!");
+    }
+    ++iterations;
+    std::swap(x, next);
+  }
+
+  return x;
+}
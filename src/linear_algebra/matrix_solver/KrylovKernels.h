@@ -0,0 +1,114 @@
+/*
+ * author Connor Walsh
+ * file   KrylovKernels.h
+ * brief  Parallel matrix and vector kernels shared by the Krylov solvers
+ */
+
+#ifndef KRYLOV_KERNELS_H
+#define KRYLOV_KERNELS_H
+
+#pragma once
+
+#include <stddef.h>
+#include <utility>
+
+#include "../MathVector.h"
+#include "../math_matrix/SymmetricMathMatrix.h"
+#include "../math_matrix/SparseMathMatrix.h"
+
+/*
+ * class  KrylovKernels
+ * brief  This class holds the operations a Krylov iteration spends its time
+ *        in besides the dot products of MathVector. Every kernel splits its
+ *        work into fixed blocks on the ThreadPool, each element being
+ *        written by one thread, so results are the same for any thread count
+ */
+template <class T>
+class KrylovKernels
+{
+  public:
+    /*
+     * brief  Computes y = Ax one row at a time, in parallel over rows
+     * pre    x has size A.cols() and y has size A.rows()
+     * post   y holds Ax
+     */
+    template <class Matrix>
+    static void multiply(const Matrix& A, const MathVector<T>& x,
+        MathVector<T>& y);
+
+    /*
+     * brief  Uses the packed symmetric kernel, which only reads the stored
+     *        triangle of A
+     */
+    static void multiply(const SymmetricMathMatrix<T>& A,
+        const MathVector<T>& x, MathVector<T>& y)
+    {
+      A.multiply(x, y);
+    }
+
+    /*
+     * brief  Uses the compressed row kernel, which only reads the stored
+     *        entries of A
+     */
+    static void multiply(const SparseMathMatrix<T>& A,
+        const MathVector<T>& x, MathVector<T>& y)
+    {
+      A.multiply(x, y);
+    }
+
+    /*
+     * brief  Computes y = Ax and returns r.r and x.r, all in one parallel
+     *        pass over the rows of A, so the two reductions cost no
+     *        synchronization beyond that of the product
+     * pre    Same as multiply and r of size A.rows()
+     * post   y holds Ax, returns (r.r, x.r)
+     */
+    template <class Matrix>
+    static std::pair<T, T> multiplyWithDots(const Matrix& A,
+        const MathVector<T>& x, MathVector<T>& y, const MathVector<T>& r);
+
+    /*
+     * brief  Computes r = b - Ax
+     * pre    Same as multiply and b of size A.rows()
+     * post   r holds the residual of x
+     */
+    template <class Matrix>
+    static void residual(const Matrix& A, const MathVector<T>& x,
+        const MathVector<T>& b, MathVector<T>& r);
+
+    /*
+     * brief  Computes y += alpha x
+     * pre    x and y have the same size
+     */
+    static void axpy(T alpha, const MathVector<T>& x, MathVector<T>& y);
+
+    /*
+     * brief  Computes y = x + beta y
+     * pre    x and y have the same size
+     */
+    static void xpby(const MathVector<T>& x, T beta, MathVector<T>& y);
+
+  private:
+    /*
+     * brief  Computes rows [firstRow, lastRow) of y = Ax
+     */
+    template <class Matrix>
+    static void multiplyRows(const Matrix& A, const T* x, T* y,
+        size_t firstRow, size_t lastRow);
+    static void multiplyRows(const SparseMathMatrix<T>& A, const T* x, T* y,
+        size_t firstRow, size_t lastRow);
+
+    /*
+     * brief  Returns the work of one row of a product with A
+     */
+    template <class Matrix>
+    static size_t rowWork(const Matrix& A) { return A.cols(); }
+    static size_t rowWork(const SparseMathMatrix<T>& A)
+    {
+      return A.nonZeros() / (A.rows() + 1) + 1;
+    }
+};
+
+#include "KrylovKernels.hpp"
+
+#endif
@@ -0,0 +1,135 @@
+/*
+ * author Connor Walsh
+ * file   KrylovKernels.hpp
+ * brief  Implementation file for the KrylovKernels class
+ */
+
+#include <utility>
+
+#include "KrylovKernels.h"
+#include "../../parallel/ThreadPool.h"
+
+template <class T>
+template <class Matrix>
+void KrylovKernels<T>::multiply(const Matrix& A, const MathVector<T>& x,
+    MathVector<T>& y)
+{
+  const T* in = x.begin();
+  T* out = y.begin();
+  parallelFor(0, A.rows(), ThreadPool::grainFor(rowWork(A)),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        multiplyRows(A, in, out, firstRow, lastRow);
+      });
+}
+
+template <class T>
+template <class Matrix>
+std::pair<T, T> KrylovKernels<T>::multiplyWithDots(const Matrix& A,
+    const MathVector<T>& x, MathVector<T>& y, const MathVector<T>& r)
+{
+  const T* in = x.begin();
+  const T* other = r.begin();
+  T* out = y.begin();
+  return parallelReduce(0, A.rows(), ThreadPool::grainFor(rowWork(A)),
+      std::pair<T, T>(0, 0),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        multiplyRows(A, in, out, firstRow, lastRow);
+        std::pair<T, T> dots(0, 0);
+        for (size_t i = firstRow; i < lastRow; ++i)
+        {
+          dots.first += other[i] * other[i];
+          dots.second += in[i] * other[i];
+        }
+        return dots;
+      },
+      [](const std::pair<T, T>& lhs, const std::pair<T, T>& rhs)
+      {
+        return std::pair<T, T>(lhs.first + rhs.first,
+            lhs.second + rhs.second);
+      });
+}
+
+template <class T>
+template <class Matrix>
+void KrylovKernels<T>::multiplyRows(const Matrix& A, const T* x, T* y,
+    size_t firstRow, size_t lastRow)
+{
+  size_t numCols = A.cols();
+  for (size_t i = firstRow; i < lastRow; ++i)
+  {
+    T sum = 0;
+    for (size_t j = 0; j < numCols; ++j)
+    {
+      sum += A(i, j) * x[j];
+    }
+    y[i] = sum;
+  }
+}
+
+template <class T>
+void KrylovKernels<T>::multiplyRows(const SparseMathMatrix<T>& A,
+    const T* x, T* y, size_t firstRow, size_t lastRow)
+{
+  const size_t* rowStarts = A.rowStarts().data();
+  const size_t* columns = A.columnIndices().data();
+  const T* values = A.values().begin();
+  for (size_t i = firstRow; i < lastRow; ++i)
+  {
+    T sum = 0;
+    for (size_t k = rowStarts[i]; k < rowStarts[i + 1]; ++k)
+    {
+      sum += values[k] * x[columns[k]];
+    }
+    y[i] = sum;
+  }
+}
+
+template <class T>
+template <class Matrix>
+void KrylovKernels<T>::residual(const Matrix& A, const MathVector<T>& x,
+    const MathVector<T>& b, MathVector<T>& r)
+{
+  multiply(A, x, r);
+  T* out = r.begin();
+  const T* source = b.begin();
+  parallelFor(0, r.size(), ThreadPool::grainFor(1),
+      [=](size_t first, size_t last)
+      {
+        for (size_t i = first; i < last; ++i)
+        {
+          out[i] = source[i] - out[i];
+        }
+      });
+}
+
+template <class T>
+void KrylovKernels<T>::axpy(T alpha, const MathVector<T>& x, MathVector<T>& y)
+{
+  const T* in = x.begin();
+  T* out = y.begin();
+  parallelFor(0, y.size(), ThreadPool::grainFor(1),
+      [=](size_t first, size_t last)
+      {
+        for (size_t i = first; i < last; ++i)
+        {
+          out[i] += alpha * in[i];
+        }
+      });
+}
+
+template <class T>
+void KrylovKernels<T>::xpby(const MathVector<T>& x, T beta, MathVector<T>& y)
+{
+  const T* in = x.begin();
+  T* out = y.begin();
+  parallelFor(0, y.size(), ThreadPool::grainFor(1),
+      [=](size_t first, size_t last)
+      {
+        for (size_t i = first; i < last; ++i)
+        {
+          out[i] = in[i] + beta * out[i];
+        }
+      });
+}
@@ -0,0 +1,173 @@
+/*
+ * author Connor Walsh
+ * file   KrylovSolver.h
+ * brief  This file defines the preconditioning shared by the Krylov
+ *        implementations of IMatrixSolver for nonsymmetric matrices
+ */
+
+#ifndef KRYLOV_SOLVER_H
+#define KRYLOV_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+#include <stdexcept>
+
+#include "IterativeSolver.h"
+#include "IPreconditioner.h"
+#include "KrylovKernels.h"
+#include "../MathVector.h"
+
+/*
+ * class  KrylovSolver
+ * brief  Base of the iterative solvers that may be preconditioned on either
+ *        side. Left preconditioning solves M^-1 Ax = M^-1 b and so measures
+ *        the residual M^-1 (b - Ax) against M^-1 b. Right preconditioning
+ *        solves AM^-1 u = b with x = M^-1 u, which leaves the residual, and
+ *        so the stopping test, that of the original system. The
+ *        preconditioner is held by reference and must outlive its use
+ */
+template <class T>
+class KrylovSolver : public IterativeSolver<T>
+{
+  public:
+    enum class Side
+    {
+      Left, Right
+    };
+
+    KrylovSolver(T tolerance, size_t maxIterations)
+      : IterativeSolver<T>(tolerance, maxIterations),
+      myPreconditioner(nullptr), mySide(Side::Right) {}
+
+    /*
+     * brief  Functions to change the preconditioner
+     * post   Later solves apply preconditioner on side, or none at all
+     */
+    void setPreconditioner(const IPreconditioner<T>& preconditioner,
+        Side side = Side::Right)
+    {
+      myPreconditioner = &preconditioner;
+      mySide = side;
+    }
+    void clearPreconditioner() { myPreconditioner = nullptr; }
+
+    /*
+     * brief  Returns the preconditioner, null if there is none
+     */
+    const IPreconditioner<T>* preconditioner() const { return myPreconditioner; }
+
+    /*
+     * brief  Returns the side the preconditioner is applied on
+     */
+    Side side() const { return mySide; }
+
+  protected:
+    /*
+     * brief  Returns true if a preconditioner is set on side
+     */
+    bool preconditioned(Side side) const
+    {
+      return myPreconditioner != nullptr && mySide == side;
+    }
+
+    /*
+     * brief  Computes z = M^-1 r, or copies r without a preconditioner
+     * pre    r must have the size of the preconditioner and z the size of r
+     *        else exception is thrown
+     */
+    void precondition(const MathVector<T>& r, MathVector<T>& z) const
+    {
+      if (myPreconditioner == nullptr)
+      {
+        z.zero();
+        KrylovKernels<T>::axpy(T(1), r, z);
+        return;
+      }
+      myPreconditioner->apply(r, z);
+    }
+
+    /*
+     * brief  Computes y = AM^-1 x, M^-1 Ax or Ax for right, left or no
+     *        preconditioning, using scratch for the intermediate vector
+     * pre    x, y and scratch have size A.rows() and are distinct
+     */
+    template <class Matrix>
+    void applyOperator(const Matrix& A, const MathVector<T>& x,
+        MathVector<T>& y, MathVector<T>& scratch) const
+    {
+      if (preconditioned(Side::Right))
+      {
+        precondition(x, scratch);
+        KrylovKernels<T>::multiply(A, scratch, y);
+      }
+      else if (preconditioned(Side::Left))
+      {
+        KrylovKernels<T>::multiply(A, x, scratch);
+        precondition(scratch, y);
+      }
+      else
+      {
+        KrylovKernels<T>::multiply(A, x, y);
+      }
+    }
+
+    /*
+     * brief  Computes the residual r = b - Ax the iteration works with,
+     *        M^-1 (b - Ax) under left preconditioning
+     * pre    Same as applyOperator
+     * post   returns the norm of r
+     */
+    template <class Matrix>
+    T residualOf(const Matrix& A, const MathVector<T>& x,
+        const MathVector<T>& b, MathVector<T>& r, MathVector<T>& scratch) const
+    {
+      if (preconditioned(Side::Left))
+      {
+        KrylovKernels<T>::residual(A, x, b, scratch);
+        precondition(scratch, r);
+      }
+      else
+      {
+        KrylovKernels<T>::residual(A, x, b, r);
+      }
+      return r.getMagnitude();
+    }
+
+    /*
+     * brief  Returns the norm the residual is measured against, that of
+     *        M^-1 b under left preconditioning and of b otherwise
+     */
+    T targetNorm(const MathVector<T>& b, MathVector<T>& scratch) const
+    {
+      if (preconditioned(Side::Left))
+      {
+        precondition(b, scratch);
+        return scratch.getMagnitude();
+      }
+      return b.getMagnitude();
+    }
+
+    /*
+     * brief  Checks the dimensions shared by every solve
+     * pre    A must be square, b and initialGuess of size A.rows() and the
+     *        preconditioner of the same size else exception is thrown
+     */
+    template <class Matrix>
+    void checkDimensions(const Matrix& A, const MathVector<T>& b,
+        const MathVector<T>& initialGuess, const char* message) const
+    {
+      size_t size = b.size();
+      if (A.rows() != A.cols() || A.rows() != size ||
+          initialGuess.size() != size ||
+          (myPreconditioner != nullptr && myPreconditioner->size() != size))
+      {
+        throw std::domain_error(message);
+      }
+    }
+
+    const IPreconditioner<T>* myPreconditioner;
+    Side mySide;
+};
+
+#endif
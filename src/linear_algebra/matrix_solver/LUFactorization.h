@@ -0,0 +1,74 @@
+/*
+ * author Connor Walsh
+ * file   LUFactorization.h
+ * brief  Factorization produced by GaussianEliminationSolver::factor
+ */
+
+#ifndef LU_FACTORIZATION_H
+#define LU_FACTORIZATION_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "IMatrixFactorization.h"
+#include "../../containers/Array.h"
+#include "../MathVector.h"
+#include "../math_matrix/MathMatrix.h"
+#include "../../parallel/ThreadPool.h"
+
+/*
+ * class  LUFactorization
+ * brief  Holds the result of Gaussian elimination: the echelon form of A in
+ *        its upper triangle, the multipliers below the diagonal and the row
+ *        exchanged with each pivot row. Since later exchanges also move the
+ *        stored multipliers, these are the factors of PA = LU: solving
+ *        applies every exchange to b, then substitutes forward through L and
+ *        back through U, which costs O(n^2) per right hand side
+ */
+template <class T>
+class LUFactorization : public IMatrixFactorization<T>
+{
+  public:
+    /*
+     * brief  Creates the factorization from eliminated storage
+     * pre    lu is square and was eliminated with the row exchanges in
+     *        pivots, pivots[k] being the row exchanged with row k at step k
+     * post   The factorization owns lu and pivots
+     */
+    LUFactorization(MathMatrix<T>&& lu, Array<size_t>&& pivots);
+
+    virtual size_t rows() const;
+    virtual size_t cols() const;
+
+    /*
+     * brief  Solves Ax = b in the storage of b
+     * pre    b must have size rows() else exception is thrown
+     * post   b holds the solution x. Throws an exception if A is singular
+     */
+    virtual void solveInPlace(MathVector<T>& b) const;
+
+    /*
+     * brief  Solves AX = B for every column of B in the storage of B. The
+     *        substitutions work a row of B at a time over blocks of columns,
+     *        with the blocks solved in parallel. Each column gets exactly
+     *        the result the vector solve would give
+     * pre    B must have rows() rows else exception is thrown
+     * post   B holds X. Throws an exception if A is singular
+     */
+    virtual void solveInPlace(MathMatrix<T>& B) const;
+
+    /*
+     * brief  Gives access to the eliminated matrix
+     * post   returns a const reference to the factored storage
+     */
+    const MathMatrix<T>& factors() const { return myFactors; }
+
+  private:
+    MathMatrix<T> myFactors;
+    Array<size_t> myPivots;
+};
+
+#include "LUFactorization.hpp"
+
+#endif
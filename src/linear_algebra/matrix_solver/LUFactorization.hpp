@@ -0,0 +1,136 @@
+/*
+ * author Connor Walsh
+ * file   LUFactorization.hpp
+ * brief  Implementation file for the LUFactorization class
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "LUFactorization.h"
+
+template <class T>
+LUFactorization<T>::LUFactorization(MathMatrix<T>&& lu, Array<size_t>&& pivots)
+  : myFactors(std::move(lu)), myPivots(std::move(pivots)) {}
+
+template <class T>
+size_t LUFactorization<T>::rows() const
+{
+  return myFactors.rows();
+}
+
+template <class T>
+size_t LUFactorization<T>::cols() const
+{
+  return myFactors.cols();
+}
+
+template <class T>
+void LUFactorization<T>::solveInPlace(MathVector<T>& b) const
+{
+  if (b.size() != myFactors.rows())
+  {
+    throw std::domain_error("Cannot solve factorization with a vector"
+        " of incorrect dimensions!");
+  }
+
+  // The multipliers below the diagonal were exchanged along with their
+  // rows by every later pivot, so they are those of PA = LU. Every exchange
+  // is therefore applied to b before substituting forward through L
+  const MathMatrix<T>& A = myFactors;
+  int size = A.rows();
+  for (int k = 0; k < size - 1; ++k)
+  {
+    if (myPivots[k] != (size_t)k)
+    {
+      std::swap(b[k], b[myPivots[k]]);
+    }
+  }
+  for (int k = 0; k < size - 1; ++k)
+  {
+    for (int i = k + 1; i < size; ++i)
+    {
+      b[i] -= static_cast<T>(A(i, k) * b[k]);
+    }
+  }
+
+  T tempSolution;
+  for (int i = A.rows() - 1; i >= 0; --i)
+  {
+    tempSolution = b[i];
+    for (int j = i + 1, jSize = A.rows(); j < jSize; ++j)
+    {
+      tempSolution -= A(i, j) * b[j];
+    }
+    if (A(i, i) == 0)
+    {
+      throw std::domain_error("Divide by zero encountered in backSubstitution!");
+    }
+    b[i] = static_cast<T>(tempSolution / static_cast<double>(A(i, i)));
+  }
+}
+
+template <class T>
+void LUFactorization<T>::solveInPlace(MathMatrix<T>& B) const
+{
+  if (B.rows() != myFactors.rows())
+  {
+    throw std::domain_error("Cannot solve factorization with a matrix"
+        " of incorrect dimensions!");
+  }
+
+  const MathMatrix<T>& A = myFactors;
+  int size = A.rows();
+
+  // As in the vector solve, the stored multipliers are those of PA = LU so
+  // every exchange is applied to B before substituting. Columns are then
+  // worked on in the same order of operations as the vector solve
+  for (int k = 0; k < size - 1; ++k)
+  {
+    if (myPivots[k] != (size_t)k)
+    {
+      B.swapRowsInPlace(k, myPivots[k]);
+    }
+  }
+
+  parallelFor(0, B.cols(), ThreadPool::grainFor(size * size),
+      [&](size_t first, size_t last)
+      {
+        for (int k = 0; k < size - 1; ++k)
+        {
+          const MathVector<T>& pivotRow = B[k];
+          for (int i = k + 1; i < size; ++i)
+          {
+            T multiplier = A(i, k);
+            MathVector<T>& row = B[i];
+            for (size_t col = first; col < last; ++col)
+            {
+              row[col] -= static_cast<T>(multiplier * pivotRow[col]);
+            }
+          }
+        }
+
+        for (int i = size - 1; i >= 0; --i)
+        {
+          MathVector<T>& row = B[i];
+          for (int j = i + 1; j < size; ++j)
+          {
+            T coefficient = A(i, j);
+            const MathVector<T>& solved = B[j];
+            for (size_t col = first; col < last; ++col)
+            {
+              row[col] -= coefficient * solved[col];
+            }
+          }
+          if (A(i, i) == 0)
+          {
+            throw std::domain_error("Divide by zero encountered in "
+                "backSubstitution!");
+          }
+          for (size_t col = first; col < last; ++col)
+          {
+            row[col] = static_cast<T>(row[col] / static_cast<double>(A(i, i)));
+          }
+        }
+      });
+}
@@ -0,0 +1,96 @@
+/*
+ * author Connor Walsh
+ * file   PipelinedConjugateGradientSolver.h
+ * brief  Class which implements the IMatrixSolver interface using the
+ *        pipelined conjugate gradient method
+ */
+
+#ifndef PIPELINED_CONJUGATE_GRADIENT_SOLVER_H
+#define PIPELINED_CONJUGATE_GRADIENT_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "IterativeSolver.h"
+#include "SolverWorkspace.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+#include "../math_matrix/MathMatrix.h"
+
+/*
+ * class  PipelinedConjugateGradientSolver
+ * brief  This class implements the IMatrixSolver interface with the
+ *        pipelined conjugate gradient method of Ghysels and Vanroose for
+ *        symmetric positive definite matrices. Recurrences for w = Ar and
+ *        its images let both dot products of an iteration be taken from
+ *        vectors that are already known, so they are reduced in the same
+ *        parallel pass as the product q = Aw, and all six vector updates
+ *        share a second pass. An iteration therefore synchronizes the
+ *        threads twice where ConjugateGradientSolver does five times, at
+ *        the cost of three more vectors and a residual that drifts from
+ *        b - Ax in finite precision. The residual is recomputed when the
+ *        recurrence claims convergence and the iteration restarted from it
+ *        if the claim does not hold
+ */
+template <class T>
+class PipelinedConjugateGradientSolver : public IterativeSolver<T>
+{
+  mutable SolverWorkspace<T> myWorkspace;
+
+  public:
+    /*
+     * brief  Creates a solver with a relative residual tolerance and a limit
+     *        on the number of iterations
+     * post   A maxIterations of zero allows twice the number of unknowns
+     */
+    PipelinedConjugateGradientSolver(T tolerance = 1e-10,
+        size_t maxIterations = 0)
+      : IterativeSolver<T>(tolerance, maxIterations), myWorkspace(numVectors)
+    {}
+
+    /*
+     * brief  Gives access to the scratch storage reused between solves
+     * post   returns a const reference to the solver's workspace
+     */
+    const SolverWorkspace<T>& workspace() const { return myWorkspace; }
+
+    /*
+    * brief   Solves Ax = b starting from the zero vector
+    * pre     A must be symmetric positive definite and b of size A.rows()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> operator()
+      (const IMathMatrix<T>& A, const MathVector<T>& b) const;
+
+    /*
+    * brief   Solves Ax = b starting from initialGuess
+    * pre     Same as operator() and initialGuess of size A.cols()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> solveFrom(const IMathMatrix<T>& A,
+        const MathVector<T>& b, const MathVector<T>& initialGuess) const;
+    virtual MathVector<T> solveFrom(MathMatrix<T>&& A, MathVector<T>&& b,
+        const MathVector<T>& initialGuess) const;
+
+    /*
+    * brief   Statically dispatched versions of the function operator and
+    *         solveFrom. Matrix may be any concrete IMathMatrix type
+    * pre     Same as operator() and solveFrom
+    * post    returns the vector x in Ax = b. Throws an exception if A is
+    *         found not to be positive definite or the tolerance is not met
+    *         within the iteration limit
+    */
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b) const;
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b,
+        const MathVector<T>& initialGuess) const;
+
+  private:
+    static const size_t numVectors = 6;
+};
+
+#include "PipelinedConjugateGradientSolver.hpp"
+
+#endif
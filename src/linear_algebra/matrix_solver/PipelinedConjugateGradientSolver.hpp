@@ -0,0 +1,147 @@
+/*
+ * author Connor Walsh
+ * file   PipelinedConjugateGradientSolver.hpp
+ * brief  Implementation file for the PipelinedConjugateGradientSolver class
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "PipelinedConjugateGradientSolver.h"
+#include "KrylovKernels.h"
+#include "../../parallel/ThreadPool.h"
+
+template <class T>
+const size_t PipelinedConjugateGradientSolver<T>::numVectors;
+
+template <class T>
+MathVector<T> PipelinedConjugateGradientSolver<T>::operator()
+  (const IMathMatrix<T>& A, const MathVector<T>& b) const
+{
+  return solve(A, b);
+}
+
+template <class T>
+MathVector<T> PipelinedConjugateGradientSolver<T>::solveFrom
+  (const IMathMatrix<T>& A, const MathVector<T>& b,
+   const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+MathVector<T> PipelinedConjugateGradientSolver<T>::solveFrom
+  (MathMatrix<T>&& A, MathVector<T>&& b,
+   const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> PipelinedConjugateGradientSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b) const
+{
+  MathVector<T> zero(A.cols());
+  return solve(A, b, zero);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> PipelinedConjugateGradientSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  size_t size = b.size();
+  if (A.rows() != A.cols() || A.rows() != size || initialGuess.size() != size)
+  {
+    throw std::domain_error("Cannot perform PipelinedConjugateGradient on"
+        " matrix and vectors of incorrect dimensions!");
+  }
+
+  MathVector<T> x(initialGuess);
+  MathVector<T>& residual = myWorkspace.vector(0, size);
+  MathVector<T>& image = myWorkspace.vector(1, size);
+  MathVector<T>& product = myWorkspace.vector(2, size);
+  MathVector<T>& direction = myWorkspace.vector(3, size);
+  MathVector<T>& directionImage = myWorkspace.vector(4, size);
+  MathVector<T>& directionProduct = myWorkspace.vector(5, size);
+
+  T threshold = this->myTolerance * this->myTolerance * b.dotProduct(b);
+  size_t maxIterations = this->iterationLimit(size, 2);
+  size_t& iterations = this->myIterations;
+  iterations = 0;
+
+  T* xs = x.begin();
+  T* r = residual.begin();
+  T* w = image.begin();
+  const T* q = product.begin();
+  T* p = direction.begin();
+  T* s = directionImage.begin();
+  T* z = directionProduct.begin();
+  size_t grain = ThreadPool::grainFor(6);
+
+  // Each pass through the outer loop starts the recurrences from the true
+  // residual, r = b - Ax and w = Ar
+  bool restart = true;
+  T gamma = 0;
+  T alpha = 0;
+  while (true)
+  {
+    if (restart)
+    {
+      KrylovKernels<T>::residual(A, x, b, residual);
+      KrylovKernels<T>::multiply(A, residual, image);
+    }
+
+    // q = Aw together with gamma = r.r and delta = w.r
+    std::pair<T, T> dots =
+      KrylovKernels<T>::multiplyWithDots(A, image, product, residual);
+    T nextGamma = dots.first;
+    T delta = dots.second;
+
+    if (nextGamma <= threshold)
+    {
+      if (restart)
+      {
+        break;
+      }
+      restart = true;
+      continue;
+    }
+    if (iterations == maxIterations)
+    {
+      throw std::domain_error("PipelinedConjugateGradient did not converge"
+          " within the iteration limit!");
+    }
+    ++iterations;
+
+    T beta = restart ? T(0) : nextGamma / gamma;
+    T curvature = restart ? delta : delta - beta * nextGamma / alpha;
+    if (!(curvature > 0))
+    {
+      throw std::domain_error("Cannot perform PipelinedConjugateGradient on"
+          " a matrix that is not positive definite!");
+    }
+    gamma = nextGamma;
+    alpha = gamma / curvature;
+
+    // z = q + beta z, s = w + beta s and p = r + beta p, after which x, r
+    // and w step along p, s and z
+    bool first = restart;
+    parallelFor(0, size, grain, [=](size_t begin, size_t end)
+        {
+          for (size_t i = begin; i < end; ++i)
+          {
+            z[i] = first ? q[i] : q[i] + beta * z[i];
+            s[i] = first ? w[i] : w[i] + beta * s[i];
+            p[i] = first ? r[i] : r[i] + beta * p[i];
+            xs[i] += alpha * p[i];
+            r[i] -= alpha * s[i];
+            w[i] -= alpha * z[i];
+          }
+        });
+    restart = false;
+  }
+
+  return x;
+}
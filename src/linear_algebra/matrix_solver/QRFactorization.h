@@ -0,0 +1,74 @@
+/*
+ * author Connor Walsh
+ * file   QRFactorization.h
+ * brief  Factorization produced by QRSolver::factor
+ */
+
+#ifndef QR_FACTORIZATION_H
+#define QR_FACTORIZATION_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "IMatrixFactorization.h"
+#include "../MathVector.h"
+#include "../math_matrix/MathMatrix.h"
+#include "../../parallel/ThreadPool.h"
+
+/*
+ * class  QRFactorization
+ * brief  Holds a Householder QR factorization: R in the upper triangle and
+ *        the reflectors below the diagonal, with the leading entry and
+ *        scale of each reflector kept alongside. Solving applies Q^T to b
+ *        and back substitutes with R, which costs O(mn) per right hand side
+ */
+template <class T>
+class QRFactorization : public IMatrixFactorization<T>
+{
+  public:
+    /*
+     * brief  Creates the factorization from the output of
+     *        QRSolver::householderInPlace
+     * pre    heads and scales have size qr.cols()
+     * post   The factorization owns qr, heads and scales
+     */
+    QRFactorization(MathMatrix<T>&& qr, MathVector<T>&& heads,
+        MathVector<T>&& scales);
+
+    virtual size_t rows() const;
+    virtual size_t cols() const;
+
+    /*
+     * brief  Solves Ax = b, in the least squares sense if A has more rows
+     *        than columns, in the storage of b
+     * pre    b must have size rows() else exception is thrown
+     * post   b holds the solution x and has size cols()
+     */
+    virtual void solveInPlace(MathVector<T>& b) const;
+
+    /*
+     * brief  Solves AX = B for every column of B in the storage of B, a row
+     *        of B at a time over blocks of columns solved in parallel. Each
+     *        column gets exactly the result the vector solve would give
+     * pre    B must have rows() rows else exception is thrown
+     * post   B holds X and has size [cols(), B.cols()]
+     */
+    virtual void solveInPlace(MathMatrix<T>& B) const;
+
+    /*
+     * brief  Multiplies b by Q^T in place
+     * pre    b must have size rows()
+     * post   b holds Q^T b
+     */
+    void applyQTranspose(MathVector<T>& b) const;
+
+  private:
+    MathMatrix<T> myFactors;
+    MathVector<T> myHeads;
+    MathVector<T> myScales;
+};
+
+#include "QRFactorization.hpp"
+
+#endif
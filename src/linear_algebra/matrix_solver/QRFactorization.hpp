@@ -0,0 +1,145 @@
+/*
+ * author Connor Walsh
+ * file   QRFactorization.hpp
+ * brief  Implementation file for the QRFactorization class
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "QRFactorization.h"
+
+template <class T>
+QRFactorization<T>::QRFactorization(MathMatrix<T>&& qr, MathVector<T>&& heads,
+    MathVector<T>&& scales) : myFactors(std::move(qr)),
+    myHeads(std::move(heads)), myScales(std::move(scales)) {}
+
+template <class T>
+size_t QRFactorization<T>::rows() const
+{
+  return myFactors.rows();
+}
+
+template <class T>
+size_t QRFactorization<T>::cols() const
+{
+  return myFactors.cols();
+}
+
+template <class T>
+void QRFactorization<T>::applyQTranspose(MathVector<T>& b) const
+{
+  const MathMatrix<T>& A = myFactors;
+  for (int k = 0, numRows = A.rows(), numCols = A.cols(); k < numCols; ++k)
+  {
+    T head = myHeads[k];
+    T projection = head * b[k];
+    for (int i = k + 1; i < numRows; ++i)
+    {
+      projection += A(i, k) * b[i];
+    }
+    b[k] -= myScales[k] * projection * head;
+    for (int i = k + 1; i < numRows; ++i)
+    {
+      b[i] -= myScales[k] * projection * A(i, k);
+    }
+  }
+}
+
+template <class T>
+void QRFactorization<T>::solveInPlace(MathVector<T>& b) const
+{
+  if (b.size() != myFactors.rows())
+  {
+    throw std::domain_error("Cannot solve factorization with a vector"
+        " of incorrect dimensions!");
+  }
+
+  applyQTranspose(b);
+
+  const MathMatrix<T>& A = myFactors;
+  T tempSolution;
+  for (int i = A.cols() - 1; i >= 0; --i)
+  {
+    tempSolution = b[i];
+    for (int j = i + 1, jSize = A.cols(); j < jSize; ++j)
+    {
+      tempSolution -= A(i, j) * b[j];
+    }
+    b[i] = tempSolution / A(i, i);
+  }
+  b.resize(A.cols());
+}
+
+template <class T>
+void QRFactorization<T>::solveInPlace(MathMatrix<T>& B) const
+{
+  if (B.rows() != myFactors.rows())
+  {
+    throw std::domain_error("Cannot solve factorization with a matrix"
+        " of incorrect dimensions!");
+  }
+
+  const MathMatrix<T>& A = myFactors;
+  int numRows = A.rows();
+  int numCols = A.cols();
+
+  parallelFor(0, B.cols(), ThreadPool::grainFor(numRows * numCols),
+      [&](size_t first, size_t last)
+      {
+        // Q^T B, one projection per column of the block
+        MathVector<T> projections(last - first);
+        for (int k = 0; k < numCols; ++k)
+        {
+          T head = myHeads[k];
+          MathVector<T>& pivotRow = B[k];
+          for (size_t col = first; col < last; ++col)
+          {
+            projections[col - first] = head * pivotRow[col];
+          }
+          for (int i = k + 1; i < numRows; ++i)
+          {
+            T tail = A(i, k);
+            const MathVector<T>& row = B[i];
+            for (size_t col = first; col < last; ++col)
+            {
+              projections[col - first] += tail * row[col];
+            }
+          }
+          for (size_t col = first; col < last; ++col)
+          {
+            pivotRow[col] -= myScales[k] * projections[col - first] * head;
+          }
+          for (int i = k + 1; i < numRows; ++i)
+          {
+            T tail = A(i, k);
+            MathVector<T>& row = B[i];
+            for (size_t col = first; col < last; ++col)
+            {
+              row[col] -= myScales[k] * projections[col - first] * tail;
+            }
+          }
+        }
+
+        // RX = Q^T B
+        for (int i = numCols - 1; i >= 0; --i)
+        {
+          MathVector<T>& row = B[i];
+          for (int j = i + 1; j < numCols; ++j)
+          {
+            T coefficient = A(i, j);
+            const MathVector<T>& solved = B[j];
+            for (size_t col = first; col < last; ++col)
+            {
+              row[col] -= coefficient * solved[col];
+            }
+          }
+          for (size_t col = first; col < last; ++col)
+          {
+            row[col] = row[col] / A(i, i);
+          }
+        }
+      });
+
+  B.resize(numCols, B.cols());
+}
@@ -8,10 +8,18 @@
 #define QR_SOLVER_H
 
 #include <vector>
+#include <cmath>
+#include <utility>
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 
+#include "../../containers/Array.h"
+#include "../../containers/MonotonicArena.h"
+#include "../../parallel/ThreadPool.h"
 #include "IMatrixSolver.h"
+#include "SolverWorkspace.h"
+#include "QRFactorization.h"
 #include "GaussianEliminationSolver.h"
 #include "../MathVector.h"
 #include "../math_matrix/IMathMatrix.h"
@@ -27,7 +35,15 @@
 template <class T>
 class QRSolver : public IMatrixSolver<T>
 {
+  mutable SolverWorkspace<T> myWorkspace;
+
   public:
+    /*
+     * brief  Gives access to the scratch storage reused between solves
+     * post   returns a const reference to the solver's workspace
+     */
+    const SolverWorkspace<T>& workspace() const { return myWorkspace; }
+
     /*
      * brief  This function performs the QR method for calculating the eigen
      *        vector of a matrix
@@ -40,14 +56,19 @@ class QRSolver : public IMatrixSolver<T>
         UpTriangleMathMatrix<T>& R, int numIter);
 
     /*
-     * brief  This function performs QR decompostion on a matrix A
-     * pre    A, Q, and R must be the same size and T must have standard
-     *        mathematical operations defined
+     * brief  This function performs QR decompostion on a matrix A. Its
+     *        temporaries are allocated from scratch, which is rewound to
+     *        where it was before returning, or from the calling thread's
+     *        arena when no scratch arena is given
+     * pre    A, Q, and R must be the same square size else exception is
+     *        thrown, and T must have standard mathematical operations defined
      * post   Q is an orthogonal matrix and R is upper triangular where
      *        A = QR
      */
     static void QRDecomposition(const MathMatrix<T>& A, MathMatrix<T>& Q,
         UpTriangleMathMatrix<T>& R);
+    static void QRDecomposition(const MathMatrix<T>& A, MathMatrix<T>& Q,
+        UpTriangleMathMatrix<T>& R, MonotonicArena& scratch);
 
     /*
      * brief  This operator runs the QR Decomposition algorithm and solves
@@ -59,6 +80,73 @@ class QRSolver : public IMatrixSolver<T>
      */
     virtual MathVector<T> operator()
       (const IMathMatrix<T>& A, const MathVector<T>& b) const;
+
+    /*
+     * brief  Statically dispatched version of the function operator. Matrix
+     *        may be any concrete IMathMatrix type so element access is
+     *        resolved at compile time
+     * pre    A and b are of compatible dimensions
+     * post   returns a MathVector equal to the solution x
+     */
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b) const;
+
+    /*
+     * brief  Version of solve writing into a caller provided vector. A and b
+     *        are copied into the solver's workspace, whose storage is reused
+     *        by later solves
+     * pre    A and b are of compatible dimensions
+     * post   x holds the solution to Ax = b
+     */
+    template <class Matrix>
+    void solve(const Matrix& A, const MathVector<T>& b, MathVector<T>& x) const;
+
+    /*
+     * brief  Consuming version of the function operator. The factorization
+     *        is performed directly in the storage of A and b
+     * pre    A and b are of compatible dimensions
+     * post   returns a MathVector equal to the solution x, A and b are consumed
+     */
+    virtual MathVector<T> operator()(MathMatrix<T>&& A, MathVector<T>&& b) const;
+
+    /*
+     * brief  Solves Ax = b in the caller's storage using Householder
+     *        reflections. Matrix must provide mutable element access, e.g.
+     *        MathMatrix or MathMatrixView
+     * pre    A must have at least as many rows as columns and b must have
+     *        size A.rows()
+     * post   The upper triangle of A holds R, the reflectors are stored below
+     *        the diagonal and the first A.cols() entries of b hold x.
+     *        Throws an exception if A is rank deficient
+     */
+    template <class Matrix>
+    void solveInPlace(Matrix& A, MathVector<T>& b) const;
+
+    /*
+     * brief  Computes the Householder factorization of A once so it can be
+     *        solved against many b
+     * pre    A must have at least as many rows as columns
+     * post   returns a QRFactorization. Throws an exception if A is rank
+     *        deficient
+     */
+    using IMatrixSolver<T>::factor;
+    virtual std::unique_ptr<IMatrixFactorization<T> >
+      factor(MathMatrix<T>&& A) const;
+
+    /*
+     * brief  Computes the Householder QR factorization of A in place
+     * pre    A must have at least as many rows as columns, heads and
+     *        projections must have size A.cols()
+     * post   The upper triangle of A holds R and column k below the diagonal
+     *        holds the tail of the kth reflector whose leading entry is
+     *        returned in heads[k]. b, if not null, is multiplied by Q^T.
+     *        scales, if not null, receives the scale 2 / |v|^2 of each
+     *        reflector. projections is used as scratch space
+     */
+    template <class Matrix>
+    static void householderInPlace(Matrix& A, MathVector<T>& heads,
+        MathVector<T>& projections, MathVector<T>* b = nullptr,
+        MathVector<T>* scales = nullptr);
 };
 
 #include "QRSolver.hpp"
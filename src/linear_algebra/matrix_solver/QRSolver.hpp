@@ -10,19 +10,188 @@ template <class T>
 MathVector<T> QRSolver<T>::operator()(const IMathMatrix<T>& A,
     const MathVector<T>& b) const
 {
-  UpTriangleMathMatrix<double> R(A.rows(), A.cols());
-  MathMatrix<T> Q(A.rows(), A.cols());
-  MathMatrix<T> input(A);
+  return solve(A, b);
+}
+
+template <class T>
+MathVector<T> QRSolver<T>::operator()(MathMatrix<T>&& A, MathVector<T>&& b) const
+{
+  solveInPlace(A, b);
+  if (b.size() == A.cols())
+  {
+    return std::move(b);
+  }
+
+  MathVector<T> result(A.cols());
+  for (int i = 0, size = A.cols(); i < size; ++i)
+  {
+    result[i] = b[i];
+  }
+  return result;
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> QRSolver<T>::solve(const Matrix& A, const MathVector<T>& b) const
+{
+  MathVector<T> result(A.cols());
+  solve(A, b, result);
+  return result;
+}
+
+template <class T>
+template <class Matrix>
+void QRSolver<T>::solve(const Matrix& coefficients, const MathVector<T>& b,
+    MathVector<T>& x) const
+{
+  if (coefficients.rows() != b.size())
+  {
+    throw std::domain_error("Cannot perform QR solve on matrix and vector"
+        " of incorrect dimensions!");
+  }
+
+  int numRows = coefficients.rows();
+  int numCols = coefficients.cols();
+  MathMatrix<T>& A = myWorkspace.matrix(numRows, numCols);
+  for (int row = 0; row < numRows; ++row)
+  {
+    for (int col = 0; col < numCols; ++col)
+    {
+      A(row, col) = coefficients(row, col);
+    }
+  }
 
-  QRDecomposition(input, Q, R);
+  MathVector<T>& constants = myWorkspace.vector(0, numRows);
+  std::copy(b.begin(), b.end(), constants.begin());
 
-  // Rx = Q^T*b
-  MathMatrix<T> Qtranspose = Q.transpose();
-  MathVector<T> constants = Qtranspose * b;
-  MathMatrix<T> augmented = GaussianEliminationSolver<T>::augmentedMatrix
-    (R, constants);
+  solveInPlace(A, constants);
 
-  return GaussianEliminationSolver<T>::backSubstitution(augmented);
+  x.resize(numCols);
+  std::copy(constants.begin(), constants.begin() + numCols, x.begin());
+}
+
+template <class T>
+template <class Matrix>
+void QRSolver<T>::solveInPlace(Matrix& A, MathVector<T>& b) const
+{
+  if (A.rows() != b.size() || A.rows() < A.cols())
+  {
+    throw std::domain_error("Cannot perform QR solve on matrix and vector"
+        " of incorrect dimensions!");
+  }
+
+  householderInPlace(A, myWorkspace.vector(1, A.cols()),
+      myWorkspace.vector(2, A.cols()), &b);
+
+  // Rx = Q^T*b using the upper triangle of A
+  T tempSolution;
+  for (int i = A.cols() - 1; i >= 0; --i)
+  {
+    tempSolution = b[i];
+    for (int j = i + 1, jSize = A.cols(); j < jSize; ++j)
+    {
+      tempSolution -= A(i, j) * b[j];
+    }
+    b[i] = tempSolution / A(i, i);
+  }
+}
+
+template <class T>
+template <class Matrix>
+void QRSolver<T>::householderInPlace(Matrix& A, MathVector<T>& heads,
+    MathVector<T>& projections, MathVector<T>* b, MathVector<T>* scales)
+{
+  int numRows = A.rows();
+  int numCols = A.cols();
+
+  for (int k = 0; k < numCols; ++k)
+  {
+    T normSquared = 0;
+    for (int i = k; i < numRows; ++i)
+    {
+      normSquared += A(i, k) * A(i, k);
+    }
+    if (normSquared == 0)
+    {
+      throw std::domain_error("QR method requires division by zero!");
+    }
+
+    // Reflect column k onto alpha * e_k choosing the sign that avoids
+    // cancellation in the leading entry of the reflector
+    T alpha = (A(k, k) > 0) ? -sqrt(normSquared) : sqrt(normSquared);
+    T head = A(k, k) - alpha;
+    T reflectorNorm = normSquared - A(k, k) * A(k, k) + head * head;
+    A(k, k) = alpha;
+    heads[k] = head;
+
+    // Accumulate v^T * A one row at a time so rows are walked contiguously
+    for (int j = k + 1; j < numCols; ++j)
+    {
+      projections[j] = head * A(k, j);
+    }
+    for (int i = k + 1; i < numRows; ++i)
+    {
+      for (int j = k + 1; j < numCols; ++j)
+      {
+        projections[j] += A(i, k) * A(i, j);
+      }
+    }
+
+    T scale = 2 / reflectorNorm;
+    if (scales != nullptr)
+    {
+      (*scales)[k] = scale;
+    }
+    for (int j = k + 1; j < numCols; ++j)
+    {
+      A(k, j) -= scale * projections[j] * head;
+    }
+    parallelFor(k + 1, numRows, ThreadPool::grainFor(numCols - k),
+        [&](size_t firstRow, size_t lastRow)
+        {
+          for (int i = firstRow; i < (int)lastRow; ++i)
+          {
+            for (int j = k + 1; j < numCols; ++j)
+            {
+              A(i, j) -= scale * projections[j] * A(i, k);
+            }
+          }
+        });
+
+    if (b != nullptr)
+    {
+      MathVector<T>& constants = *b;
+      T projection = head * constants[k];
+      for (int i = k + 1; i < numRows; ++i)
+      {
+        projection += A(i, k) * constants[i];
+      }
+      constants[k] -= scale * projection * head;
+      for (int i = k + 1; i < numRows; ++i)
+      {
+        constants[i] -= scale * projection * A(i, k);
+      }
+    }
+  }
+}
+
+template <class T>
+std::unique_ptr<IMatrixFactorization<T> >
+  QRSolver<T>::factor(MathMatrix<T>&& A) const
+{
+  if (A.rows() < A.cols())
+  {
+    throw std::domain_error("Cannot factor a matrix with fewer rows than"
+        " columns!");
+  }
+
+  MathVector<T> heads(A.cols());
+  MathVector<T> scales(A.cols());
+  householderInPlace(A, heads, myWorkspace.vector(2, A.cols()), nullptr,
+      &scales);
+
+  return std::unique_ptr<IMatrixFactorization<T> >(new QRFactorization<T>(
+      std::move(A), std::move(heads), std::move(scales)));
 }
 
 template <class T>
@@ -37,37 +206,89 @@ void QRSolver<T>::QRMethod(MathMatrix<T>& A, MathMatrix<T>& Q,
 }
 
 template <class T>
-void QRSolver<T>::QRDecomposition(const MathMatrix<T>& input, 
+void QRSolver<T>::QRDecomposition(const MathMatrix<T>& input,
     MathMatrix<T>& orthonormal, UpTriangleMathMatrix<T>& R)
 {
-  MathMatrix<T> A = input.transpose();
-  MathMatrix<T> Q = orthonormal.transpose();
+  QRDecomposition(input, orthonormal, R, MonotonicArena::threadArena());
+}
 
-  for (int k = 0, numRows = A.rows(); k < numRows; ++k)
+template <class T>
+void QRSolver<T>::QRDecomposition(const MathMatrix<T>& input,
+    MathMatrix<T>& orthonormal, UpTriangleMathMatrix<T>& R,
+    MonotonicArena& scratch)
+{
+  int size = input.rows();
+  if ((int)input.cols() != size)
   {
-    for (int i = 0; i < k; ++i)
+    throw std::domain_error("QR decomposition requires a square matrix!");
+  }
+
+  // The columns of the input and of Q are each kept contiguous in scratch,
+  // which is rewound once they are destroyed
+  ArenaRewind rewind(scratch);
+  Array<T> columns(size * size, scratch);
+  Array<T> basis(size * size, scratch);
+  Array<T> offset(size, scratch);
+  for (int col = 0; col < size; ++col)
+  {
+    for (int row = 0; row < size; ++row)
     {
-      R(i, k) = A[k] * Q[i];
+      columns[col * size + row] = input(row, col);
     }
+  }
 
-    MathVector<T> offset(numRows);
-    MathVector<T> orthagonalized(numRows);
+  for (int k = 0; k < size; ++k)
+  {
+    const T* column = columns.begin() + k * size;
+    for (int i = 0; i < k; ++i)
+    {
+      const T* q = basis.begin() + i * size;
+      T dot = 0;
+      for (int row = 0; row < size; ++row)
+      {
+        dot += column[row] * q[row];
+      }
+      R(i, k) = dot;
+    }
 
+    std::fill(offset.begin(), offset.end(), T(0));
     for (int j = 0; j < k; ++j)
     {
-      offset += R(j, k) * Q[j];
+      T scale = R(j, k);
+      const T* q = basis.begin() + j * size;
+      for (int row = 0; row < size; ++row)
+      {
+        offset[row] += scale * q[row];
+      }
+    }
+
+    T* orthagonalized = basis.begin() + k * size;
+    T norm = 0;
+    for (int row = 0; row < size; ++row)
+    {
+      orthagonalized[row] = column[row] - offset[row];
+      norm += orthagonalized[row] * orthagonalized[row];
     }
-    orthagonalized = A[k] - offset;
 
     // Calculate the kth r value
-    R(k, k) = orthagonalized.getMagnitude();
+    R(k, k) = sqrt(norm);
     if (R(k, k) == 0)
     {
       throw std::domain_error("QR method requires division by zero!");
     }
 
-    Q[k] = (1.0 / R(k, k)) * orthagonalized;
+    T inverse = 1.0 / R(k, k);
+    for (int row = 0; row < size; ++row)
+    {
+      orthagonalized[row] = inverse * orthagonalized[row];
+    }
   }
 
-  orthonormal = Q.transpose();
+  for (int row = 0; row < size; ++row)
+  {
+    for (int col = 0; col < size; ++col)
+    {
+      orthonormal(row, col) = basis[col * size + row];
+    }
+  }
 }
@@ -0,0 +1,143 @@
+/*
+ * author Connor Walsh
+ * file   RedBlackSORSolver.h
+ * brief  SOR for the DirichletPoisson grid in red-black ordering
+ */
+
+#ifndef RED_BLACK_SOR_SOLVER_H
+#define RED_BLACK_SOR_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+#include <stdexcept>
+
+#include "IterativeSolver.h"
+#include "../MathVector.h"
+
+/*
+ * class  RedBlackSORSolver
+ * brief  Solves the system DirichletPoisson generates for numDivs divisions,
+ *        u - (sum of the four inner neighbours of u) / 4 = b, directly on the
+ *        grid without forming A. Points are coloured like a chess board so
+ *        that every neighbour of a red point is black and the other way
+ *        round. All points of one colour can then be updated at once: the
+ *        rows of a sweep run in parallel, and each colour is kept in its own
+ *        compacted grid so the updates of a row are a loop over consecutive
+ *        memory. A few sweeps with omega one make the Gauss-Seidel smoother
+ *        of a multigrid cycle. One iteration is a red and a black sweep
+ */
+template <class T>
+class RedBlackSORSolver : public IterativeSolver<T, GridSolver>
+{
+  public:
+    /*
+     * brief  Creates a solver with a relaxation factor, a relative residual
+     *        tolerance and a limit on the number of iterations
+     * pre    omega must be in [0, 2) else exception is thrown
+     * post   An omega of zero uses the optimal factor for each grid. A
+     *        maxIterations of zero allows 10 iterations per unknown
+     */
+    RedBlackSORSolver(T omega = 0, T tolerance = 1e-10,
+        size_t maxIterations = 0);
+
+    /*
+     * brief  Function to change the relaxation factor
+     * pre    omega must be in [0, 2) else exception is thrown
+     * post   Later solves use the new value
+     */
+    void setOmega(T omega);
+
+    /*
+     * brief  Returns the relaxation factor used for a grid of numDivs
+     *        divisions
+     */
+    T omegaFor(int numDivs) const;
+
+    /*
+     * brief  Performs sweeps iterations on x in place
+     * pre    x and b have (numDivs - 1)^2 entries ordered as in
+     *        DirichletPoisson, numDivs > 1
+     * post   x holds the relaxed iterate
+     */
+    void smooth(MathVector<T>& x, const MathVector<T>& b, int numDivs,
+        size_t sweeps) const;
+
+    /*
+     * brief  Returns the norm of the residual b - Ax
+     * pre    Same as smooth
+     */
+    T residualNorm(const MathVector<T>& x, const MathVector<T>& b,
+        int numDivs) const;
+
+    /*
+     * brief  Solves Ax = b starting from the zero vector or initialGuess
+     * pre    b and initialGuess have (numDivs - 1)^2 entries, numDivs > 1
+     * post   returns x. Throws an exception if the tolerance is not met
+     *        within the iteration limit
+     */
+    MathVector<T> solve(const MathVector<T>& b, int numDivs) const;
+    MathVector<T> solve(const MathVector<T>& b, int numDivs,
+        const MathVector<T>& initialGuess) const;
+
+  private:
+    /*
+     * brief  The points of one vector split by colour. Row j of colour c
+     *        holds the points (i, j) with i + j + c even, compacted, inside
+     *        a frame of zeros so that neighbours on the boundary read zero
+     */
+    struct ColouredGrid
+    {
+      ColouredGrid(int numDivs);
+
+      /*
+       * brief  Returns the first entry of row j of colour, j from -1 to
+       *        width
+       */
+      T* row(int colour, int j) { return &colours[colour][(j + 1) * stride + 1]; }
+      const T* row(int colour, int j) const
+      {
+        return &colours[colour][(j + 1) * stride + 1];
+      }
+
+      /*
+       * brief  Returns the first grid index of row j of colour
+       */
+      int start(int colour, int j) const { return (colour + j) % 2; }
+
+      /*
+       * brief  Returns the number of points in row j of colour
+       */
+      int length(int colour, int j) const { return (width - start(colour, j) + 1) / 2; }
+
+      void split(const MathVector<T>& values);
+      void merge(MathVector<T>& values) const;
+
+      int width;
+      int stride;
+      MathVector<T> colours[2];
+    };
+
+    /*
+     * brief  Updates every point of colour
+     */
+    static void sweep(ColouredGrid& x, const ColouredGrid& b, int colour,
+        T omega);
+
+    /*
+     * brief  Returns the squared norm of the residual
+     */
+    static T residualSquares(const ColouredGrid& x, const ColouredGrid& b);
+
+    /*
+     * brief  Checks x and b against numDivs
+     */
+    static void checkSizes(const MathVector<T>& x, const MathVector<T>& b,
+        int numDivs);
+
+    T myOmega;
+};
+
+#include "RedBlackSORSolver.hpp"
+
+#endif
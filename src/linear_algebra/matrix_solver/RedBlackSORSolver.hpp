@@ -0,0 +1,227 @@
+/*
+ * author Connor Walsh
+ * file   RedBlackSORSolver.hpp
+ * brief  Implementation file for the RedBlackSORSolver class
+ */
+
+#include <stdexcept>
+#include <cmath>
+
+#include "RedBlackSORSolver.h"
+#include "SORSolver.h"
+#include "../../parallel/ThreadPool.h"
+
+template <class T>
+RedBlackSORSolver<T>::ColouredGrid::ColouredGrid(int numDivs)
+  : width(numDivs - 1), stride(numDivs / 2 + 2)
+{
+  colours[0].resize((width + 2) * stride);
+  colours[1].resize((width + 2) * stride);
+}
+
+template <class T>
+void RedBlackSORSolver<T>::ColouredGrid::split(const MathVector<T>& values)
+{
+  for (int colour = 0; colour < 2; ++colour)
+  {
+    for (int j = 0; j < width; ++j)
+    {
+      T* target = row(colour, j);
+      const T* source = &values[j * width + start(colour, j)];
+      for (int k = 0, numPoints = length(colour, j); k < numPoints; ++k)
+      {
+        target[k] = source[2 * k];
+      }
+    }
+  }
+}
+
+template <class T>
+void RedBlackSORSolver<T>::ColouredGrid::merge(MathVector<T>& values) const
+{
+  for (int colour = 0; colour < 2; ++colour)
+  {
+    for (int j = 0; j < width; ++j)
+    {
+      const T* source = row(colour, j);
+      T* target = &values[j * width + start(colour, j)];
+      for (int k = 0, numPoints = length(colour, j); k < numPoints; ++k)
+      {
+        target[2 * k] = source[k];
+      }
+    }
+  }
+}
+
+template <class T>
+RedBlackSORSolver<T>::RedBlackSORSolver(T omega, T tolerance,
+    size_t maxIterations)
+  : IterativeSolver<T, GridSolver>(tolerance, maxIterations), myOmega(0)
+{
+  setOmega(omega);
+}
+
+template <class T>
+void RedBlackSORSolver<T>::setOmega(T omega)
+{
+  if (omega < 0 || omega >= 2)
+  {
+    throw std::domain_error("SOR relaxation factor must be in [0, 2)!");
+  }
+  myOmega = omega;
+}
+
+template <class T>
+T RedBlackSORSolver<T>::omegaFor(int numDivs) const
+{
+  return (myOmega == 0) ? SORSolver<T>::optimalPoissonOmega(numDivs) : myOmega;
+}
+
+template <class T>
+void RedBlackSORSolver<T>::sweep(ColouredGrid& x, const ColouredGrid& b,
+    int colour, T omega)
+{
+  int other = 1 - colour;
+  parallelFor(0, x.width, ThreadPool::grainFor(8 * x.width),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        for (int j = firstRow; j < (int)lastRow; ++j)
+        {
+          // A point k of this row has its left and right neighbours at
+          // k + start - 1 and k + start of the other colour's row, and its
+          // lower and upper neighbours at k of the rows around it
+          int offset = x.start(colour, j);
+          T* values = x.row(colour, j);
+          const T* constants = b.row(colour, j);
+          const T* beside = x.row(other, j) + offset;
+          const T* below = x.row(other, j - 1);
+          const T* above = x.row(other, j + 1);
+          for (int k = 0, numPoints = x.length(colour, j); k < numPoints; ++k)
+          {
+            T target = constants[k] +
+                0.25 * (beside[k - 1] + beside[k] + below[k] + above[k]);
+            values[k] += omega * (target - values[k]);
+          }
+        }
+      });
+}
+
+template <class T>
+T RedBlackSORSolver<T>::residualSquares(const ColouredGrid& x,
+    const ColouredGrid& b)
+{
+  // Blocks of rows depend only on the grid, so the norm is the same for any
+  // number of threads
+  return parallelReduce(0, x.width, ThreadPool::grainFor(8 * x.width), T(0),
+      [&](size_t firstRow, size_t lastRow)
+      {
+        T squares = 0;
+        for (int j = firstRow; j < (int)lastRow; ++j)
+        {
+          for (int colour = 0; colour < 2; ++colour)
+          {
+            int other = 1 - colour;
+            const T* values = x.row(colour, j);
+            const T* constants = b.row(colour, j);
+            const T* beside = x.row(other, j) + x.start(colour, j);
+            const T* below = x.row(other, j - 1);
+            const T* above = x.row(other, j + 1);
+            for (int k = 0, numPoints = x.length(colour, j); k < numPoints; ++k)
+            {
+              T residual = constants[k] - values[k] +
+                  0.25 * (beside[k - 1] + beside[k] + below[k] + above[k]);
+              squares += residual * residual;
+            }
+          }
+        }
+        return squares;
+      },
+      [](T lhs, T rhs) { return lhs + rhs; });
+}
+
+template <class T>
+void RedBlackSORSolver<T>::checkSizes(const MathVector<T>& x,
+    const MathVector<T>& b, int numDivs)
+{
+  size_t numPoints = (numDivs - 1) * (numDivs - 1);
+  if (numDivs < 2 || x.size() != numPoints || b.size() != numPoints)
+  {
+    throw std::domain_error("Cannot perform red-black SOR on vectors of"
+        " incorrect dimensions!");
+  }
+}
+
+template <class T>
+void RedBlackSORSolver<T>::smooth(MathVector<T>& x, const MathVector<T>& b,
+    int numDivs, size_t sweeps) const
+{
+  checkSizes(x, b, numDivs);
+
+  ColouredGrid values(numDivs);
+  ColouredGrid constants(numDivs);
+  values.split(x);
+  constants.split(b);
+
+  T omega = omegaFor(numDivs);
+  for (size_t iteration = 0; iteration < sweeps; ++iteration)
+  {
+    sweep(values, constants, 0, omega);
+    sweep(values, constants, 1, omega);
+  }
+  values.merge(x);
+}
+
+template <class T>
+T RedBlackSORSolver<T>::residualNorm(const MathVector<T>& x,
+    const MathVector<T>& b, int numDivs) const
+{
+  checkSizes(x, b, numDivs);
+
+  ColouredGrid values(numDivs);
+  ColouredGrid constants(numDivs);
+  values.split(x);
+  constants.split(b);
+  return std::sqrt(residualSquares(values, constants));
+}
+
+template <class T>
+MathVector<T> RedBlackSORSolver<T>::solve(const MathVector<T>& b,
+    int numDivs) const
+{
+  MathVector<T> zero(b.size());
+  return solve(b, numDivs, zero);
+}
+
+template <class T>
+MathVector<T> RedBlackSORSolver<T>::solve(const MathVector<T>& b,
+    int numDivs, const MathVector<T>& initialGuess) const
+{
+  checkSizes(initialGuess, b, numDivs);
+
+  ColouredGrid values(numDivs);
+  ColouredGrid constants(numDivs);
+  values.split(initialGuess);
+  constants.split(b);
+
+  T omega = omegaFor(numDivs);
+  T threshold = this->myTolerance * this->myTolerance * b.dotProduct(b);
+  size_t maxIterations = this->iterationLimit(b.size(), 10);
+  size_t& iterations = this->myIterations;
+  iterations = 0;
+
+  while (residualSquares(values, constants) > threshold)
+  {
+    if (iterations == maxIterations)
+    {
+      throw std::domain_error("Red-black SOR did not converge within the"
+          " iteration limit!");
+    }
+    ++iterations;
+    sweep(values, constants, 0, omega);
+    sweep(values, constants, 1, omega);
+  }
+
+  MathVector<T> x(b.size());
+  values.merge(x);
+  return x;
+}
@@ -0,0 +1,144 @@
+/*
+ * author Connor Walsh
+ * file   ReorderedSolver.h
+ * brief  Class which implements the IMatrixSolver interface by reordering
+ *        the unknowns before handing the system to another solver
+ */
+
+#ifndef REORDERED_SOLVER_H
+#define REORDERED_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+#include <memory>
+
+#include "IMatrixSolver.h"
+#include "IMatrixFactorization.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+#include "../math_matrix/MathMatrix.h"
+#include "../math_matrix/SparseMathMatrix.h"
+#include "../ordering/GraphOrdering.h"
+#include "../ordering/Permutation.h"
+
+/*
+ * class  ReorderedSolver
+ * brief  This class solves Ax = b as PAP^T Px = Pb, P being a bandwidth or
+ *        fill reducing permutation of the pattern of A, and hands the
+ *        permuted system to another solver. The solution is permuted back
+ *        before it is returned, so callers see the original numbering. The
+ *        bandwidth and profile of A before and after reordering are kept
+ *        for the last solve
+ */
+template <class T>
+class ReorderedSolver : public IMatrixSolver<T>
+{
+  public:
+    enum class Method { ReverseCuthillMcKee, MinimumDegree };
+
+    /*
+     * brief  Bandwidth and profile of the last matrix solved or factored,
+     *        as given by SparseMathMatrix, in the original and the permuted
+     *        numbering
+     */
+    struct Report
+    {
+      size_t bandwidthBefore;
+      size_t bandwidthAfter;
+      size_t profileBefore;
+      size_t profileAfter;
+    };
+
+    /*
+     * brief  Creates a solver passing reordered systems on to solver
+     * pre    solver must outlive this and any factorization it returns
+     */
+    ReorderedSolver(const IMatrixSolver<T>& solver,
+        Method method = Method::ReverseCuthillMcKee)
+      : mySolver(solver), myMethod(method), myReport() {}
+
+    /*
+     * brief  Returns the ordering this solver uses for the pattern of A
+     * pre    A must be square else exception is thrown
+     */
+    Permutation ordering(const SparseMathMatrix<T>& A) const;
+
+    /*
+     * brief  Returns the bandwidth and profile of the last system
+     */
+    const Report& report() const { return myReport; }
+
+    /*
+    * brief   Solves Ax = b. A is first copied into a SparseMathMatrix to
+    *         find its pattern
+    * pre     A must be square and b of size A.rows() else exception is
+    *         thrown, other requirements are those of the wrapped solver
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> operator()
+      (const IMathMatrix<T>& A, const MathVector<T>& b) const;
+
+    /*
+    * brief   Same as operator() without copying A
+    */
+    MathVector<T> solve(const SparseMathMatrix<T>& A,
+        const MathVector<T>& b) const;
+
+    /*
+    * brief   Reorders A and factors it with the wrapped solver
+    * pre     A must be square else exception is thrown
+    * post    returns a factorization which permutes each b before solving
+    *         and the solution back after
+    */
+    using IMatrixSolver<T>::factor;
+    virtual std::unique_ptr<IMatrixFactorization<T> >
+      factor(MathMatrix<T>&& A) const;
+    std::unique_ptr<IMatrixFactorization<T> >
+      factor(const SparseMathMatrix<T>& A) const;
+
+  private:
+    /*
+     * brief  Returns A reordered by permutation, recording the report
+     */
+    SparseMathMatrix<T> reorder(const SparseMathMatrix<T>& A,
+        const Permutation& permutation) const;
+
+    const IMatrixSolver<T>& mySolver;
+    Method myMethod;
+    mutable Report myReport;
+};
+
+/*
+ * class  ReorderedFactorization
+ * brief  Factorization of a reordered matrix which permutes each right hand
+ *        side into the reordered numbering and the solution back out of it
+ */
+template <class T>
+class ReorderedFactorization : public IMatrixFactorization<T>
+{
+  public:
+    ReorderedFactorization(const Permutation& permutation,
+        std::unique_ptr<IMatrixFactorization<T> > factored)
+      : myPermutation(permutation), myFactored(std::move(factored)) {}
+
+    virtual size_t rows() const { return myFactored->rows(); }
+    virtual size_t cols() const { return myFactored->cols(); }
+
+    using IMatrixFactorization<T>::solveInPlace;
+
+    virtual void solveInPlace(MathVector<T>& b) const
+    {
+      MathVector<T> permuted = myPermutation.apply(b);
+      myFactored->solveInPlace(permuted);
+      b = myPermutation.restore(permuted);
+    }
+
+  private:
+    Permutation myPermutation;
+    std::unique_ptr<IMatrixFactorization<T> > myFactored;
+};
+
+#include "ReorderedSolver.hpp"
+
+#endif
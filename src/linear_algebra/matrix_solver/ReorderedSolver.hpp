@@ -0,0 +1,73 @@
+/*
+ * author Connor Walsh
+ * file   ReorderedSolver.hpp
+ * brief  Implementation file for the ReorderedSolver class
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "ReorderedSolver.h"
+
+template <class T>
+Permutation ReorderedSolver<T>::ordering(const SparseMathMatrix<T>& A) const
+{
+  if (myMethod == Method::MinimumDegree)
+  {
+    return GraphOrdering::minimumDegree(A);
+  }
+  return GraphOrdering::reverseCuthillMcKee(A);
+}
+
+template <class T>
+SparseMathMatrix<T> ReorderedSolver<T>::reorder(const SparseMathMatrix<T>& A,
+    const Permutation& permutation) const
+{
+  SparseMathMatrix<T> result = A.permuted(permutation);
+  myReport.bandwidthBefore = A.bandwidth();
+  myReport.bandwidthAfter = result.bandwidth();
+  myReport.profileBefore = A.profile();
+  myReport.profileAfter = result.profile();
+  return result;
+}
+
+template <class T>
+MathVector<T> ReorderedSolver<T>::operator()
+  (const IMathMatrix<T>& A, const MathVector<T>& b) const
+{
+  return solve(SparseMathMatrix<T>(A), b);
+}
+
+template <class T>
+MathVector<T> ReorderedSolver<T>::solve(const SparseMathMatrix<T>& A,
+    const MathVector<T>& b) const
+{
+  if (A.rows() != b.size())
+  {
+    throw std::domain_error("Cannot solve system with a vector of incorrect"
+        " dimensions!");
+  }
+
+  Permutation permutation = ordering(A);
+  SparseMathMatrix<T> permuted = reorder(A, permutation);
+  const IMathMatrix<T>& reordered = permuted;
+  MathVector<T> permutedB = permutation.apply(b);
+  return permutation.restore(mySolver(reordered, permutedB));
+}
+
+template <class T>
+std::unique_ptr<IMatrixFactorization<T> >
+  ReorderedSolver<T>::factor(MathMatrix<T>&& A) const
+{
+  return factor(SparseMathMatrix<T>(A));
+}
+
+template <class T>
+std::unique_ptr<IMatrixFactorization<T> >
+  ReorderedSolver<T>::factor(const SparseMathMatrix<T>& A) const
+{
+  Permutation permutation = ordering(A);
+  SparseMathMatrix<T> permuted = reorder(A, permutation);
+  return std::unique_ptr<IMatrixFactorization<T> >(
+      new ReorderedFactorization<T>(permutation, mySolver.factor(permuted)));
+}
@@ -0,0 +1,135 @@
+/*
+ * author Connor Walsh
+ * file   SORSolver.h
+ * brief  Class which implements the IMatrixSolver interface using successive
+ *        over-relaxation
+ */
+
+#ifndef SOR_SOLVER_H
+#define SOR_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+#include <stdexcept>
+
+#include "IterativeSolver.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+#include "../math_matrix/MathMatrix.h"
+
+/*
+ * class  SORSolver
+ * brief  This class implements the IMatrixSolver interface with successive
+ *        over-relaxation. Each unknown is updated in order from the newest
+ *        values of the others and the change is scaled by the relaxation
+ *        factor omega, omega of one being Gauss-Seidel. An omega of zero
+ *        asks the solver to estimate the optimal factor for each matrix.
+ *        Sweeps continue until the residuals seen during a sweep meet the
+ *        tolerance, which is then confirmed against the true residual
+ *        b - Ax of the iterate
+ */
+template <class T>
+class SORSolver : public IterativeSolver<T>
+{
+  T myOmega;
+
+  private:
+    /*
+     * brief  Performs one SOR sweep on x in place
+     * pre    A is square with a nonzero diagonal, all vectors of its size
+     * post   x holds the new iterate, returns the squared norm of the
+     *        residuals seen while updating each unknown. Each was taken
+     *        against the unknowns already updated in the sweep, so this is
+     *        only an estimate of the residual of the new iterate
+     */
+    template <class Matrix>
+    static T sweep(const Matrix& A, const MathVector<T>& b, MathVector<T>& x,
+        T omega);
+
+    /*
+     * brief  Returns the squared norm of the residual b - Ax
+     */
+    template <class Matrix>
+    static T residualSquares(const Matrix& A, const MathVector<T>& b,
+        const MathVector<T>& x);
+
+  public:
+    /*
+     * brief  Creates a solver with a relaxation factor, a relative residual
+     *        tolerance and a limit on the number of sweeps
+     * pre    omega must be in [0, 2) else exception is thrown
+     * post   A maxIterations of zero allows 100 sweeps per unknown
+     */
+    SORSolver(T omega = 0, T tolerance = 1e-10, size_t maxIterations = 0)
+      : IterativeSolver<T>(tolerance, maxIterations), myOmega(0)
+    {
+      setOmega(omega);
+    }
+
+    /*
+     * brief  Function to change the relaxation factor
+     * pre    omega must be in [0, 2) else exception is thrown
+     * post   Later solves use omega, or an estimate if omega is zero
+     */
+    void setOmega(T omega);
+
+    /*
+     * brief  Returns the relaxation factor, zero meaning it is estimated
+     */
+    T omega() const { return myOmega; }
+
+    /*
+     * brief  Estimates the optimal relaxation factor 2 / (1 + sqrt(1 - r^2))
+     *        from the spectral radius r of the Jacobi iteration matrix of A,
+     *        which is found by power iteration
+     * pre    A is square with a nonzero diagonal
+     * post   returns a factor in [1, 2), one if Jacobi iteration would not
+     *        converge for A
+     */
+    template <class Matrix>
+    static T estimateOmega(const Matrix& A, size_t powerIterations = 50);
+
+    /*
+     * brief  Returns the optimal relaxation factor 2 / (1 + sin(pi h)) of
+     *        the five point Poisson operator on a grid of numDivs divisions
+     * pre    numDivs must be greater than 1
+     */
+    static T optimalPoissonOmega(int numDivs);
+
+    /*
+    * brief   Solves Ax = b starting from the zero vector
+    * pre     A must be square with a nonzero diagonal and b of size A.rows()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> operator()
+      (const IMathMatrix<T>& A, const MathVector<T>& b) const;
+
+    /*
+    * brief   Solves Ax = b starting from initialGuess
+    * pre     Same as operator() and initialGuess of size A.cols()
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> solveFrom(const IMathMatrix<T>& A,
+        const MathVector<T>& b, const MathVector<T>& initialGuess) const;
+    virtual MathVector<T> solveFrom(MathMatrix<T>&& A, MathVector<T>&& b,
+        const MathVector<T>& initialGuess) const;
+
+    /*
+    * brief   Statically dispatched versions of the function operator and
+    *         solveFrom. Matrix may be any concrete IMathMatrix type
+    * pre     Same as operator() and solveFrom
+    * post    returns the vector x in Ax = b. Throws an exception if the
+    *         diagonal has a zero or the tolerance is not met within the
+    *         iteration limit
+    */
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b) const;
+    template <class Matrix>
+    MathVector<T> solve(const Matrix& A, const MathVector<T>& b,
+        const MathVector<T>& initialGuess) const;
+};
+
+#include "SORSolver.hpp"
+
+#endif
@@ -0,0 +1,187 @@
+/*
+ * author Connor Walsh
+ * file   SORSolver.hpp
+ * brief  Implementation file for the SORSolver class
+ */
+
+#include <stdexcept>
+#include <cmath>
+
+#include "SORSolver.h"
+
+template <class T>
+template <class Matrix>
+T SORSolver<T>::sweep(const Matrix& A, const MathVector<T>& b,
+    MathVector<T>& x, T omega)
+{
+  T squares = 0;
+  for (size_t i = 0, size = b.size(); i < size; ++i)
+  {
+    T residual = b[i];
+    for (size_t j = 0; j < size; ++j)
+    {
+      residual -= A(i, j) * x[j];
+    }
+    x[i] += omega * residual / A(i, i);
+    squares += residual * residual;
+  }
+  return squares;
+}
+
+template <class T>
+template <class Matrix>
+T SORSolver<T>::residualSquares(const Matrix& A, const MathVector<T>& b,
+    const MathVector<T>& x)
+{
+  T squares = 0;
+  for (size_t i = 0, size = b.size(); i < size; ++i)
+  {
+    T residual = b[i];
+    for (size_t j = 0; j < size; ++j)
+    {
+      residual -= A(i, j) * x[j];
+    }
+    squares += residual * residual;
+  }
+  return squares;
+}
+
+template <class T>
+void SORSolver<T>::setOmega(T omega)
+{
+  if (omega < 0 || omega >= 2)
+  {
+    throw std::domain_error("SOR relaxation factor must be in [0, 2)!");
+  }
+  myOmega = omega;
+}
+
+template <class T>
+template <class Matrix>
+T SORSolver<T>::estimateOmega(const Matrix& A, size_t powerIterations)
+{
+  size_t size = A.rows();
+  MathVector<T> vector(size);
+  MathVector<T> next(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    vector[i] = 1;
+  }
+  vector *= 1 / vector.getMagnitude();
+
+  // The Jacobi matrix of a consistently ordered matrix has eigenvalues in
+  // pairs of +r and -r, so the growth over two steps is used
+  T growth = 0;
+  T previousGrowth = 0;
+  for (size_t step = 0; step < powerIterations; ++step)
+  {
+    for (size_t i = 0; i < size; ++i)
+    {
+      T sum = 0;
+      for (size_t j = 0; j < size; ++j)
+      {
+        if (j != i)
+        {
+          sum -= A(i, j) * vector[j];
+        }
+      }
+      next[i] = sum / A(i, i);
+    }
+
+    previousGrowth = growth;
+    growth = next.getMagnitude();
+    if (growth == 0)
+    {
+      return 1;
+    }
+    vector = next;
+    vector *= 1 / growth;
+  }
+
+  T radius = std::sqrt(growth * previousGrowth);
+  if (!(radius < 1))
+  {
+    return 1;
+  }
+  return 2 / (1 + std::sqrt(1 - radius * radius));
+}
+
+template <class T>
+T SORSolver<T>::optimalPoissonOmega(int numDivs)
+{
+  T pi = std::acos(T(-1));
+  return 2 / (1 + std::sin(pi / numDivs));
+}
+
+template <class T>
+MathVector<T> SORSolver<T>::operator()
+  (const IMathMatrix<T>& A, const MathVector<T>& b) const
+{
+  return solve(A, b);
+}
+
+template <class T>
+MathVector<T> SORSolver<T>::solveFrom(const IMathMatrix<T>& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+MathVector<T> SORSolver<T>::solveFrom(MathMatrix<T>&& A,
+    MathVector<T>&& b, const MathVector<T>& initialGuess) const
+{
+  return solve(A, b, initialGuess);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> SORSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b) const
+{
+  MathVector<T> zero(A.cols());
+  return solve(A, b, zero);
+}
+
+template <class T>
+template <class Matrix>
+MathVector<T> SORSolver<T>::solve(const Matrix& A,
+    const MathVector<T>& b, const MathVector<T>& initialGuess) const
+{
+  size_t size = b.size();
+  if (A.rows() != A.cols() || A.rows() != size || initialGuess.size() != size)
+  {
+    throw std::domain_error("Cannot perform SOR on matrix and vectors of"
+        " incorrect dimensions!");
+  }
+  for (size_t i = 0; i < size; ++i)
+  {
+    if (A(i, i) == 0)
+    {
+      throw std::domain_error("Cannot perform SOR on a matrix with a zero on"
+          " the diagonal!");
+    }
+  }
+
+  T omega = (myOmega == 0) ? estimateOmega(A) : myOmega;
+  MathVector<T> x(initialGuess);
+  T threshold = this->myTolerance * this->myTolerance * b.dotProduct(b);
+  size_t maxIterations = this->iterationLimit(size, 100);
+  size_t& iterations = this->myIterations;
+  iterations = 0;
+
+  // The true residual costs another pass over A, so it is only checked once
+  // the residuals seen during a sweep say the tolerance may be met
+  while (sweep(A, b, x, omega) > threshold ||
+      residualSquares(A, b, x) > threshold)
+  {
+    if (iterations == maxIterations)
+    {
+      throw std::domain_error("SOR did not converge within the iteration"
+          " limit!");
+    }
+    ++iterations;
+  }
+
+  return x;
+}
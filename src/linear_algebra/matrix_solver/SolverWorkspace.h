@@ -0,0 +1,89 @@
+/*
+ * author Connor Walsh
+ * file   SolverWorkspace.h
+ * brief  Resizable scratch storage that a solver keeps between solves
+ */
+
+#ifndef SOLVER_WORKSPACE_H
+#define SOLVER_WORKSPACE_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "../../containers/Array.h"
+#include "../MathVector.h"
+#include "../math_matrix/MathMatrix.h"
+
+/*
+ * class  SolverWorkspace
+ * brief  This class holds one matrix and a fixed number of vectors that a
+ *        solver copies its inputs into and uses for temporaries. Storage is
+ *        resized in place and reused from one solve to the next rather than
+ *        built anew each time, though resizing a matrix may still
+ *        reallocate its rows
+ */
+template <class T>
+class SolverWorkspace
+{
+  public:
+    static const size_t numVectors = 4;
+
+    /*
+     * brief  Creates an empty workspace of count vectors
+     * post   No storage is held and the high water mark is zero
+     */
+    explicit SolverWorkspace(size_t count = numVectors)
+      : myVectors(count), myHighWater(0) {}
+
+    /*
+     * brief  Returns the number of vector slots
+     */
+    size_t vectorCount() const { return myVectors.size(); }
+
+    /*
+     * brief  Returns the workspace matrix resized to [rows, cols]
+     * post   Returned matrix is of size [rows, cols] with unspecified values
+     */
+    MathMatrix<T>& matrix(size_t rows, size_t cols);
+
+    /*
+     * brief  Returns workspace vector number slot resized to size
+     * pre    slot must be less than vectorCount() else exception is thrown
+     * post   Returned vector has size elements with unspecified values
+     */
+    MathVector<T>& vector(size_t slot, size_t size);
+
+    /*
+     * brief  Returns the number of bytes of element storage currently held
+     * post   Returns the sum of the capacities of all workspace storage
+     */
+    size_t memoryBytes() const;
+
+    /*
+     * brief  Returns the largest value memoryBytes() has reached
+     * post   Returns the high water mark in bytes
+     */
+    size_t highWaterBytes() const;
+
+    /*
+     * brief  Releases all storage held by the workspace
+     * post   memoryBytes() is zero, the high water mark is unchanged
+     */
+    void release();
+
+  private:
+    /*
+     * brief  Updates the high water mark after storage may have grown
+     * post   myHighWater is at least memoryBytes()
+     */
+    void updateHighWater();
+
+    MathMatrix<T> myMatrix;
+    Array<MathVector<T> > myVectors;
+    size_t myHighWater;
+};
+
+#include "SolverWorkspace.hpp"
+
+#endif
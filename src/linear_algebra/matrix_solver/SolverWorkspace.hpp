@@ -0,0 +1,68 @@
+/*
+ * author Connor Walsh
+ * file   SolverWorkspace.hpp
+ * brief  Implementation file for the SolverWorkspace class
+ */
+
+#include "SolverWorkspace.h"
+
+template <class T>
+const size_t SolverWorkspace<T>::numVectors;
+
+template <class T>
+MathMatrix<T>& SolverWorkspace<T>::matrix(size_t rows, size_t cols)
+{
+  myMatrix.resize(rows, cols);
+  updateHighWater();
+  return myMatrix;
+}
+
+template <class T>
+MathVector<T>& SolverWorkspace<T>::vector(size_t slot, size_t size)
+{
+  MathVector<T>& result = myVectors.at(slot);
+  result.resize(size);
+  updateHighWater();
+  return result;
+}
+
+template <class T>
+size_t SolverWorkspace<T>::memoryBytes() const
+{
+  size_t bytes = 0;
+  for (int row = 0, numRows = myMatrix.getRows(); row < numRows; ++row)
+  {
+    bytes += myMatrix[row].capacity() * sizeof(T) + sizeof(MathVector<T>*);
+  }
+  for (const MathVector<T>& vector : myVectors)
+  {
+    bytes += vector.capacity() * sizeof(T);
+  }
+  return bytes;
+}
+
+template <class T>
+size_t SolverWorkspace<T>::highWaterBytes() const
+{
+  return myHighWater;
+}
+
+template <class T>
+void SolverWorkspace<T>::release()
+{
+  myMatrix = MathMatrix<T>();
+  for (MathVector<T>& vector : myVectors)
+  {
+    vector = MathVector<T>();
+  }
+}
+
+template <class T>
+void SolverWorkspace<T>::updateHighWater()
+{
+  size_t bytes = memoryBytes();
+  if (bytes > myHighWater)
+  {
+    myHighWater = bytes;
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * author Connor Walsh
+ * file   SparseCholeskyFactorization.h
+ * brief  Numeric supernodal Cholesky factorization of a sparse matrix
+ */
+
+#ifndef SPARSE_CHOLESKY_FACTORIZATION_H
+#define SPARSE_CHOLESKY_FACTORIZATION_H
+
+#pragma once
+
+#include <stddef.h>
+#include <memory>
+
+#include "IMatrixFactorization.h"
+#include "SymbolicCholesky.h"
+#include "../MathVector.h"
+#include "../math_matrix/SparseMathMatrix.h"
+
+/*
+ * class  SparseCholeskyFactorization
+ * brief  Holds the factor L of PAP^T = LL^T in the supernode blocks laid
+ *        out by a SymbolicCholesky. Supernodes are factored in order, each
+ *        one first factoring its own dense block and then subtracting its
+ *        outer product from the blocks of the later supernodes its rows
+ *        reach. The columns a supernode updates are spread across threads
+ *        and each is updated by one thread, so the factor is the same for
+ *        any thread count
+ */
+template <class T>
+class SparseCholeskyFactorization : public IMatrixFactorization<T>
+{
+  public:
+    /*
+     * brief  Factors A with the layout of symbolic
+     * pre    symbolic must be the analysis of the pattern of A and A must be
+     *        symmetric, storing both of its triangles with equal values,
+     *        else exception is thrown
+     * post   Throws an exception if A is found not to be positive definite
+     */
+    SparseCholeskyFactorization(std::shared_ptr<const SymbolicCholesky> symbolic,
+        const SparseMathMatrix<T>& A);
+
+    /*
+     * brief  Factors A again in place, reusing the symbolic analysis and the
+     *        storage of the current factor
+     * pre    Same as the constructor. When the analysis kept its pattern, A
+     *        must have exactly that pattern else exception is thrown
+     * post   The factor is that of A. If an exception is thrown the factor
+     *        may not be used until a later refactor succeeds
+     */
+    void refactor(const SparseMathMatrix<T>& A);
+
+    virtual size_t rows() const { return mySymbolic->size(); }
+    virtual size_t cols() const { return mySymbolic->size(); }
+
+    using IMatrixFactorization<T>::solveInPlace;
+
+    /*
+     * brief  Solves Ax = b in the storage of b by permuting b, substituting
+     *        forward through L and back through L^T, and permuting back
+     * pre    b must have size rows() else exception is thrown
+     * post   b holds the solution x
+     */
+    virtual void solveInPlace(MathVector<T>& b) const;
+
+    /*
+     * brief  Returns the symbolic analysis the factor is laid out by
+     */
+    const SymbolicCholesky& symbolic() const { return *mySymbolic; }
+
+    /*
+     * brief  Returns the supernode blocks of L, block s starting at
+     *        symbolic().valueStart(s)
+     */
+    const MathVector<T>& values() const { return myValues; }
+
+  private:
+    /*
+     * brief  Throws an exception unless every stored entry (i, j) of A has
+     *        a stored entry (j, i) of the same value. Only the lower
+     *        triangle is loaded, so anything else would factor a different
+     *        matrix than the one given
+     */
+    static void checkSymmetric(const SparseMathMatrix<T>& A);
+
+    /*
+     * brief  Scatters the lower triangle of PAP^T into the blocks, by the
+     *        scatter map of the analysis when it kept one
+     * pre    A must be symmetric else exception is thrown
+     */
+    void load(const SparseMathMatrix<T>& A);
+
+    /*
+     * brief  Factors the loaded blocks in place
+     */
+    void factorize();
+
+    std::shared_ptr<const SymbolicCholesky> mySymbolic;
+    MathVector<T> myValues;
+};
+
+#include "SparseCholeskyFactorization.hpp"
+
+#endif
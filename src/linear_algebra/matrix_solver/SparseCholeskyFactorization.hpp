@@ -0,0 +1,264 @@
+/*
+ * author Connor Walsh
+ * file   SparseCholeskyFactorization.hpp
+ * brief  Implementation file for the SparseCholeskyFactorization class
+ */
+
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "SparseCholeskyFactorization.h"
+#include "../../parallel/ThreadPool.h"
+
+template <class T>
+SparseCholeskyFactorization<T>::SparseCholeskyFactorization
+    (std::shared_ptr<const SymbolicCholesky> symbolic,
+     const SparseMathMatrix<T>& A) : mySymbolic(std::move(symbolic))
+{
+  load(A);
+  factorize();
+}
+
+template <class T>
+void SparseCholeskyFactorization<T>::refactor(const SparseMathMatrix<T>& A)
+{
+  load(A);
+  factorize();
+}
+
+template <class T>
+void SparseCholeskyFactorization<T>::checkSymmetric
+    (const SparseMathMatrix<T>& A)
+{
+  const std::vector<size_t>& rowStarts = A.rowStarts();
+  const std::vector<size_t>& columns = A.columnIndices();
+  const T* values = A.values().begin();
+  for (size_t r = 0; r < A.rows(); ++r)
+  {
+    for (size_t k = rowStarts[r]; k < rowStarts[r + 1]; ++k)
+    {
+      size_t c = columns[k];
+      if (c == r) continue;
+
+      std::vector<size_t>::const_iterator first =
+        columns.begin() + rowStarts[c];
+      std::vector<size_t>::const_iterator last =
+        columns.begin() + rowStarts[c + 1];
+      std::vector<size_t>::const_iterator entry =
+        std::lower_bound(first, last, r);
+      if (entry == last || *entry != r ||
+          values[entry - columns.begin()] != values[k])
+      {
+        throw std::domain_error("Cannot factor a matrix that is not"
+            " symmetric!");
+      }
+    }
+  }
+}
+
+template <class T>
+void SparseCholeskyFactorization<T>::load(const SparseMathMatrix<T>& A)
+{
+  const SymbolicCholesky& symbolic = *mySymbolic;
+  if (A.rows() != symbolic.size() || A.cols() != symbolic.size())
+  {
+    throw std::domain_error("Cannot factor a matrix of incorrect dimensions"
+        " for its symbolic analysis!");
+  }
+  checkSymmetric(A);
+
+  myValues.resize(symbolic.valueCount());
+  myValues.zero();
+
+  if (symbolic.hasPattern())
+  {
+    if (!symbolic.matches(A))
+    {
+      throw std::domain_error("Cannot factor a matrix whose pattern differs"
+          " from its symbolic analysis!");
+    }
+
+    const std::vector<size_t>& scatter = symbolic.scatter();
+    const T* values = A.values().begin();
+    T* factor = myValues.begin();
+    size_t skip = symbolic.valueCount();
+    for (size_t k = 0; k < scatter.size(); ++k)
+    {
+      if (scatter[k] != skip) factor[scatter[k]] += values[k];
+    }
+    return;
+  }
+
+  const Permutation& permutation = symbolic.permutation();
+  const std::vector<size_t>& rowStarts = A.rowStarts();
+  const std::vector<size_t>& columns = A.columnIndices();
+  const MathVector<T>& values = A.values();
+  for (size_t r = 0; r < A.rows(); ++r)
+  {
+    size_t i = permutation.position(r);
+    for (size_t k = rowStarts[r]; k < rowStarts[r + 1]; ++k)
+    {
+      size_t j = permutation.position(columns[k]);
+      if (i < j) continue;
+
+      size_t s = symbolic.supernodeOf(j);
+      size_t local = symbolic.localRow(s, i);
+      if (local == symbolic.rowCount(s))
+      {
+        throw std::domain_error("Cannot factor a matrix whose pattern differs"
+            " from its symbolic analysis!");
+      }
+      myValues[symbolic.valueStart(s) +
+        (j - symbolic.supernodeStart(s)) * symbolic.rowCount(s) + local] +=
+        values[k];
+    }
+  }
+}
+
+template <class T>
+void SparseCholeskyFactorization<T>::factorize()
+{
+  const SymbolicCholesky& symbolic = *mySymbolic;
+  T* values = myValues.begin();
+  std::vector<size_t> relative;
+
+  for (size_t s = 0; s < symbolic.numSupernodes(); ++s)
+  {
+    size_t numCols = symbolic.supernodeStart(s + 1) - symbolic.supernodeStart(s);
+    size_t numRows = symbolic.rowCount(s);
+    const size_t* rows = symbolic.rows(s);
+    T* block = values + symbolic.valueStart(s);
+
+    // Dense Cholesky of the supernode's own columns, the rows below being
+    // divided through as each column is finished
+    for (size_t c = 0; c < numCols; ++c)
+    {
+      T* column = block + c * numRows;
+      if (!(column[c] > 0))
+      {
+        throw std::domain_error("Cannot factor a matrix that is not positive"
+            " definite!");
+      }
+      T pivot = std::sqrt(column[c]);
+      column[c] = pivot;
+      for (size_t r = c + 1; r < numRows; ++r)
+      {
+        column[r] /= pivot;
+      }
+      for (size_t next = c + 1; next < numCols; ++next)
+      {
+        T* target = block + next * numRows;
+        T factor = column[next];
+        for (size_t r = next; r < numRows; ++r)
+        {
+          target[r] -= column[r] * factor;
+        }
+      }
+    }
+
+    // Rows below the supernode fall in runs of columns of later
+    // supernodes, each of which takes the outer product of the rows from
+    // that run down
+    relative.resize(numRows);
+    size_t p = numCols;
+    while (p < numRows)
+    {
+      size_t t = symbolic.supernodeOf(rows[p]);
+      size_t targetFirst = symbolic.supernodeStart(t);
+      size_t targetEnd = symbolic.supernodeStart(t + 1);
+      size_t q = p;
+      while (q < numRows && rows[q] < targetEnd) ++q;
+
+      // The rows of s from p on are a subset of the rows of t
+      size_t targetRows = symbolic.rowCount(t);
+      const size_t* targetRow = symbolic.rows(t);
+      for (size_t r = p, m = 0; r < numRows; ++r)
+      {
+        while (targetRow[m] != rows[r]) ++m;
+        relative[r] = m;
+      }
+
+      T* targetBlock = values + symbolic.valueStart(t);
+      parallelFor(p, q, ThreadPool::grainFor((numRows - p) * numCols),
+          [&](size_t firstColumn, size_t lastColumn)
+          {
+            for (size_t a = firstColumn; a < lastColumn; ++a)
+            {
+              T* target = targetBlock + (rows[a] - targetFirst) * targetRows;
+              for (size_t k = 0; k < numCols; ++k)
+              {
+                const T* column = block + k * numRows;
+                T factor = column[a];
+                if (factor == T(0)) continue;
+                for (size_t b = a; b < numRows; ++b)
+                {
+                  target[relative[b]] -= column[b] * factor;
+                }
+              }
+            }
+          });
+      p = q;
+    }
+  }
+}
+
+template <class T>
+void SparseCholeskyFactorization<T>::solveInPlace(MathVector<T>& b) const
+{
+  const SymbolicCholesky& symbolic = *mySymbolic;
+  if (b.size() != symbolic.size())
+  {
+    throw std::domain_error("Cannot solve factorization with a vector"
+        " of incorrect dimensions!");
+  }
+
+  MathVector<T> y = symbolic.permutation().apply(b);
+  T* x = y.begin();
+  const T* values = myValues.begin();
+  size_t numNodes = symbolic.numSupernodes();
+
+  // Forward through L
+  for (size_t s = 0; s < numNodes; ++s)
+  {
+    size_t first = symbolic.supernodeStart(s);
+    size_t numCols = symbolic.supernodeStart(s + 1) - first;
+    size_t numRows = symbolic.rowCount(s);
+    const size_t* rows = symbolic.rows(s);
+    const T* block = values + symbolic.valueStart(s);
+    for (size_t c = 0; c < numCols; ++c)
+    {
+      const T* column = block + c * numRows;
+      T value = x[first + c] / column[c];
+      x[first + c] = value;
+      for (size_t r = c + 1; r < numRows; ++r)
+      {
+        x[rows[r]] -= column[r] * value;
+      }
+    }
+  }
+
+  // Back through L^T
+  for (size_t s = numNodes; s-- > 0;)
+  {
+    size_t first = symbolic.supernodeStart(s);
+    size_t numCols = symbolic.supernodeStart(s + 1) - first;
+    size_t numRows = symbolic.rowCount(s);
+    const size_t* rows = symbolic.rows(s);
+    const T* block = values + symbolic.valueStart(s);
+    for (size_t c = numCols; c-- > 0;)
+    {
+      const T* column = block + c * numRows;
+      T sum = x[first + c];
+      for (size_t r = c + 1; r < numRows; ++r)
+      {
+        sum -= column[r] * x[rows[r]];
+      }
+      x[first + c] = sum / column[c];
+    }
+  }
+
+  b = symbolic.permutation().restore(y);
+}
@@ -0,0 +1,151 @@
+/*
+ * author Connor Walsh
+ * file   SparseCholeskySolver.h
+ * brief  Class which implements the IMatrixSolver interface with a sparse
+ *        supernodal Cholesky factorization
+ */
+
+#ifndef SPARSE_CHOLESKY_SOLVER_H
+#define SPARSE_CHOLESKY_SOLVER_H
+
+#pragma once
+
+#include <stddef.h>
+#include <memory>
+
+#include "IMatrixSolver.h"
+#include "IMatrixFactorization.h"
+#include "SparseCholeskyFactorization.h"
+#include "SymbolicCholesky.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+#include "../math_matrix/MathMatrix.h"
+#include "../math_matrix/SparseMathMatrix.h"
+#include "../ordering/Permutation.h"
+
+/*
+ * class  SparseCholeskySolver
+ * brief  This class implements the IMatrixSolver interface for sparse
+ *        symmetric positive definite matrices. A is reordered to limit the
+ *        fill of its factor, analyzed symbolically and then factored into
+ *        supernodes, so only the entries of L are stored and worked on.
+ *        Ordered by nested dissection, the factor of the Poisson operator on
+ *        an n point grid has O(n log n) entries and costs O(n^1.5) to
+ *        compute, so grids far beyond the reach of dense elimination can be
+ *        solved exactly. Matrices passed through the IMathMatrix interface
+ *        are first copied into a SparseMathMatrix, which costs O(n^2) to read.
+ *        The phases can also be run apart: analyze once, then factor and
+ *        refactor any number of matrices of that pattern. solve and factor
+ *        keep the last analysis and reuse it while the pattern is unchanged
+ */
+template <class T>
+class SparseCholeskySolver : public IMatrixSolver<T>
+{
+  public:
+    enum class Method
+    {
+      Natural, ReverseCuthillMcKee, MinimumDegree, NestedDissection
+    };
+
+    /*
+     * brief  Creates a solver ordering matrices by method
+     * pre    method may not be NestedDissection, which needs the grid
+     */
+    explicit SparseCholeskySolver(Method method = Method::MinimumDegree);
+
+    /*
+     * brief  Creates a solver for matrices of a gridWidth by gridHeight
+     *        grid of unknowns numbered as GraphOrdering::nestedDissection
+     *        numbers them, ordered by nested dissection
+     */
+    SparseCholeskySolver(size_t gridWidth, size_t gridHeight)
+      : myMethod(Method::NestedDissection), myGridWidth(gridWidth),
+        myGridHeight(gridHeight) {}
+
+    /*
+     * brief  Returns the ordering this solver uses for A
+     * pre    A must be square, and of the grid's size for nested dissection,
+     *        else exception is thrown
+     */
+    Permutation ordering(const SparseMathMatrix<T>& A) const;
+
+    /*
+     * brief  Orders A and analyzes its pattern
+     * pre    Same as ordering
+     * post   returns an analysis that may be shared by the factors of every
+     *        matrix of the pattern of A
+     */
+    std::shared_ptr<const SymbolicCholesky>
+      analyze(const SparseMathMatrix<T>& A) const;
+
+    /*
+     * brief  Factors A with an analysis from analyze, skipping the ordering
+     *        and symbolic phases
+     * pre    A must have the pattern symbolic was made from and be symmetric
+     *        positive definite else exception is thrown
+     * post   returns the factorization, which can be refactored in place
+     */
+    std::unique_ptr<SparseCholeskyFactorization<T> >
+      factor(std::shared_ptr<const SymbolicCholesky> symbolic,
+          const SparseMathMatrix<T>& A) const;
+
+    /*
+    * brief   Solves Ax = b
+    * pre     A must be symmetric positive definite and b of size A.rows()
+    *         else exception is thrown
+    * post    returns the vector x in Ax = b
+    */
+    virtual MathVector<T> operator()
+      (const IMathMatrix<T>& A, const MathVector<T>& b) const;
+
+    /*
+    * brief   Same as operator() without copying A
+    * pre     A must store both of its triangles
+    */
+    MathVector<T> solve(const SparseMathMatrix<T>& A,
+        const MathVector<T>& b) const;
+
+    /*
+    * brief   Orders, analyzes and factors A once so it can be solved
+    *         against many b
+    * pre     Same as solve
+    * post    returns a SparseCholeskyFactorization
+    */
+    using IMatrixSolver<T>::factor;
+    virtual std::unique_ptr<IMatrixFactorization<T> >
+      factor(MathMatrix<T>&& A) const;
+    std::unique_ptr<IMatrixFactorization<T> >
+      factor(const SparseMathMatrix<T>& A) const;
+
+    /*
+     * brief  Returns the analysis kept from the last solve or factor, null
+     *        if there is none
+     */
+    std::shared_ptr<const SymbolicCholesky> lastAnalysis() const
+    {
+      return myLastAnalysis;
+    }
+
+    /*
+     * brief  Discards the kept analysis
+     * post   The next solve or factor analyzes its matrix again
+     */
+    void clearAnalysisCache() { myLastAnalysis.reset(); }
+
+  private:
+    /*
+     * brief  Returns the kept analysis if A matches its pattern, else
+     *        analyzes A and keeps the result
+     */
+    std::shared_ptr<const SymbolicCholesky>
+      cachedAnalysis(const SparseMathMatrix<T>& A) const;
+
+    Method myMethod;
+    size_t myGridWidth;
+    size_t myGridHeight;
+    mutable std::shared_ptr<const SymbolicCholesky> myLastAnalysis;
+};
+
+#include "SparseCholeskySolver.hpp"
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ * author Connor Walsh
+ * file   SparseCholeskySolver.hpp
+ * brief  Implementation file for the SparseCholeskySolver class
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "SparseCholeskySolver.h"
+#include "../ordering/GraphOrdering.h"
+
+template <class T>
+SparseCholeskySolver<T>::SparseCholeskySolver(Method method)
+  : myMethod(method), myGridWidth(0), myGridHeight(0)
+{
+  if (method == Method::NestedDissection)
+  {
+    throw std::domain_error("Cannot order by nested dissection without the"
+        " dimensions of the grid!");
+  }
+}
+
+template <class T>
+Permutation SparseCholeskySolver<T>::ordering
+    (const SparseMathMatrix<T>& A) const
+{
+  if (A.rows() != A.cols())
+  {
+    throw std::domain_error("Cannot order a matrix that is not square!");
+  }
+
+  switch (myMethod)
+  {
+    case Method::ReverseCuthillMcKee:
+      return GraphOrdering::reverseCuthillMcKee(A);
+    case Method::MinimumDegree:
+      return GraphOrdering::minimumDegree(A);
+    case Method::NestedDissection:
+      if (myGridWidth * myGridHeight != A.rows())
+      {
+        throw std::domain_error("Cannot order a matrix by nested dissection"
+            " of a grid of a different size!");
+      }
+      return GraphOrdering::nestedDissection(myGridWidth, myGridHeight);
+    default:
+      return Permutation(A.rows());
+  }
+}
+
+template <class T>
+std::shared_ptr<const SymbolicCholesky> SparseCholeskySolver<T>::analyze
+    (const SparseMathMatrix<T>& A) const
+{
+  return std::make_shared<const SymbolicCholesky>(A, ordering(A));
+}
+
+template <class T>
+std::shared_ptr<const SymbolicCholesky> SparseCholeskySolver<T>::cachedAnalysis
+    (const SparseMathMatrix<T>& A) const
+{
+  if (!myLastAnalysis || !myLastAnalysis->matches(A))
+  {
+    myLastAnalysis = analyze(A);
+  }
+  return myLastAnalysis;
+}
+
+template <class T>
+std::unique_ptr<SparseCholeskyFactorization<T> >
+  SparseCholeskySolver<T>::factor
+    (std::shared_ptr<const SymbolicCholesky> symbolic,
+     const SparseMathMatrix<T>& A) const
+{
+  return std::unique_ptr<SparseCholeskyFactorization<T> >(
+      new SparseCholeskyFactorization<T>(std::move(symbolic), A));
+}
+
+template <class T>
+MathVector<T> SparseCholeskySolver<T>::operator()
+  (const IMathMatrix<T>& A, const MathVector<T>& b) const
+{
+  return solve(SparseMathMatrix<T>(A), b);
+}
+
+template <class T>
+MathVector<T> SparseCholeskySolver<T>::solve(const SparseMathMatrix<T>& A,
+    const MathVector<T>& b) const
+{
+  if (A.rows() != b.size())
+  {
+    throw std::domain_error("Cannot solve system with a vector of incorrect"
+        " dimensions!");
+  }
+
+  SparseCholeskyFactorization<T> factored(cachedAnalysis(A), A);
+  return factored.solve(b);
+}
+
+template <class T>
+std::unique_ptr<IMatrixFactorization<T> >
+  SparseCholeskySolver<T>::factor(MathMatrix<T>&& A) const
+{
+  return factor(SparseMathMatrix<T>(A));
+}
+
+template <class T>
+std::unique_ptr<IMatrixFactorization<T> >
+  SparseCholeskySolver<T>::factor(const SparseMathMatrix<T>& A) const
+{
+  return std::unique_ptr<IMatrixFactorization<T> >(
+      new SparseCholeskyFactorization<T>(cachedAnalysis(A), A));
+}
@@ -0,0 +1,173 @@
+/*
+ * author Connor Walsh
+ * file   SymbolicCholesky.h
+ * brief  Symbolic analysis of a sparse Cholesky factorization
+ */
+
+#ifndef SYMBOLIC_CHOLESKY_H
+#define SYMBOLIC_CHOLESKY_H
+
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include "../math_matrix/SparseMathMatrix.h"
+#include "../ordering/GraphOrdering.h"
+#include "../ordering/Permutation.h"
+
+/*
+ * class  SymbolicCholesky
+ * brief  This class holds everything about the Cholesky factor L of a
+ *        reordered symmetric matrix that depends only on its pattern. The
+ *        given ordering is followed by a postorder of the elimination tree,
+ *        which does not change the fill but makes each supernode, a run of
+ *        columns of L sharing one row pattern below the diagonal, a range
+ *        of consecutive columns. Supernode s covers columns
+ *        [supernodeStart(s), supernodeStart(s + 1)) and stores its rows,
+ *        own columns first, as a dense column major block of
+ *        rowCount(s) rows starting at valueStart(s)
+ */
+class SymbolicCholesky
+{
+  public:
+    /*
+     * brief  Analyzes the pattern of A reordered by ordering
+     * pre    A must be square with a symmetric pattern and ordering of size
+     *        A.rows() else exception is thrown
+     * post   The pattern of A is kept along with where each of its entries
+     *        lands in the factor, so matrices of the same pattern can be
+     *        factored without searching the supernodes. An analysis of a
+     *        graph keeps no pattern
+     */
+    template <class T>
+    SymbolicCholesky(const SparseMathMatrix<T>& A, const Permutation& ordering);
+    SymbolicCholesky(const GraphOrdering::Graph& graph,
+        const Permutation& ordering);
+
+    /*
+     * brief  Returns true if the analysis kept a pattern and A has exactly
+     *        that pattern, its values being free to differ
+     */
+    template <class T>
+    bool matches(const SparseMathMatrix<T>& A) const;
+
+    /*
+     * brief  Returns true if the analysis kept the pattern it was made from
+     */
+    bool hasPattern() const { return !myPatternStarts.empty(); }
+
+    /*
+     * brief  Returns, for every stored entry of the kept pattern in row
+     *        order, its offset among the values of the numeric factor, or
+     *        valueCount() for entries above the diagonal of PAP^T, which the
+     *        factor does not read
+     */
+    const std::vector<size_t>& scatter() const { return myScatter; }
+
+    /*
+     * brief  Returns the number of unknowns
+     */
+    size_t size() const { return myParent.size(); }
+
+    /*
+     * brief  Returns the ordering of the factor, the given ordering followed
+     *        by the postorder
+     */
+    const Permutation& permutation() const { return myPermutation; }
+
+    /*
+     * brief  Returns the parent of every column in the elimination tree, in
+     *        the numbering of permutation(). Roots have parent size()
+     */
+    const std::vector<size_t>& parents() const { return myParent; }
+
+    /*
+     * brief  Returns the number of entries in every column of L, diagonal
+     *        included
+     */
+    const std::vector<size_t>& columnCounts() const { return myColumnCounts; }
+
+    size_t numSupernodes() const { return mySupernodeStarts.size() - 1; }
+    size_t supernodeStart(size_t s) const { return mySupernodeStarts[s]; }
+    size_t supernodeOf(size_t column) const { return mySupernodeOf[column]; }
+
+    /*
+     * brief  Returns the number of rows of supernode s and a pointer to
+     *        them in increasing order
+     */
+    size_t rowCount(size_t s) const
+    {
+      return myRowStarts[s + 1] - myRowStarts[s];
+    }
+    const size_t* rows(size_t s) const { return &myRows[myRowStarts[s]]; }
+
+    /*
+     * brief  Returns the offset of the block of supernode s among the
+     *        values of the numeric factor
+     */
+    size_t valueStart(size_t s) const { return myValueStarts[s]; }
+
+    /*
+     * brief  Returns the number of values the numeric factor stores, which
+     *        includes the zeros above the diagonal of each supernode block
+     */
+    size_t valueCount() const { return myValueStarts.back(); }
+
+    /*
+     * brief  Returns the number of entries of L on or below the diagonal
+     */
+    size_t factorNonZeros() const;
+
+    /*
+     * brief  Returns the position of row among the rows of supernode s
+     * post   returns rowCount(s) if row is not one of them
+     */
+    size_t localRow(size_t s, size_t row) const;
+
+  private:
+    /*
+     * brief  Returns the pattern strictly below the diagonal of every row
+     *        of the graph's matrix reordered by permutation, each sorted
+     */
+    static GraphOrdering::Graph lowerRows(const GraphOrdering::Graph& graph,
+        const Permutation& permutation);
+
+    /*
+     * brief  Returns the elimination tree of the matrix with the given
+     *        lower rows, found with path compression
+     */
+    static std::vector<size_t> eliminationTree
+      (const GraphOrdering::Graph& lower);
+
+    /*
+     * brief  Returns the columns of the tree in postorder, children in
+     *        increasing order before their parent
+     */
+    static std::vector<size_t> postorder(const std::vector<size_t>& parent);
+
+    void analyze(const GraphOrdering::Graph& graph, const Permutation& ordering);
+
+    /*
+     * brief  Keeps the pattern with the given row starts and columns and
+     *        finds where each of its entries lands in the factor
+     */
+    void keepPattern(const std::vector<size_t>& rowStarts,
+        const std::vector<size_t>& columns);
+
+    Permutation myPermutation;
+    std::vector<size_t> myParent;
+    std::vector<size_t> myColumnCounts;
+    std::vector<size_t> mySupernodeStarts;
+    std::vector<size_t> mySupernodeOf;
+    std::vector<size_t> myRowStarts;
+    std::vector<size_t> myRows;
+    std::vector<size_t> myValueStarts;
+    std::vector<size_t> myPatternStarts;
+    std::vector<size_t> myPatternColumns;
+    std::vector<size_t> myScatter;
+};
+
+#include "SymbolicCholesky.hpp"
+
+#endif
@@ -0,0 +1,289 @@
+/*
+ * author Connor Walsh
+ * file   SymbolicCholesky.hpp
+ * brief  Implementation file for the SymbolicCholesky class
+ */
+
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+
+#include "SymbolicCholesky.h"
+
+template <class T>
+SymbolicCholesky::SymbolicCholesky(const SparseMathMatrix<T>& A,
+    const Permutation& ordering)
+{
+  analyze(GraphOrdering::graphOf(A), ordering);
+  keepPattern(A.rowStarts(), A.columnIndices());
+}
+
+template <class T>
+bool SymbolicCholesky::matches(const SparseMathMatrix<T>& A) const
+{
+  return hasPattern() && A.rows() == size() && A.cols() == size() &&
+    A.rowStarts() == myPatternStarts && A.columnIndices() == myPatternColumns;
+}
+
+inline SymbolicCholesky::SymbolicCholesky(const GraphOrdering::Graph& graph,
+    const Permutation& ordering)
+{
+  analyze(graph, ordering);
+}
+
+inline GraphOrdering::Graph SymbolicCholesky::lowerRows
+    (const GraphOrdering::Graph& graph, const Permutation& permutation)
+{
+  GraphOrdering::Graph lower(graph.size());
+  for (size_t k = 0; k < graph.size(); ++k)
+  {
+    for (size_t neighbour : graph[permutation.order(k)])
+    {
+      size_t j = permutation.position(neighbour);
+      if (j < k) lower[k].push_back(j);
+    }
+    std::sort(lower[k].begin(), lower[k].end());
+  }
+  return lower;
+}
+
+inline std::vector<size_t> SymbolicCholesky::eliminationTree
+    (const GraphOrdering::Graph& lower)
+{
+  size_t size = lower.size();
+  std::vector<size_t> parent(size, size);
+  std::vector<size_t> ancestor(size, size);
+
+  // Row i joins the subtrees of its entries under i, ancestor short cutting
+  // the walk up to the current root of each subtree
+  for (size_t i = 0; i < size; ++i)
+  {
+    for (size_t k : lower[i])
+    {
+      size_t node = k;
+      while (ancestor[node] != size && ancestor[node] != i)
+      {
+        size_t next = ancestor[node];
+        ancestor[node] = i;
+        node = next;
+      }
+      if (ancestor[node] == size)
+      {
+        ancestor[node] = i;
+        parent[node] = i;
+      }
+    }
+  }
+  return parent;
+}
+
+inline std::vector<size_t> SymbolicCholesky::postorder
+    (const std::vector<size_t>& parent)
+{
+  size_t size = parent.size();
+  std::vector<std::vector<size_t> > children(size);
+  std::vector<size_t> roots;
+  for (size_t j = 0; j < size; ++j)
+  {
+    if (parent[j] == size) roots.push_back(j);
+    else children[parent[j]].push_back(j);
+  }
+
+  std::vector<size_t> order;
+  order.reserve(size);
+  std::vector<std::pair<size_t, size_t> > stack;
+  for (size_t root : roots)
+  {
+    stack.push_back(std::make_pair(root, 0));
+    while (!stack.empty())
+    {
+      std::pair<size_t, size_t>& top = stack.back();
+      if (top.second < children[top.first].size())
+      {
+        size_t child = children[top.first][top.second++];
+        stack.push_back(std::make_pair(child, 0));
+      }
+      else
+      {
+        order.push_back(top.first);
+        stack.pop_back();
+      }
+    }
+  }
+  return order;
+}
+
+inline void SymbolicCholesky::analyze(const GraphOrdering::Graph& graph,
+    const Permutation& ordering)
+{
+  size_t size = graph.size();
+  if (ordering.size() != size)
+  {
+    throw std::domain_error("Cannot analyze a matrix with an ordering of"
+        " incorrect size!");
+  }
+
+  // Postorder the elimination tree of the given ordering and work in the
+  // combined ordering from then on
+  std::vector<size_t> post =
+    postorder(eliminationTree(lowerRows(graph, ordering)));
+  std::vector<size_t> order(size);
+  for (size_t k = 0; k < size; ++k)
+  {
+    order[k] = ordering.order(post[k]);
+  }
+  myPermutation = Permutation(std::move(order));
+
+  GraphOrdering::Graph lower = lowerRows(graph, myPermutation);
+  myParent = eliminationTree(lower);
+
+  // Row i of L is the union of the tree paths from each entry of row i of
+  // A up to i, each column on the way gaining an entry in row i
+  myColumnCounts.assign(size, 1);
+  std::vector<size_t> mark(size, size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    mark[i] = i;
+    for (size_t k : lower[i])
+    {
+      for (size_t j = k; mark[j] != i; j = myParent[j])
+      {
+        ++myColumnCounts[j];
+        mark[j] = i;
+      }
+    }
+  }
+
+  // Fundamental supernodes, a column joining the one before it when it is
+  // that column's parent, its only child, and has the same pattern below
+  std::vector<size_t> numChildren(size, 0);
+  for (size_t j = 0; j < size; ++j)
+  {
+    if (myParent[j] != size) ++numChildren[myParent[j]];
+  }
+  mySupernodeStarts.assign(1, 0);
+  for (size_t j = 1; j < size; ++j)
+  {
+    if (myParent[j - 1] != j || numChildren[j] != 1 ||
+        myColumnCounts[j - 1] != myColumnCounts[j] + 1)
+    {
+      mySupernodeStarts.push_back(j);
+    }
+  }
+  if (size > 0) mySupernodeStarts.push_back(size);
+
+  size_t numNodes = numSupernodes();
+  mySupernodeOf.assign(size, 0);
+  for (size_t s = 0; s < numNodes; ++s)
+  {
+    for (size_t j = mySupernodeStarts[s]; j < mySupernodeStarts[s + 1]; ++j)
+    {
+      mySupernodeOf[j] = s;
+    }
+  }
+
+  // Entries of A below the diagonal by column, and the supernode tree
+  GraphOrdering::Graph lowerColumns(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    for (size_t k : lower[i])
+    {
+      lowerColumns[k].push_back(i);
+    }
+  }
+  std::vector<std::vector<size_t> > childNodes(numNodes);
+  for (size_t s = 0; s < numNodes; ++s)
+  {
+    size_t parent = myParent[mySupernodeStarts[s + 1] - 1];
+    if (parent != size) childNodes[mySupernodeOf[parent]].push_back(s);
+  }
+
+  // The rows of a supernode below its own columns are those of A in its
+  // columns together with those of its children, children coming first in
+  // the postorder
+  myRowStarts.assign(1, 0);
+  myRows.clear();
+  myValueStarts.assign(1, 0);
+  std::vector<size_t> seen(size, numNodes);
+  std::vector<size_t> below;
+  for (size_t s = 0; s < numNodes; ++s)
+  {
+    size_t first = mySupernodeStarts[s];
+    size_t end = mySupernodeStarts[s + 1];
+    below.clear();
+    for (size_t j = first; j < end; ++j)
+    {
+      for (size_t i : lowerColumns[j])
+      {
+        if (i >= end && seen[i] != s)
+        {
+          seen[i] = s;
+          below.push_back(i);
+        }
+      }
+    }
+    for (size_t child : childNodes[s])
+    {
+      const size_t* childRows = rows(child);
+      for (size_t r = 0, count = rowCount(child); r < count; ++r)
+      {
+        size_t i = childRows[r];
+        if (i >= end && seen[i] != s)
+        {
+          seen[i] = s;
+          below.push_back(i);
+        }
+      }
+    }
+    std::sort(below.begin(), below.end());
+
+    for (size_t j = first; j < end; ++j)
+    {
+      myRows.push_back(j);
+    }
+    myRows.insert(myRows.end(), below.begin(), below.end());
+    myRowStarts.push_back(myRows.size());
+    myValueStarts.push_back(myValueStarts.back() +
+        (end - first) * rowCount(s));
+  }
+}
+
+inline size_t SymbolicCholesky::factorNonZeros() const
+{
+  size_t result = 0;
+  for (size_t j = 0; j < size(); ++j)
+  {
+    result += myColumnCounts[j];
+  }
+  return result;
+}
+
+inline size_t SymbolicCholesky::localRow(size_t s, size_t row) const
+{
+  const size_t* first = rows(s);
+  const size_t* last = first + rowCount(s);
+  const size_t* entry = std::lower_bound(first, last, row);
+  if (entry == last || *entry != row) return rowCount(s);
+  return entry - first;
+}
+
+inline void SymbolicCholesky::keepPattern(const std::vector<size_t>& rowStarts,
+    const std::vector<size_t>& columns)
+{
+  myPatternStarts = rowStarts;
+  myPatternColumns = columns;
+  myScatter.assign(columns.size(), valueCount());
+  for (size_t r = 0; r + 1 < rowStarts.size(); ++r)
+  {
+    size_t i = myPermutation.position(r);
+    for (size_t k = rowStarts[r]; k < rowStarts[r + 1]; ++k)
+    {
+      size_t j = myPermutation.position(columns[k]);
+      if (i < j) continue;
+
+      size_t s = mySupernodeOf[j];
+      myScatter[k] = myValueStarts[s] +
+        (j - mySupernodeStarts[s]) * rowCount(s) + localRow(s, i);
+    }
+  }
+}
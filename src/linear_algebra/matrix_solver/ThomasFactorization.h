@@ -0,0 +1,85 @@
+/*
+ * author Connor Walsh
+ * file   ThomasFactorization.h
+ * brief  Factorization produced by ThomasSolver::factor
+ */
+
+#ifndef THOMAS_FACTORIZATION_H
+#define THOMAS_FACTORIZATION_H
+
+#pragma once
+
+#include <stddef.h>
+
+#include "IMatrixFactorization.h"
+#include "../MathVector.h"
+#include "../math_matrix/MathMatrix.h"
+#include "../math_matrix/TriDiagonalMathMatrix.h"
+
+/*
+ * class  ThomasFactorization
+ * brief  Holds the forward elimination of a tridiagonal matrix without
+ *        pivoting: the reciprocal of each pivot and the upper diagonal
+ *        divided by its pivot. Solving costs O(n) per right hand side.
+ *        Besides the IMatrixFactorization interface it solves raw storage,
+ *        one contiguous system or many right hand sides laid out lane by
+ *        lane, for callers such as line relaxation that keep their own grids
+ */
+template <class T>
+class ThomasFactorization : public IMatrixFactorization<T>
+{
+  public:
+    /*
+     * brief  Eliminates A
+     * post   Throws an exception if a zero pivot is encountered, which
+     *        cannot happen for diagonally dominant or symmetric positive
+     *        definite A
+     */
+    explicit ThomasFactorization(const TriDiagonalMathMatrix<T>& A);
+
+    virtual size_t rows() const { return myInverse.size(); }
+    virtual size_t cols() const { return myInverse.size(); }
+
+    /*
+     * brief  Solves Ax = b in the storage of b
+     * pre    b must have size rows() else exception is thrown
+     * post   b holds the solution x
+     */
+    virtual void solveInPlace(MathVector<T>& b) const;
+
+    /*
+     * brief  Solves AX = B for every column of B in the storage of B a row
+     *        at a time, over blocks of columns in parallel. Each column gets
+     *        exactly the result the vector solve would give
+     * pre    B must have rows() rows else exception is thrown
+     * post   B holds X
+     */
+    virtual void solveInPlace(MathMatrix<T>& B) const;
+
+    /*
+     * brief  Solves Ax = b in place on rows() consecutive values
+     * pre    values must point at rows() values
+     * post   values holds x
+     */
+    void solveInPlace(T* values) const;
+
+    /*
+     * brief  Solves the right hand sides in lanes [firstLane, lastLane) of
+     *        values, entry i of lane l being values[i * stride + l]. Every
+     *        step is a loop over consecutive lanes
+     * pre    values must hold rows() rows of stride values
+     * post   the lanes hold their solutions, each exactly as the vector
+     *        solve would give it
+     */
+    void solveLanes(T* values, size_t stride, size_t firstLane,
+        size_t lastLane) const;
+
+  private:
+    MathVector<T> myLower;
+    MathVector<T> myInverse;
+    MathVector<T> myUpper;
+};
+
+#include "ThomasFactorization.hpp"
+
+#endif
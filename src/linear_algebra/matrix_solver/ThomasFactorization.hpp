@@ -0,0 +1,148 @@
+/*
+ * author Connor Walsh
+ * file   ThomasFactorization.hpp
+ * brief  Implementation file for the ThomasFactorization class
+ */
+
+#include <stdexcept>
+
+#include "ThomasFactorization.h"
+#include "../../parallel/ThreadPool.h"
+
+template <class T>
+ThomasFactorization<T>::ThomasFactorization(const TriDiagonalMathMatrix<T>& A)
+  : myLower(A.lower()), myInverse(A.rows()), myUpper(A.rows())
+{
+  const MathVector<T>& diagonal = A.diagonal();
+  const MathVector<T>& upper = A.upper();
+  for (size_t i = 0, size = A.rows(); i < size; ++i)
+  {
+    T pivot = (i == 0) ? diagonal[0] :
+        diagonal[i] - myLower[i] * myUpper[i - 1];
+    if (pivot == 0)
+    {
+      throw std::domain_error("Divide by zero encountered in the Thomas"
+          " algorithm!");
+    }
+    myInverse[i] = 1 / pivot;
+    myUpper[i] = upper[i] * myInverse[i];
+  }
+}
+
+template <class T>
+void ThomasFactorization<T>::solveInPlace(MathVector<T>& b) const
+{
+  if (b.size() != rows())
+  {
+    throw std::domain_error("Cannot solve factorization with a vector"
+        " of incorrect dimensions!");
+  }
+  if (b.size() > 0)
+  {
+    solveInPlace(&b[0]);
+  }
+}
+
+template <class T>
+void ThomasFactorization<T>::solveInPlace(T* values) const
+{
+  int size = rows();
+  if (size == 0)
+  {
+    return;
+  }
+
+  values[0] *= myInverse[0];
+  for (int i = 1; i < size; ++i)
+  {
+    values[i] = (values[i] - myLower[i] * values[i - 1]) * myInverse[i];
+  }
+  for (int i = size - 2; i >= 0; --i)
+  {
+    values[i] -= myUpper[i] * values[i + 1];
+  }
+}
+
+template <class T>
+void ThomasFactorization<T>::solveLanes(T* values, size_t stride,
+    size_t firstLane, size_t lastLane) const
+{
+  int size = rows();
+  if (size == 0)
+  {
+    return;
+  }
+
+  T* row = values + firstLane;
+  size_t width = lastLane - firstLane;
+  for (size_t lane = 0; lane < width; ++lane)
+  {
+    row[lane] *= myInverse[0];
+  }
+  for (int i = 1; i < size; ++i)
+  {
+    T* current = values + i * stride + firstLane;
+    const T* previous = current - stride;
+    T lower = myLower[i];
+    T inverse = myInverse[i];
+    for (size_t lane = 0; lane < width; ++lane)
+    {
+      current[lane] = (current[lane] - lower * previous[lane]) * inverse;
+    }
+  }
+  for (int i = size - 2; i >= 0; --i)
+  {
+    T* current = values + i * stride + firstLane;
+    const T* next = current + stride;
+    T upper = myUpper[i];
+    for (size_t lane = 0; lane < width; ++lane)
+    {
+      current[lane] -= upper * next[lane];
+    }
+  }
+}
+
+template <class T>
+void ThomasFactorization<T>::solveInPlace(MathMatrix<T>& B) const
+{
+  if (B.rows() != rows())
+  {
+    throw std::domain_error("Cannot solve factorization with a matrix"
+        " of incorrect dimensions!");
+  }
+
+  // Rows of B are separate vectors, so the lane loops are written against
+  // them rather than through solveLanes
+  int size = rows();
+  if (size == 0)
+  {
+    return;
+  }
+  parallelFor(0, B.cols(), ThreadPool::grainFor(4 * size),
+      [&](size_t firstCol, size_t lastCol)
+      {
+        for (size_t col = firstCol; col < lastCol; ++col)
+        {
+          B[0][col] *= myInverse[0];
+        }
+        for (int i = 1; i < size; ++i)
+        {
+          MathVector<T>& current = B[i];
+          const MathVector<T>& previous = B[i - 1];
+          for (size_t col = firstCol; col < lastCol; ++col)
+          {
+            current[col] = (current[col] - myLower[i] * previous[col]) *
+              myInverse[i];
+          }
+        }
+        for (int i = size - 2; i >= 0; --i)
+        {
+          MathVector<T>& current = B[i];
+          const MathVector<T>& next = B[i + 1];
+          for (size_t col = firstCol; col < lastCol; ++col)
+          {
+            current[col] -= myUpper[i] * next[col];
+          }
+        }
+      });
+}
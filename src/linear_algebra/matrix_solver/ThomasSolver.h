@@ -0,0 +1,68 @@
+/*
+ * author Connor Walsh
+ * file   ThomasSolver.h
+ * brief  Class which implements the IMatrixSolver interface for tridiagonal
+ *        matrices using the Thomas algorithm
+ */
+
+#ifndef THOMAS_SOLVER_H
+#define THOMAS_SOLVER_H
+
+#pragma once
+
+#include <memory>
+
+#include "IMatrixSolver.h"
+#include "ThomasFactorization.h"
+#include "../MathVector.h"
+#include "../math_matrix/IMathMatrix.h"
+#include "../math_matrix/MathMatrix.h"
+#include "../math_matrix/TriDiagonalMathMatrix.h"
+
+/*
+ * class  ThomasSolver
+ * brief  This class implements the IMatrixSolver interface with the Thomas
+ *        algorithm, Gaussian elimination without pivoting specialised to
+ *        tridiagonal matrices, in O(n). It is stable for diagonally dominant
+ *        and symmetric positive definite matrices. Matrices passed through
+ *        the IMathMatrix interface are first copied into a
+ *        TriDiagonalMathMatrix, which costs O(n^2) to read
+ */
+template <class T>
+class ThomasSolver : public IMatrixSolver<T>
+{
+  public:
+    /*
+    * brief   Solves Ax = b
+    * pre     A must be square and tridiagonal and b of size A.rows() else
+    *         exception is thrown
+    * post    returns the vector x in Ax = b. Throws an exception if a zero
+    *         pivot is encountered
+    */
+    virtual MathVector<T> operator()
+      (const IMathMatrix<T>& A, const MathVector<T>& b) const;
+
+    /*
+    * brief   Solves Ax = b in O(n)
+    * pre     b must be of size A.rows() else exception is thrown
+    * post    Same as operator()
+    */
+    MathVector<T> solve(const TriDiagonalMathMatrix<T>& A,
+        const MathVector<T>& b) const;
+
+    /*
+    * brief   Eliminates A once so it can be solved against many b
+    * pre     A must be square and tridiagonal else exception is thrown
+    * post    returns a ThomasFactorization. Throws an exception if a zero
+    *         pivot is encountered
+    */
+    using IMatrixSolver<T>::factor;
+    virtual std::unique_ptr<IMatrixFactorization<T> >
+      factor(MathMatrix<T>&& A) const;
+    std::unique_ptr<IMatrixFactorization<T> >
+      factor(const TriDiagonalMathMatrix<T>& A) const;
+};
+
+#include "ThomasSolver.hpp"
+
+#endif
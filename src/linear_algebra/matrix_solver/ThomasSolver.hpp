@@ -0,0 +1,46 @@
+/*
+ * author Connor Walsh
+ * file   ThomasSolver.hpp
+ * brief  Implementation file for the ThomasSolver class
+ */
+
+#include <stdexcept>
+
+#include "ThomasSolver.h"
+
+template <class T>
+MathVector<T> ThomasSolver<T>::operator()
+  (const IMathMatrix<T>& A, const MathVector<T>& b) const
+{
+  return solve(TriDiagonalMathMatrix<T>(A), b);
+}
+
+template <class T>
+MathVector<T> ThomasSolver<T>::solve(const TriDiagonalMathMatrix<T>& A,
+    const MathVector<T>& b) const
+{
+  if (A.rows() != b.size())
+  {
+    throw std::domain_error("Cannot perform the Thomas algorithm on matrix"
+        " and vector of incorrect dimensions!");
+  }
+
+  MathVector<T> x(b);
+  ThomasFactorization<T>(A).solveInPlace(x);
+  return x;
+}
+
+template <class T>
+std::unique_ptr<IMatrixFactorization<T> >
+  ThomasSolver<T>::factor(MathMatrix<T>&& A) const
+{
+  return factor(TriDiagonalMathMatrix<T>(A));
+}
+
+template <class T>
+std::unique_ptr<IMatrixFactorization<T> >
+  ThomasSolver<T>::factor(const TriDiagonalMathMatrix<T>& A) const
+{
+  return std::unique_ptr<IMatrixFactorization<T> >(
+      new ThomasFactorization<T>(A));
+}
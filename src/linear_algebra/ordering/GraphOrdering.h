@@ -0,0 +1,103 @@
+/*
+ * author Connor Walsh
+ * file   GraphOrdering.h
+ * brief  Fill and bandwidth reducing orderings of sparse matrices
+ */
+
+#ifndef GRAPH_ORDERING_H
+#define GRAPH_ORDERING_H
+
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include "Permutation.h"
+#include "../math_matrix/SparseMathMatrix.h"
+
+/*
+ * class  GraphOrdering
+ * brief  This class computes permutations of the unknowns of a square
+ *        sparse matrix from the graph of its pattern, unknowns i and j being
+ *        neighbours when A(i, j) or A(j, i) is stored. Values are never
+ *        read, only the pattern
+ */
+class GraphOrdering
+{
+  public:
+    /*
+     * brief  Adjacency lists of the graph, each sorted and without the
+     *        unknown itself
+     */
+    typedef std::vector<std::vector<size_t> > Graph;
+
+    /*
+     * brief  Returns the symmetric graph of the pattern of A
+     * pre    A must be square else exception is thrown
+     */
+    template <class T>
+    static Graph graphOf(const SparseMathMatrix<T>& A);
+
+    /*
+     * brief  Reverse Cuthill-McKee ordering. Each connected part of the
+     *        graph is numbered breadth first from a pseudo-peripheral
+     *        unknown, neighbours in order of increasing degree, and the
+     *        whole numbering is then reversed. This keeps neighbours close
+     *        in the numbering, shrinking the bandwidth and profile
+     * pre    A must be square else exception is thrown
+     */
+    template <class T>
+    static Permutation reverseCuthillMcKee(const SparseMathMatrix<T>& A);
+    static Permutation reverseCuthillMcKee(const Graph& graph);
+
+    /*
+     * brief  Minimum degree ordering. Repeatedly eliminates the unknown
+     *        with the fewest neighbours in the graph of the partly factored
+     *        matrix, ties going to the lowest index, which tends to keep the
+     *        fill of a Cholesky or LU factorization small
+     * pre    A must be square else exception is thrown
+     */
+    template <class T>
+    static Permutation minimumDegree(const SparseMathMatrix<T>& A);
+    static Permutation minimumDegree(const Graph& graph);
+
+    /*
+     * brief  Nested dissection ordering of the unknowns of a width by height
+     *        grid, unknown (x, y) being numbered x + y * width as
+     *        DirichletPoisson numbers its inner points. The grid is split
+     *        across its longer side by a line of unknowns which is numbered
+     *        after both halves, and each half is split the same way. For the
+     *        five point operator this gives a Cholesky factor with
+     *        O(n log n) entries in O(n^1.5) operations
+     */
+    static Permutation nestedDissection(size_t width, size_t height);
+
+  private:
+    /*
+     * brief  Appends the nested dissection order of the part of the grid
+     *        with x in [xBegin, xEnd) and y in [yBegin, yEnd) to order
+     */
+    static void dissect(size_t width, size_t xBegin, size_t xEnd,
+        size_t yBegin, size_t yEnd, std::vector<size_t>& order);
+
+    /*
+     * brief  Numbers the unknowns reachable from start breadth first,
+     *        appending them to order and marking them in visited
+     * post   returns the number of levels of the search, lastLevel holding
+     *        the offset in order at which the last level starts
+     */
+    static size_t breadthFirst(const Graph& graph, size_t start,
+        std::vector<size_t>& order, std::vector<bool>& visited,
+        size_t& lastLevel);
+
+    /*
+     * brief  Returns an unknown of the part containing start that is about
+     *        as far as possible from every other, found by repeated breadth
+     *        first searches from the lowest degree unknown of the last level
+     */
+    static size_t peripheral(const Graph& graph, size_t start);
+};
+
+#include "GraphOrdering.hpp"
+
+#endif
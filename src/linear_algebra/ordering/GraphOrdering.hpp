@@ -0,0 +1,240 @@
+/*
+ * author Connor Walsh
+ * file   GraphOrdering.hpp
+ * brief  Implementation file for the GraphOrdering class
+ */
+
+#include <stdexcept>
+#include <algorithm>
+#include <set>
+#include <utility>
+
+#include "GraphOrdering.h"
+
+template <class T>
+GraphOrdering::Graph GraphOrdering::graphOf(const SparseMathMatrix<T>& A)
+{
+  if (A.rows() != A.cols())
+  {
+    throw std::domain_error("Cannot order a matrix that is not square!");
+  }
+
+  const std::vector<size_t>& rowStarts = A.rowStarts();
+  const std::vector<size_t>& columns = A.columnIndices();
+  Graph graph(A.rows());
+  for (size_t i = 0; i < A.rows(); ++i)
+  {
+    for (size_t k = rowStarts[i]; k < rowStarts[i + 1]; ++k)
+    {
+      if (columns[k] != i)
+      {
+        graph[i].push_back(columns[k]);
+        graph[columns[k]].push_back(i);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < graph.size(); ++i)
+  {
+    std::sort(graph[i].begin(), graph[i].end());
+    graph[i].erase(std::unique(graph[i].begin(), graph[i].end()),
+        graph[i].end());
+  }
+  return graph;
+}
+
+template <class T>
+Permutation GraphOrdering::reverseCuthillMcKee(const SparseMathMatrix<T>& A)
+{
+  return reverseCuthillMcKee(graphOf(A));
+}
+
+template <class T>
+Permutation GraphOrdering::minimumDegree(const SparseMathMatrix<T>& A)
+{
+  return minimumDegree(graphOf(A));
+}
+
+inline size_t GraphOrdering::breadthFirst(const Graph& graph, size_t start,
+    std::vector<size_t>& order, std::vector<bool>& visited, size_t& lastLevel)
+{
+  size_t levelEnd = order.size();
+  size_t levels = 0;
+  std::vector<size_t> next;
+
+  order.push_back(start);
+  visited[start] = true;
+  for (size_t p = levelEnd; p < order.size(); ++p)
+  {
+    if (p == levelEnd)
+    {
+      lastLevel = p;
+      levelEnd = order.size();
+      ++levels;
+    }
+
+    // Cuthill-McKee visits the neighbours of lowest degree first
+    next.clear();
+    for (size_t neighbour : graph[order[p]])
+    {
+      if (!visited[neighbour])
+      {
+        visited[neighbour] = true;
+        next.push_back(neighbour);
+      }
+    }
+    std::stable_sort(next.begin(), next.end(),
+        [&graph](size_t lhs, size_t rhs)
+        {
+          return graph[lhs].size() < graph[rhs].size();
+        });
+    order.insert(order.end(), next.begin(), next.end());
+  }
+  return levels;
+}
+
+inline size_t GraphOrdering::peripheral(const Graph& graph, size_t start)
+{
+  std::vector<bool> visited(graph.size(), false);
+  std::vector<size_t> order;
+  size_t lastLevel = 0;
+
+  size_t node = start;
+  size_t levels = breadthFirst(graph, node, order, visited, lastLevel);
+  while (true)
+  {
+    size_t candidate = order[lastLevel];
+    for (size_t p = lastLevel; p < order.size(); ++p)
+    {
+      if (graph[order[p]].size() < graph[candidate].size())
+      {
+        candidate = order[p];
+      }
+    }
+
+    // Only the unknowns of this part were marked
+    for (size_t unknown : order)
+    {
+      visited[unknown] = false;
+    }
+    order.clear();
+
+    size_t candidateLevels =
+      breadthFirst(graph, candidate, order, visited, lastLevel);
+    if (candidateLevels <= levels)
+    {
+      return node;
+    }
+    node = candidate;
+    levels = candidateLevels;
+  }
+}
+
+inline Permutation GraphOrdering::reverseCuthillMcKee(const Graph& graph)
+{
+  std::vector<bool> visited(graph.size(), false);
+  std::vector<size_t> order;
+  order.reserve(graph.size());
+
+  for (size_t i = 0; i < graph.size(); ++i)
+  {
+    if (!visited[i])
+    {
+      size_t lastLevel = 0;
+      breadthFirst(graph, peripheral(graph, i), order, visited, lastLevel);
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+  return Permutation(std::move(order));
+}
+
+inline Permutation GraphOrdering::minimumDegree(const Graph& graph)
+{
+  size_t size = graph.size();
+  std::vector<std::set<size_t> > adjacent(size);
+  std::set<std::pair<size_t, size_t> > byDegree;
+  for (size_t i = 0; i < size; ++i)
+  {
+    adjacent[i].insert(graph[i].begin(), graph[i].end());
+    byDegree.insert(std::make_pair(adjacent[i].size(), i));
+  }
+
+  // Eliminating an unknown joins all of its neighbours to each other, which
+  // is the fill it causes
+  std::vector<size_t> order;
+  order.reserve(size);
+  while (!byDegree.empty())
+  {
+    size_t pivot = byDegree.begin()->second;
+    byDegree.erase(byDegree.begin());
+    order.push_back(pivot);
+
+    const std::set<size_t>& neighbours = adjacent[pivot];
+    for (size_t u : neighbours)
+    {
+      byDegree.erase(std::make_pair(adjacent[u].size(), u));
+      adjacent[u].erase(pivot);
+      for (size_t w : neighbours)
+      {
+        if (w != u) adjacent[u].insert(w);
+      }
+      byDegree.insert(std::make_pair(adjacent[u].size(), u));
+    }
+    adjacent[pivot].clear();
+  }
+  return Permutation(std::move(order));
+}
+
+inline Permutation GraphOrdering::nestedDissection(size_t width, size_t height)
+{
+  std::vector<size_t> order;
+  order.reserve(width * height);
+  dissect(width, 0, width, 0, height, order);
+  return Permutation(std::move(order));
+}
+
+inline void GraphOrdering::dissect(size_t width, size_t xBegin, size_t xEnd,
+    size_t yBegin, size_t yEnd, std::vector<size_t>& order)
+{
+  size_t partWidth = xEnd - xBegin;
+  size_t partHeight = yEnd - yBegin;
+  if (partWidth == 0 || partHeight == 0)
+  {
+    return;
+  }
+
+  // Parts this small gain nothing from another separator
+  if (partWidth * partHeight <= 8)
+  {
+    for (size_t y = yBegin; y < yEnd; ++y)
+    {
+      for (size_t x = xBegin; x < xEnd; ++x)
+      {
+        order.push_back(x + y * width);
+      }
+    }
+    return;
+  }
+
+  if (partWidth >= partHeight)
+  {
+    size_t middle = xBegin + partWidth / 2;
+    dissect(width, xBegin, middle, yBegin, yEnd, order);
+    dissect(width, middle + 1, xEnd, yBegin, yEnd, order);
+    for (size_t y = yBegin; y < yEnd; ++y)
+    {
+      order.push_back(middle + y * width);
+    }
+  }
+  else
+  {
+    size_t middle = yBegin + partHeight / 2;
+    dissect(width, xBegin, xEnd, yBegin, middle, order);
+    dissect(width, xBegin, xEnd, middle + 1, yEnd, order);
+    for (size_t x = xBegin; x < xEnd; ++x)
+    {
+      order.push_back(x + middle * width);
+    }
+  }
+}
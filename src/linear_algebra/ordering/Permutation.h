@@ -0,0 +1,97 @@
+/*
+ * author Connor Walsh
+ * file   Permutation.h
+ * brief  A reordering of the unknowns of a linear system
+ */
+
+#ifndef PERMUTATION_H
+#define PERMUTATION_H
+
+#pragma once
+
+#include <stddef.h>
+#include <vector>
+
+#include "../MathVector.h"
+
+/*
+ * class  Permutation
+ * brief  This class holds a reordering of n unknowns. Position k of the
+ *        reordered system holds unknown order(k) of the original one, so a
+ *        vector b is reordered as b'[k] = b[order(k)] and a matrix A as
+ *        A'(k, l) = A(order(k), order(l)). The inverse is kept alongside so
+ *        both directions cost O(n)
+ */
+class Permutation
+{
+  public:
+    /*
+     * brief  Creates the identity permutation of size unknowns
+     */
+    explicit Permutation(size_t size = 0);
+
+    /*
+     * brief  Creates the permutation placing unknown order[k] at position k
+     * pre    order must hold each of 0 to order.size() - 1 exactly once else
+     *        exception is thrown
+     */
+    explicit Permutation(std::vector<size_t> order);
+
+    /*
+     * brief  Returns the number of unknowns reordered
+     */
+    size_t size() const { return myOrder.size(); }
+
+    /*
+     * brief  Returns the original unknown at position k of the reordering
+     * pre    k must be less than size() else exception is thrown
+     */
+    size_t order(size_t k) const { return myOrder.at(k); }
+
+    /*
+     * brief  Returns the position of original unknown i in the reordering
+     * pre    i must be less than size() else exception is thrown
+     */
+    size_t position(size_t i) const { return myPosition.at(i); }
+
+    /*
+     * brief  Returns the positions of every original unknown at once
+     */
+    const std::vector<size_t>& positions() const { return myPosition; }
+
+    /*
+     * brief  Returns the permutation that undoes this one
+     */
+    Permutation inverse() const;
+
+    /*
+     * brief  Reorders b into the numbering of the permuted system
+     * pre    b must have size size() else exception is thrown
+     * post   returns b' with b'[k] = b[order(k)]
+     */
+    template <class T>
+    MathVector<T> apply(const MathVector<T>& b) const;
+
+    /*
+     * brief  Undoes apply, taking a solution of the permuted system back to
+     *        the original numbering
+     * pre    x must have size size() else exception is thrown
+     * post   returns y with y[order(k)] = x[k]
+     */
+    template <class T>
+    MathVector<T> restore(const MathVector<T>& x) const;
+
+    bool operator==(const Permutation& rhs) const
+    {
+      return myOrder == rhs.myOrder;
+    }
+    bool operator!=(const Permutation& rhs) const { return !(*this == rhs); }
+
+  private:
+    std::vector<size_t> myOrder;
+    std::vector<size_t> myPosition;
+};
+
+#include "Permutation.hpp"
+
+#endif
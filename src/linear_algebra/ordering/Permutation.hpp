@@ -0,0 +1,73 @@
+/*
+ * author Connor Walsh
+ * file   Permutation.hpp
+ * brief  Implementation file for the Permutation class
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "Permutation.h"
+
+inline Permutation::Permutation(size_t size)
+  : myOrder(size), myPosition(size)
+{
+  for (size_t k = 0; k < size; ++k)
+  {
+    myOrder[k] = k;
+    myPosition[k] = k;
+  }
+}
+
+inline Permutation::Permutation(std::vector<size_t> order)
+  : myOrder(std::move(order)), myPosition(myOrder.size(), myOrder.size())
+{
+  for (size_t k = 0, size = myOrder.size(); k < size; ++k)
+  {
+    if (myOrder[k] >= size || myPosition[myOrder[k]] != size)
+    {
+      throw std::domain_error("Cannot make a Permutation from an order that"
+          " does not hold every unknown exactly once!");
+    }
+    myPosition[myOrder[k]] = k;
+  }
+}
+
+inline Permutation Permutation::inverse() const
+{
+  return Permutation(myPosition);
+}
+
+template <class T>
+MathVector<T> Permutation::apply(const MathVector<T>& b) const
+{
+  if (b.size() != size())
+  {
+    throw std::domain_error("Cannot permute a MathVector of incorrect"
+        " dimensions!");
+  }
+
+  MathVector<T> result(size());
+  for (size_t k = 0; k < size(); ++k)
+  {
+    result[k] = b[myOrder[k]];
+  }
+  return result;
+}
+
+template <class T>
+MathVector<T> Permutation::restore(const MathVector<T>& x) const
+{
+  if (x.size() != size())
+  {
+    throw std::domain_error("Cannot permute a MathVector of incorrect"
+        " dimensions!");
+  }
+
+  MathVector<T> result(size());
+  for (size_t k = 0; k < size(); ++k)
+  {
+    result[myOrder[k]] = x[k];
+  }
+  return result;
+}
@@ -0,0 +1,251 @@
+/*
+ * author Connor Walsh
+ * file   ThreadPool.h
+ * brief  This file provides the work stealing thread pool shared by the
+ *        library together with its parallelFor and parallelReduce primitives
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <cstddef>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+/*
+ * class ThreadPool
+ * brief This class owns a fixed set of worker threads. Each worker keeps its
+ * own queue of tasks, taking new work from the back of it and, when it runs
+ * dry, stealing from the front of the other queues. A thread that starts a
+ * parallel loop helps run tasks until the loop is finished, so loops may be
+ * nested and a pool of one thread runs everything on the caller
+ */
+class ThreadPool
+{
+  public:
+    /*
+     * brief  Loops with less than roughly this many element operations in
+     *        total are not worth splitting across threads
+     */
+    static const std::size_t minParallelWork = 32 * 1024;
+
+    /*
+    * brief   Creates a pool that runs work on numThreads threads in total,
+    *         the thread calling into the pool being one of them
+    * pre     numThreads of zero is treated as one
+    * post    numThreads - 1 worker threads are started
+    */
+    explicit ThreadPool(std::size_t numThreads);
+
+    /*
+    * brief   Stops and joins every worker thread
+    * pre     No parallel loop may be running on the pool
+    */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+
+    /*
+    * brief   Returns the number of threads work is spread across
+    * post    Returns the worker count plus one for the calling thread
+    */
+    std::size_t threadCount() const noexcept;
+
+    /*
+    * brief   Calls body(first, last) over consecutive pieces of [begin, end)
+    *         that are each at most grain long, possibly in parallel
+    * pre     body must be safe to call concurrently on disjoint pieces
+    * post    Every index in [begin, end) has been covered exactly once. If
+    *         any call throws, the first exception is rethrown once all
+    *         pieces have finished
+    */
+    template <class Function>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+        const Function& body);
+
+    /*
+    * brief   Reduces [begin, end) by calling body(first, last) on
+    *         consecutive blocks of exactly grain indices, the last block
+    *         possibly shorter, and combining the block results pairwise
+    * pre     body must be safe to call concurrently on disjoint blocks
+    * post    Returns identity combined with the block results, neighbours
+    *         being combined first in a tree fixed by the number of blocks.
+    *         Blocks depend only on grain so the result is bitwise the same
+    *         for any thread count, and a single block is exactly
+    *         combine(identity, body(begin, end))
+    */
+    template <class Result, class Function, class Combine>
+    Result parallelReduce(std::size_t begin, std::size_t end, std::size_t grain,
+        Result identity, const Function& body, const Combine& combine);
+
+    /*
+    * brief   Returns the grain that gives each piece of a loop about
+    *         minParallelWork operations when each index costs workPerIndex
+    * post    Returns a value of at least one
+    */
+    static std::size_t grainFor(std::size_t workPerIndex) noexcept;
+
+    /*
+    * brief   Returns the pool shared by the library
+    * post    The pool is created on first use with setThreadCount's value,
+    *         defaulting to the hardware concurrency. Later calls take no
+    *         lock
+    */
+    static ThreadPool& instance();
+
+    /*
+    * brief   Replaces the shared pool with one of numThreads threads
+    * pre     No parallel loop may be running on the shared pool
+    * post    instance() returns a pool of numThreads threads
+    */
+    static void setThreadCount(std::size_t numThreads);
+
+  private:
+    typedef std::function<void()> Task;
+
+    struct TaskQueue
+    {
+      std::mutex mutex;
+      std::deque<Task> tasks;
+    };
+
+    /*
+    * brief   Tracks the tasks of one parallel loop so its caller can wait
+    */
+    struct TaskGroup
+    {
+      std::atomic<std::size_t> remaining;
+      std::mutex mutex;
+      std::exception_ptr error;
+    };
+
+    /*
+    * brief   Runs one queued task, preferring the calling thread's own queue
+    * post    Returns false if no task could be found
+    */
+    bool runOne();
+
+    /*
+    * brief   Runs every piece of [begin, end) as a task of one group and
+    *         waits for all of them, helping while it waits
+    */
+    template <class Function>
+    void runPieces(std::size_t begin, std::size_t end, std::size_t grain,
+        const Function& body);
+
+    /*
+    * brief   Main loop of worker number index
+    */
+    void workerLoop(std::size_t index);
+
+    /*
+    * brief   Returns the queue the calling thread pushes to
+    */
+    std::size_t ownQueue() const noexcept;
+
+    // The shared pool is owned by sharedPool and published through
+    // sharedInstance, which instance() reads without locking. Both only
+    // change under sharedMutex
+    static std::unique_ptr<ThreadPool>& sharedPool();
+    static std::atomic<ThreadPool*>& sharedInstance();
+    static std::size_t& sharedThreadCount();
+    static std::mutex& sharedMutex();
+
+    // The pool whose worker is running on this thread and that worker's
+    // queue. Threads outside the pool share the last queue
+    static ThreadPool*& currentPool() noexcept
+    {
+      static thread_local ThreadPool* pool = nullptr;
+      return pool;
+    }
+
+    static std::size_t& currentQueue() noexcept
+    {
+      static thread_local std::size_t queue = 0;
+      return queue;
+    }
+
+    std::vector<std::unique_ptr<TaskQueue> > myQueues;
+    std::vector<std::thread> myThreads;
+    std::mutex mySleepMutex;
+    std::condition_variable myWake;
+    std::atomic<std::size_t> myPending;
+    bool myStopping;
+};
+
+/*
+ * class ThreadCountScope
+ * brief Sets the thread count of the shared pool for as long as it is alive
+ * and restores the previous count when destroyed, so code that compares
+ * thread counts, such as a test, leaves the shared pool as it found it
+ */
+class ThreadCountScope
+{
+  public:
+    /*
+    * brief   Remembers the shared pool's thread count and switches to
+    *         numThreads
+    * pre     No parallel loop may be running on the shared pool
+    */
+    explicit ThreadCountScope(std::size_t numThreads)
+      : myPrevious(ThreadPool::instance().threadCount())
+    {
+      ThreadPool::setThreadCount(numThreads);
+    }
+
+    /*
+    * brief   Switches the shared pool to numThreads within this scope
+    * pre     No parallel loop may be running on the shared pool
+    */
+    void set(std::size_t numThreads)
+    {
+      ThreadPool::setThreadCount(numThreads);
+    }
+
+    /*
+    * brief   Restores the thread count the shared pool had on construction
+    */
+    ~ThreadCountScope()
+    {
+      ThreadPool::setThreadCount(myPrevious);
+    }
+
+    ThreadCountScope(const ThreadCountScope& other) = delete;
+    ThreadCountScope& operator=(const ThreadCountScope& other) = delete;
+
+  private:
+    std::size_t myPrevious;
+};
+
+/*
+ * brief  Runs parallelFor on the shared thread pool
+ */
+template <class Function>
+void parallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+    const Function& body)
+{
+  ThreadPool::instance().parallelFor(begin, end, grain, body);
+}
+
+/*
+ * brief  Runs parallelReduce on the shared thread pool
+ */
+template <class Result, class Function, class Combine>
+Result parallelReduce(std::size_t begin, std::size_t end, std::size_t grain,
+    Result identity, const Function& body, const Combine& combine)
+{
+  return ThreadPool::instance().parallelReduce(begin, end, grain, identity,
+      body, combine);
+}
+
+#include "ThreadPool.hpp"
+
+#endif
@@ -0,0 +1,291 @@
+////////////////////////////////////////////////////////////////////////////////
+// author Connor Walsh
+// file   ThreadPool.hpp
+// brief  Implementation of the ThreadPool class
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <utility>
+
+#include "ThreadPool.h"
+
+inline ThreadPool::ThreadPool(std::size_t numThreads)
+  : myPending(0), myStopping(false)
+{
+  std::size_t numWorkers = (numThreads == 0) ? 0 : numThreads - 1;
+
+  // One queue per worker plus one shared by threads outside the pool
+  for (std::size_t i = 0; i <= numWorkers; ++i)
+  {
+    myQueues.push_back(std::unique_ptr<TaskQueue>(new TaskQueue()));
+  }
+  for (std::size_t i = 0; i < numWorkers; ++i)
+  {
+    myThreads.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+  }
+}
+
+inline ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mySleepMutex);
+    myStopping = true;
+  }
+  myWake.notify_all();
+
+  for (std::thread& thread : myThreads)
+  {
+    thread.join();
+  }
+}
+
+inline std::size_t ThreadPool::threadCount() const noexcept
+{
+  return myThreads.size() + 1;
+}
+
+template <class Function>
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end,
+    std::size_t grain, const Function& body)
+{
+  if (end <= begin)
+  {
+    return;
+  }
+
+  grain = std::max<std::size_t>(grain, 1);
+  std::size_t length = end - begin;
+  if (myThreads.empty() || length <= grain)
+  {
+    body(begin, end);
+    return;
+  }
+
+  // A few pieces per thread is enough to balance the load, more only adds
+  // queueing overhead
+  std::size_t maxPieces = 8 * threadCount();
+  if ((length + grain - 1) / grain > maxPieces)
+  {
+    grain = (length + maxPieces - 1) / maxPieces;
+  }
+
+  runPieces(begin, end, grain, body);
+}
+
+template <class Result, class Function, class Combine>
+Result ThreadPool::parallelReduce(std::size_t begin, std::size_t end,
+    std::size_t grain, Result identity, const Function& body,
+    const Combine& combine)
+{
+  if (end <= begin)
+  {
+    return identity;
+  }
+
+  grain = std::max<std::size_t>(grain, 1);
+  std::size_t numBlocks = (end - begin + grain - 1) / grain;
+  if (numBlocks == 1)
+  {
+    return combine(identity, body(begin, end));
+  }
+
+  // Blocks are grouped into pieces only to limit scheduling overhead, the
+  // grouping has no effect on the result
+  std::vector<Result> results(numBlocks, identity);
+  parallelFor(0, numBlocks, grainFor(grain),
+      [&](std::size_t firstBlock, std::size_t lastBlock)
+      {
+        for (std::size_t block = firstBlock; block < lastBlock; ++block)
+        {
+          std::size_t first = begin + block * grain;
+          results[block] = body(first, std::min(end, first + grain));
+        }
+      });
+
+  // Pairwise combination keeps the rounding error growing with the log of
+  // the number of blocks rather than linearly
+  for (std::size_t width = 1; width < numBlocks; width *= 2)
+  {
+    for (std::size_t block = 0; block + width < numBlocks; block += 2 * width)
+    {
+      results[block] = combine(results[block], results[block + width]);
+    }
+  }
+  return combine(identity, results[0]);
+}
+
+inline std::size_t ThreadPool::grainFor(std::size_t workPerIndex) noexcept
+{
+  return std::max<std::size_t>(1,
+      minParallelWork / std::max<std::size_t>(workPerIndex, 1));
+}
+
+inline ThreadPool& ThreadPool::instance()
+{
+  // Every parallel loop comes through here, so only the first use pays for
+  // the lock
+  ThreadPool* cached = sharedInstance().load(std::memory_order_acquire);
+  if (cached)
+  {
+    return *cached;
+  }
+
+  std::lock_guard<std::mutex> lock(sharedMutex());
+  std::unique_ptr<ThreadPool>& pool = sharedPool();
+  if (!pool)
+  {
+    pool.reset(new ThreadPool(sharedThreadCount()));
+    sharedInstance().store(pool.get(), std::memory_order_release);
+  }
+  return *pool;
+}
+
+inline void ThreadPool::setThreadCount(std::size_t numThreads)
+{
+  std::lock_guard<std::mutex> lock(sharedMutex());
+  std::unique_ptr<ThreadPool> replaced(new ThreadPool(numThreads));
+  sharedInstance().store(replaced.get(), std::memory_order_release);
+  sharedPool().swap(replaced);
+  sharedThreadCount() = numThreads;
+}
+
+template <class Function>
+void ThreadPool::runPieces(std::size_t begin, std::size_t end,
+    std::size_t grain, const Function& body)
+{
+  std::size_t numPieces = (end - begin + grain - 1) / grain;
+  TaskGroup group;
+  group.remaining = numPieces;
+
+  // Count the tasks before queueing them so a worker never sees a task
+  // that is not yet pending
+  {
+    std::lock_guard<std::mutex> lock(mySleepMutex);
+    myPending += numPieces;
+  }
+
+  {
+    TaskQueue& queue = *myQueues[ownQueue()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    for (std::size_t first = begin; first < end; first += grain)
+    {
+      std::size_t last = std::min(end, first + grain);
+      queue.tasks.push_back([&group, &body, first, last]()
+          {
+            try
+            {
+              body(first, last);
+            }
+            catch (...)
+            {
+              std::lock_guard<std::mutex> errorLock(group.mutex);
+              if (!group.error)
+              {
+                group.error = std::current_exception();
+              }
+            }
+            --group.remaining;
+          });
+    }
+  }
+  myWake.notify_all();
+
+  while (group.remaining > 0)
+  {
+    if (!runOne())
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  if (group.error)
+  {
+    std::rethrow_exception(group.error);
+  }
+}
+
+inline bool ThreadPool::runOne()
+{
+  std::size_t own = ownQueue();
+  std::size_t numQueues = myQueues.size();
+  for (std::size_t offset = 0; offset < numQueues; ++offset)
+  {
+    TaskQueue& queue = *myQueues[(own + offset) % numQueues];
+    Task task;
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty())
+      {
+        continue;
+      }
+
+      // Newest work from our own queue, oldest work when stealing
+      if (offset == 0)
+      {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      }
+      else
+      {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+    }
+
+    --myPending;
+    task();
+    return true;
+  }
+  return false;
+}
+
+inline void ThreadPool::workerLoop(std::size_t index)
+{
+  currentPool() = this;
+  currentQueue() = index;
+
+  while (true)
+  {
+    if (runOne())
+    {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(mySleepMutex);
+    myWake.wait(lock, [this]() { return myStopping || myPending > 0; });
+    if (myStopping && myPending == 0)
+    {
+      return;
+    }
+  }
+}
+
+inline std::size_t ThreadPool::ownQueue() const noexcept
+{
+  return (currentPool() == this) ? currentQueue() : myQueues.size() - 1;
+}
+
+inline std::unique_ptr<ThreadPool>& ThreadPool::sharedPool()
+{
+  static std::unique_ptr<ThreadPool> pool;
+  return pool;
+}
+
+inline std::atomic<ThreadPool*>& ThreadPool::sharedInstance()
+{
+  static std::atomic<ThreadPool*> pool(nullptr);
+  return pool;
+}
+
+inline std::size_t& ThreadPool::sharedThreadCount()
+{
+  static std::size_t numThreads =
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+  return numThreads;
+}
+
+inline std::mutex& ThreadPool::sharedMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
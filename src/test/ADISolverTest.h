@@ -0,0 +1,73 @@
+/*
+ * author Connor Walsh
+ * file   ADISolverTest.h
+ * brief  Class to represent a set of unit tests for ADISolver
+ */
+
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/ADISolver.h"
+#include "../linear_algebra/matrix_solver/RedBlackSORSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/DirichletPoisson.h"
+#include "../linear_algebra/PoissonFunctions.h"
+#include "../parallel/ThreadPool.h"
+
+class ADISolverTest : public ::testing::Test {};
+
+TEST_F(ADISolverTest, MatchesDirectSolve)
+{
+  GaussianEliminationSolver<double> gauss;
+  ADISolver<double> adi;
+
+  for (int numDivs = 2; numDivs <= 9; ++numDivs)
+  {
+    DirichletPoisson<double> dirichlet(0, 0, 1.0, gauss);
+    MathVector<double> expected = dirichlet.getSolution
+      <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(numDivs);
+    MathVector<double> result = dirichlet.getGridSolution
+      <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(numDivs,
+          adi);
+    ASSERT_EQ(expected.size(), result.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      EXPECT_NEAR(expected[i], result[i], 1e-9);
+    }
+  }
+}
+
+TEST_F(ADISolverTest, FewIterations)
+{
+  int numDivs = 64;
+  GaussianEliminationSolver<double> unused;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, unused, numDivs);
+  MathVector<double> b((numDivs - 1) * (numDivs - 1));
+  dirichlet.generateConstants
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(b);
+
+  ADISolver<double> adi;
+  MathVector<double> shifts = adi.shifts(numDivs);
+  for (size_t j = 1; j < shifts.size(); ++j)
+  {
+    EXPECT_LT(shifts[j - 1], shifts[j]);
+  }
+
+  // Cycled shifts need far fewer iterations than optimal SOR
+  RedBlackSORSolver<double> sor;
+  MathVector<double> expected = sor.solve(b, numDivs);
+  ThreadCountScope threads(1);
+  MathVector<double> serial = adi.solve(b, numDivs);
+  EXPECT_LT(2 * adi.iterations(), sor.iterations());
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], serial[i], 1e-8);
+  }
+
+  threads.set(4);
+  EXPECT_EQ(serial, adi.solve(b, numDivs));
+
+  EXPECT_THROW(adi.solve(b, numDivs + 1), std::domain_error);
+}
@@ -64,3 +64,71 @@ TEST_F(ArrayTest, InvalidIndex)
   EXPECT_EQ(0, test.at(4));
   EXPECT_THROW(test.at(20), std::out_of_range);
 }
+
+TEST_F(ArrayTest, Resize)
+{
+  Array<int> test(4);
+  test[0] = 1;
+  test[3] = 4;
+  int* data = test.begin();
+
+  test.resize(2);
+  EXPECT_EQ(2, test.size());
+  EXPECT_EQ(4, test.capacity());
+  EXPECT_EQ(1, test[0]);
+
+  test.resize(4);
+  EXPECT_EQ(data, test.begin());
+  EXPECT_EQ(0, test[3]);
+
+  test.resize(8);
+  EXPECT_EQ(8, test.size());
+  EXPECT_EQ(8, test.capacity());
+  EXPECT_EQ(1, test[0]);
+  EXPECT_EQ(0, test[7]);
+}
+
+TEST_F(ArrayTest, InlineStorage)
+{
+  typedef Array<int, 4> SmallArray;
+
+  MonotonicArena arena;
+
+  SmallArray small(3);
+  const char* object = reinterpret_cast<const char*>(&small);
+  const char* data = reinterpret_cast<const char*>(small.begin());
+  EXPECT_TRUE(data >= object && data < object + sizeof(small));
+  EXPECT_EQ(4, small.capacity());
+  EXPECT_EQ(0, arena.bytesUsed());
+
+  small[0] = 1;
+  small[2] = 3;
+  SmallArray copy(small);
+  SmallArray moved(std::move(copy));
+  EXPECT_EQ(0, copy.size());
+  EXPECT_EQ(small, moved);
+  EXPECT_NE(small.begin(), moved.begin());
+
+  SmallArray large(6, arena);
+  large[5] = 6;
+  EXPECT_LT(0, arena.bytesUsed());
+  large.swap(small);
+  EXPECT_EQ(3, large.size());
+  EXPECT_EQ(3, large[2]);
+  EXPECT_EQ(6, small.size());
+  EXPECT_EQ(6, small[5]);
+
+  // Growing past the inline size moves to allocated storage
+  moved.resize(5);
+  EXPECT_EQ(5, moved.capacity());
+  EXPECT_EQ(3, moved[2]);
+
+  // Allocated storage is taken over rather than copied
+  Array<int> plain(2);
+  plain[1] = 2;
+  int* plainData = plain.begin();
+  SmallArray converted(std::move(plain));
+  EXPECT_EQ(plainData, converted.begin());
+  EXPECT_EQ(2, converted[1]);
+  EXPECT_EQ(0, plain.size());
+}
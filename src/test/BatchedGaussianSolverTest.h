@@ -0,0 +1,80 @@
+/*
+ * author Connor Walsh
+ * file   BatchedGaussianSolverTest.h
+ * brief  Class to represent a set of unit tests for BatchedGaussianSolver
+ */
+
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/BatchedSystems.h"
+#include "../linear_algebra/matrix_solver/BatchedGaussianSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+
+class BatchedGaussianSolverTest : public ::testing::Test
+{
+  protected:
+    // System number system of a family whose first pivot is zero for every
+    // third system, so pivoting is needed for those
+    static void makeSystem(int system, MathMatrix<double>& A,
+        MathVector<double>& b)
+    {
+      for (size_t row = 0; row < A.rows(); ++row)
+      {
+        for (size_t col = 0; col < A.cols(); ++col)
+        {
+          A(row, col) = 1.0 / (1 + row + col + system);
+        }
+        A(row, row) += (system % 3 == 0 && row == 0) ? -A(row, row) : 2;
+        b[row] = system - 2.0 * row;
+      }
+    }
+};
+
+TEST_F(BatchedGaussianSolverTest, MatchesGaussianElimination)
+{
+  int count = 70;
+  int size = 6;
+  BatchedSystems<double> systems(count, size);
+  MathMatrix<double> A(size, size);
+  MathVector<double> b(size);
+  for (int system = 0; system < count; ++system)
+  {
+    makeSystem(system, A, b);
+    systems.setSystem(system, A, b);
+  }
+  EXPECT_EQ(count, systems.count());
+  EXPECT_EQ(size, systems.size());
+
+  BatchedGaussianSolver<double> batched(true);
+  batched.solveInPlace(systems);
+
+  GaussianEliminationSolver<double> gauss(true);
+  for (int system = 0; system < count; ++system)
+  {
+    makeSystem(system, A, b);
+    EXPECT_EQ(gauss(A, b), systems.solution(system));
+  }
+
+  EXPECT_THROW(systems.setSystem(count, A, b), std::out_of_range);
+  EXPECT_THROW(systems.setSystem(0, MathMatrix<double>(2, 2), b),
+      std::domain_error);
+}
+
+TEST_F(BatchedGaussianSolverTest, ZeroPivot)
+{
+  BatchedSystems<double> systems(4, 3);
+  MathMatrix<double> A(3, 3);
+  MathVector<double> b(3);
+  for (int system = 0; system < 4; ++system)
+  {
+    makeSystem(system, A, b);
+    systems.setSystem(system, A, b);
+  }
+
+  BatchedGaussianSolver<double> batched;
+  EXPECT_THROW(batched.solveInPlace(systems), std::domain_error);
+}
@@ -0,0 +1,176 @@
+/*
+ * author Connor Walsh
+ * file   BiCGSTABSolverTest.h
+ * brief  Class to represent a set of unit tests for BiCGSTABSolver
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/BiCGSTABSolver.h"
+#include "../linear_algebra/matrix_solver/GMRESSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/matrix_solver/JacobiPreconditioner.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/IMathMatrix.h"
+#include "../linear_algebra/math_matrix/SparseMathMatrix.h"
+#include "../linear_algebra/DirichletPoisson.h"
+#include "../parallel/ThreadPool.h"
+
+class BiCGSTABSolverTest : public ::testing::Test
+{
+  protected:
+    // The Poisson operator with a convection term along x, so not
+    // symmetric, and row i scaled by scale^(i % 3)
+    static MathMatrix<double> convection(int numDivs, double scale = 1)
+    {
+      GaussianEliminationSolver<double> solver;
+      DirichletPoisson<double> dirichlet(0, 0, 1.0, solver, numDivs);
+      MathMatrix<double> A(dirichlet.getSparseOperator(numDivs));
+      int width = numDivs - 1;
+      int size = width * width;
+      for (int i = 0; i < size; ++i)
+      {
+        if (i % width != width - 1) A(i, i + 1) += 0.2;
+        if (i % width != 0) A(i, i - 1) -= 0.2;
+        double factor = (i % 3 == 0) ? 1 : (i % 3 == 1) ? scale : scale * scale;
+        for (int j = 0; j < size; ++j)
+        {
+          A(i, j) *= factor;
+        }
+      }
+      return A;
+    }
+
+    static MathVector<double> ramp(size_t size)
+    {
+      MathVector<double> b(size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        b[i] = (i % 5) - 1.5;
+      }
+      return b;
+    }
+};
+
+TEST_F(BiCGSTABSolverTest, Solve)
+{
+  MathMatrix<double> A = convection(8);
+  MathVector<double> b = ramp(49);
+
+  BiCGSTABSolver<double> bicgstab;
+  GaussianEliminationSolver<double> gauss;
+  const IMatrixSolver<double>& solver = bicgstab;
+  MathVector<double> expected = gauss(A, b);
+  MathVector<double> result = solver(A, b);
+  for (int i = 0; i < 49; ++i)
+  {
+    EXPECT_NEAR(expected[i], result[i], 1e-8);
+  }
+  EXPECT_GT(bicgstab.iterations(), 0u);
+  EXPECT_LE(bicgstab.iterations(), 49u);
+
+  // A guess that already solves the system needs no iterations at all
+  MathVector<double> exact = solver.solveFrom(A, b, result);
+  EXPECT_EQ(0u, bicgstab.iterations());
+  EXPECT_EQ(result, exact);
+
+  MathVector<double> moved = bicgstab(std::move(A), std::move(b));
+  EXPECT_EQ(result, moved);
+}
+
+TEST_F(BiCGSTABSolverTest, AgreesWithGMRES)
+{
+  // Two products with A per iteration against one, but no growing basis
+  MathMatrix<double> A = convection(12);
+  MathVector<double> b = ramp(121);
+
+  BiCGSTABSolver<double> bicgstab;
+  GMRESSolver<double> gmres(121);
+  MathVector<double> x = bicgstab(A, b);
+  MathVector<double> y = gmres(A, b);
+  for (int i = 0; i < 121; ++i)
+  {
+    EXPECT_NEAR(y[i], x[i], 1e-8);
+  }
+  EXPECT_LE(bicgstab.iterations(), gmres.iterations());
+  EXPECT_EQ(7u, bicgstab.workspace().vectorCount());
+}
+
+TEST_F(BiCGSTABSolverTest, Preconditioned)
+{
+  // Rows of very different scale are evened out by the diagonal
+  MathMatrix<double> A = convection(10, 10);
+  MathVector<double> b = ramp(81);
+  GaussianEliminationSolver<double> gauss;
+  MathVector<double> expected = gauss(A, b);
+
+  BiCGSTABSolver<double> bicgstab;
+  bicgstab(A, b);
+  size_t plainIterations = bicgstab.iterations();
+
+  JacobiPreconditioner<double> jacobi(A);
+  typedef BiCGSTABSolver<double>::Side Side;
+  for (Side side : { Side::Left, Side::Right })
+  {
+    bicgstab.setPreconditioner(jacobi, side);
+    EXPECT_EQ(&jacobi, bicgstab.preconditioner());
+    EXPECT_EQ(side, bicgstab.side());
+    MathVector<double> x = bicgstab(A, b);
+    for (int i = 0; i < 81; ++i)
+    {
+      EXPECT_NEAR(expected[i], x[i], 1e-6);
+    }
+    EXPECT_LT(bicgstab.iterations(), plainIterations);
+  }
+
+  bicgstab.clearPreconditioner();
+  EXPECT_EQ(nullptr, bicgstab.preconditioner());
+}
+
+TEST_F(BiCGSTABSolverTest, SparseThreads)
+{
+  // The sparse kernel gives the dense result, the same for any thread count
+  MathMatrix<double> dense = convection(30);
+  SparseMathMatrix<double> A(dense);
+  MathVector<double> b = ramp(A.rows());
+  BiCGSTABSolver<double> bicgstab;
+
+  ThreadCountScope threads(1);
+  MathVector<double> serial = bicgstab.solve(A, b);
+  size_t serialIterations = bicgstab.iterations();
+
+  threads.set(4);
+  MathVector<double> parallel = bicgstab.solve(A, b);
+  EXPECT_EQ(serial, parallel);
+  EXPECT_EQ(serialIterations, bicgstab.iterations());
+
+  MathVector<double> residual = A * parallel;
+  residual -= b;
+  EXPECT_LT(residual.getMagnitude(), 1e-9 * b.getMagnitude());
+}
+
+TEST_F(BiCGSTABSolverTest, Failure)
+{
+  MathMatrix<double> A = convection(8);
+  MathVector<double> b = ramp(49);
+
+  BiCGSTABSolver<double> bicgstab(1e-10, 3);
+  EXPECT_THROW(bicgstab(A, b), std::domain_error);
+
+  BiCGSTABSolver<double> solver;
+  EXPECT_THROW(solver.solve(A, ramp(48)), std::domain_error);
+
+  JacobiPreconditioner<double> small(convection(7));
+  solver.setPreconditioner(small);
+  EXPECT_THROW(solver.solve(A, b), std::domain_error);
+
+  MathMatrix<double> singular(3, 3);
+  singular(0, 0) = 1;
+  singular(1, 1) = 1;
+  EXPECT_THROW(BiCGSTABSolver<double>().solve(singular, ramp(3)),
+      std::domain_error);
+}
@@ -0,0 +1,116 @@
+/*
+ * author Connor Walsh
+ * file   ConjugateGradientSolverTest.h
+ * brief  Class to represent a set of unit tests for ConjugateGradientSolver
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/ConjugateGradientSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/IMathMatrix.h"
+
+class ConjugateGradientSolverTest : public ::testing::Test
+{
+  protected:
+    // Symmetric and diagonally dominant, so positive definite
+    static MathMatrix<double> spdMatrix(int size)
+    {
+      MathMatrix<double> A(size, size);
+      for (int row = 0; row < size; ++row)
+      {
+        for (int col = 0; col < size; ++col)
+        {
+          A(row, col) = 1.0 / (1 + row + col);
+        }
+        A(row, row) += size;
+      }
+      return A;
+    }
+};
+
+TEST_F(ConjugateGradientSolverTest, Solve)
+{
+  MathMatrix<double> A = spdMatrix(12);
+  MathVector<double> b(12);
+  for (int i = 0; i < 12; ++i)
+  {
+    b[i] = i - 4.0;
+  }
+
+  ConjugateGradientSolver<double> cg;
+  GaussianEliminationSolver<double> gauss;
+  const IMatrixSolver<double>& solver = cg;
+  MathVector<double> expected = gauss(A, b);
+  MathVector<double> result = solver(A, b);
+  for (int i = 0; i < 12; ++i)
+  {
+    EXPECT_NEAR(expected[i], result[i], 1e-9);
+  }
+  EXPECT_GT(cg.iterations(), 0u);
+  EXPECT_LE(cg.iterations(), 24u);
+
+  MathVector<double> moved = cg(std::move(A), std::move(b));
+  EXPECT_EQ(result, moved);
+}
+
+TEST_F(ConjugateGradientSolverTest, InitialGuess)
+{
+  MathMatrix<double> A = spdMatrix(40);
+  MathVector<double> b(40);
+  for (int i = 0; i < 40; ++i)
+  {
+    b[i] = (i % 7) - 3.0;
+  }
+
+  ConjugateGradientSolver<double> cg;
+  const IMatrixSolver<double>& solver = cg;
+  MathVector<double> x = solver(A, b);
+  size_t coldIterations = cg.iterations();
+
+  // A guess that already solves the system needs no iterations at all
+  MathVector<double> exact = solver.solveFrom(A, b, x);
+  EXPECT_EQ(0u, cg.iterations());
+  EXPECT_EQ(x, exact);
+
+  // A perturbed right hand side converges faster from the old solution
+  b[3] += 1e-3;
+  MathVector<double> warm = solver.solveFrom(A, b, x);
+  EXPECT_LT(cg.iterations(), coldIterations);
+  MathVector<double> cold = solver(A, b);
+  for (int i = 0; i < 40; ++i)
+  {
+    EXPECT_NEAR(cold[i], warm[i], 1e-9);
+  }
+
+  // Direct solvers accept the guess and ignore it
+  GaussianEliminationSolver<double> gauss;
+  const IMatrixSolver<double>& direct = gauss;
+  EXPECT_EQ(gauss(A, b), direct.solveFrom(A, b, MathVector<double>(40)));
+
+  EXPECT_THROW(solver.solveFrom(A, b, MathVector<double>(3)), std::domain_error);
+}
+
+TEST_F(ConjugateGradientSolverTest, NotPositiveDefinite)
+{
+  MathMatrix<double> A = spdMatrix(4);
+  A(2, 2) = -10;
+  MathVector<double> b(4);
+  b[2] = 1;
+
+  ConjugateGradientSolver<double> cg;
+  EXPECT_THROW(cg(A, b), std::domain_error);
+
+  MathVector<double> ones(10);
+  for (int i = 0; i < 10; ++i)
+  {
+    ones[i] = 1.0;
+  }
+  ConjugateGradientSolver<double> limited(1e-12, 1);
+  EXPECT_THROW(limited(spdMatrix(10), ones), std::domain_error);
+}
@@ -4,16 +4,20 @@
  * brief  Class to represent a set of unit tests for DirichletPoisson class
  */
 
+#include <atomic>
 #include <iostream>
 #include <stdexcept>
+#include <functional>
 
 #include "gtest/gtest.h"
 #include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
 #include "../linear_algebra/matrix_solver/QRSolver.h"
+#include "../linear_algebra/matrix_solver/ConjugateGradientSolver.h"
 #include "../linear_algebra/MathVector.h"
 #include "../linear_algebra/math_matrix/MathMatrix.h"
 #include "../linear_algebra/DirichletPoisson.h"
 #include "../linear_algebra/PoissonFunctions.h"
+#include "../parallel/ThreadPool.h"
 
 class DirichletPoissonTest : public ::testing::Test {};
 
@@ -49,6 +53,301 @@ TEST_F(DirichletPoissonTest, Generate)
 //  std::cout << "A:\n" << A2 << "\nb:\n" << b2 << std::endl;
 }
 
+TEST_F(DirichletPoissonTest, ParallelGenerate)
+{
+  GaussianEliminationSolver<double> mySolver;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, mySolver, 41);
+
+  MathMatrix<double> serialA(1600, 1600);
+  MathVector<double> serialB(1600);
+  ThreadCountScope threads(1);
+  dirichlet.generate<lowerBound, upperBound, leftBound, rightBound,
+    forcingFunction>(serialA, serialB);
+
+  MathMatrix<double> parallelA(1600, 1600);
+  MathVector<double> parallelB(1600);
+  threads.set(4);
+  dirichlet.generate<lowerBound, upperBound, leftBound, rightBound,
+    forcingFunction>(parallelA, parallelB);
+
+  EXPECT_EQ(serialA, parallelA);
+  EXPECT_EQ(serialB, parallelB);
+}
+
+TEST_F(DirichletPoissonTest, RuntimeProblem)
+{
+  GaussianEliminationSolver<double> mySolver;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, mySolver);
+
+  MathVector<double> expected = dirichlet.getSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(6);
+
+  double scale = 2.0;
+  PoissonProblem<double> problem(lowerBound, upperBound,
+      [](double y) { return 1 + y*y; }, rightBound,
+      [scale](double x, double y) { return -scale*(x*x + y*y); });
+  MathVector<double> runtime = dirichlet.getSolution(6, problem);
+  EXPECT_EQ(expected, runtime);
+
+  // A row at a time evaluation is used in place of force when it is set.
+  // Rows are evaluated on several threads, so the count must be atomic
+  std::atomic<int> rowCalls(0);
+  problem.setForce(nullptr);
+  problem.setForceRow([&rowCalls](double y, const MathVector<double>& x,
+      MathVector<double>& values)
+  {
+    ++rowCalls;
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+      values[i] = forcingFunction(x[i], y);
+    }
+  });
+  MathVector<double> batched = dirichlet.getSolution(6, problem);
+  EXPECT_EQ(expected, batched);
+  EXPECT_EQ(5, rowCalls);
+
+  MathVector<double> actual = dirichlet.getActualSolution<Solution>(6);
+  MathVector<double> runtimeActual = dirichlet.getActualSolution(6,
+      [](double x, double y) { return Solution(x, y); });
+  EXPECT_EQ(actual, runtimeActual);
+}
+
+int boundaryCalls = 0;
+
+double CountedBound(double x)
+{
+  ++boundaryCalls;
+  return lowerBound(x);
+}
+
+TEST_F(DirichletPoissonTest, CachedBoundaries)
+{
+  GaussianEliminationSolver<double> mySolver;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, mySolver);
+
+  boundaryCalls = 0;
+  MathVector<double> first = dirichlet.getSolution
+    <CountedBound, upperBound, leftBound, rightBound, forcingFunction>(6);
+  EXPECT_EQ(5, boundaryCalls);
+  MathVector<double> second = dirichlet.getSolution
+    <CountedBound, upperBound, leftBound, rightBound, forcingFunction>(6);
+  EXPECT_EQ(5, boundaryCalls);
+  EXPECT_EQ(first, second);
+
+  // Other functions or another resolution rebuild the tables
+  MathVector<double> other = dirichlet.getSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(6);
+  EXPECT_EQ(first, other);
+  dirichlet.getSolution
+    <CountedBound, upperBound, leftBound, rightBound, forcingFunction>(6);
+  EXPECT_EQ(10, boundaryCalls);
+  dirichlet.getSolution
+    <CountedBound, upperBound, leftBound, rightBound, forcingFunction>(4);
+  EXPECT_EQ(13, boundaryCalls);
+
+  int problemCalls = 0;
+  PoissonProblem<double> problem(lowerBound, upperBound, leftBound,
+      [&problemCalls](double y) { ++problemCalls; return rightBound(y); },
+      forcingFunction);
+  dirichlet.getSolution(6, problem);
+  dirichlet.getSolution(6, problem);
+  EXPECT_EQ(5, problemCalls);
+  problem.changed();
+  dirichlet.getSolution(6, problem);
+  EXPECT_EQ(10, problemCalls);
+
+  // Replacing a function through a setter also rebuilds the tables
+  problem.setLeft(leftBound);
+  dirichlet.getSolution(6, problem);
+  EXPECT_EQ(15, problemCalls);
+}
+
+class CountingSolver : public GaussianEliminationSolver<double>
+{
+  public:
+    CountingSolver() : factorCalls(0) {}
+
+    using GaussianEliminationSolver<double>::factor;
+    virtual std::unique_ptr<IMatrixFactorization<double> >
+      factor(MathMatrix<double>&& A) const
+    {
+      ++factorCalls;
+      return GaussianEliminationSolver<double>::factor(std::move(A));
+    }
+
+    mutable int factorCalls;
+};
+
+TEST_F(DirichletPoissonTest, Resolve)
+{
+  CountingSolver solver;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, solver);
+
+  MathVector<double> expected = dirichlet.getSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(6);
+  MathVector<double> cached = dirichlet.resolve
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(6);
+  EXPECT_EQ(expected, cached);
+  EXPECT_EQ(1, solver.factorCalls);
+
+  // Different functions at the same resolution reuse the factorization
+  PoissonProblem<double> problem(FnOne, FnOne, FnOne, FnOne, FnZero);
+  MathVector<double> ones = dirichlet.resolve(6, problem);
+  EXPECT_EQ(dirichlet.getSolution(6, problem), ones);
+  EXPECT_EQ(1, solver.factorCalls);
+
+  dirichlet.resolve(4, problem);
+  dirichlet.resolve(6, problem);
+  EXPECT_EQ(2, solver.factorCalls);
+
+  dirichlet.clearOperatorCache();
+  dirichlet.resolve(6, problem);
+  EXPECT_EQ(3, solver.factorCalls);
+
+  QRSolver<double> qrSolver;
+  DirichletPoisson<double, QRSolver<double> > qrDirichlet(0, 0, 1.0, qrSolver);
+  MathVector<double> qrResult = qrDirichlet.resolve(6, problem);
+  for (size_t i = 0; i < ones.size(); ++i)
+  {
+    EXPECT_NEAR(ones[i], qrResult[i], 1e-12);
+  }
+}
+
+TEST_F(DirichletPoissonTest, ReusedProblemAddress)
+{
+  // Each problem is built in the same stack slot, which must not bring back
+  // the boundary tables of the one before it
+  GaussianEliminationSolver<double> gauss;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, gauss);
+  for (int k = 1; k <= 3; ++k)
+  {
+    double value = k;
+    PoissonProblem<double> problem(
+        [value](double) { return value; }, [value](double) { return value; },
+        [value](double) { return value; }, [value](double) { return value; },
+        FnZero);
+    MathVector<double> solved = dirichlet.getSolution(4, problem);
+    MathVector<double> resolved = dirichlet.resolve(4, problem);
+    for (size_t i = 0; i < solved.size(); ++i)
+    {
+      EXPECT_NEAR(value, solved[i], 1e-12);
+      EXPECT_NEAR(value, resolved[i], 1e-12);
+    }
+  }
+
+  PoissonProblem<double> problem(FnOne, FnOne, FnOne, FnOne, FnZero);
+  PoissonProblem<double> copy(problem);
+  EXPECT_NE(problem.identity(), copy.identity());
+}
+
+TEST_F(DirichletPoissonTest, NestedReusedProblemAddress)
+{
+  // A new problem in the same stack slot starts from zero, exactly as it
+  // would on a fresh instance, rather than from the previous solution
+  ConjugateGradientSolver<double> cg(1e-12);
+  DirichletPoisson<double> nested(0, 0, 1.0, cg);
+  for (int k = 1; k <= 3; ++k)
+  {
+    double value = k;
+    PoissonProblem<double> problem(
+        [value](double) { return value; }, [value](double) { return value; },
+        [value](double) { return value; }, [value](double) { return value; },
+        [value](double x, double y) { return value * x * y; });
+    MathVector<double> reused = nested.getNestedSolution(8, problem);
+    size_t reusedIterations = cg.iterations();
+
+    DirichletPoisson<double> fresh(0, 0, 1.0, cg);
+    MathVector<double> cold = fresh.getNestedSolution(8, problem);
+    EXPECT_EQ(cg.iterations(), reusedIterations);
+    for (size_t i = 0; i < cold.size(); ++i)
+    {
+      EXPECT_NEAR(cold[i], reused[i], 1e-9);
+    }
+  }
+}
+
+TEST_F(DirichletPoissonTest, WarmStart)
+{
+  ConjugateGradientSolver<double> cg(1e-12);
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, cg);
+
+  MathVector<double> first = dirichlet.getSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(12);
+  size_t coldIterations = cg.iterations();
+
+  // A slightly perturbed problem started from the previous solution
+  double scale = 1.001;
+  PoissonProblem<double> problem(lowerBound, upperBound, leftBound,
+      rightBound, [scale](double x, double y)
+      {
+        return scale * forcingFunction(x, y);
+      });
+  MathVector<double> warm = dirichlet.getSolution(12, problem, first);
+  size_t warmIterations = cg.iterations();
+  EXPECT_LT(warmIterations, coldIterations);
+
+  MathVector<double> cold = dirichlet.getSolution(12, problem);
+  GaussianEliminationSolver<double> gauss;
+  DirichletPoisson<double> direct(0, 0, 1.0, gauss);
+  MathVector<double> expected = direct.getSolution(12, problem, first);
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], warm[i], 1e-9);
+    EXPECT_NEAR(expected[i], cold[i], 1e-9);
+  }
+}
+
+TEST_F(DirichletPoissonTest, Interpolate)
+{
+  // Bilinear functions are reproduced exactly by bilinear interpolation
+  std::function<double(double, double)> bilinear = [](double x, double y)
+  {
+    return x + 2*y + x*y;
+  };
+  PoissonProblem<double> problem(
+      [](double x) { return x; }, [](double x) { return 2*x + 2; },
+      [](double y) { return 2*y; }, [](double y) { return 1 + 3*y; },
+      FnZero);
+
+  GaussianEliminationSolver<double> gauss;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, gauss);
+  MathVector<double> coarse = dirichlet.getActualSolution(3, bilinear);
+  MathVector<double> fine = dirichlet.interpolateSolution(coarse, 3, 7, problem);
+  MathVector<double> expected = dirichlet.getActualSolution(7, bilinear);
+  ASSERT_EQ(expected.size(), fine.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], fine[i], 1e-12);
+  }
+
+  EXPECT_THROW(dirichlet.interpolateSolution(coarse, 4, 7, problem),
+      std::domain_error);
+}
+
+TEST_F(DirichletPoissonTest, NestedSolution)
+{
+  ConjugateGradientSolver<double> cg(1e-12);
+  DirichletPoisson<double> nested(0, 0, 1.0, cg);
+  for (int divs = 4; divs < 16; divs += 2)
+  {
+    nested.getNestedSolution
+      <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(divs);
+  }
+  MathVector<double> warm = nested.getNestedSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(16);
+  size_t warmIterations = cg.iterations();
+
+  DirichletPoisson<double> single(0, 0, 1.0, cg);
+  MathVector<double> cold = single.getSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(16);
+  EXPECT_LT(warmIterations, cg.iterations());
+
+  for (size_t i = 0; i < cold.size(); ++i)
+  {
+    EXPECT_NEAR(cold[i], warm[i], 1e-9);
+  }
+}
+
 TEST_F(DirichletPoissonTest, Solve)
 {
   GaussianEliminationSolver<double> mySolver;
@@ -71,6 +370,21 @@ TEST_F(DirichletPoissonTest, Solve)
   std::cout << "actual:\n" << actual << std::endl;
 }
 
+TEST_F(DirichletPoissonTest, StaticSolver)
+{
+  GaussianEliminationSolver<double> gauss;
+  DirichletPoisson<double> dynamicDirichlet(0, 0, 1.0, gauss);
+  DirichletPoisson<double, GaussianEliminationSolver<double> >
+    staticDirichlet(0, 0, 1.0, gauss);
+
+  MathVector<double> dynamicResult = dynamicDirichlet.getSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(5);
+  MathVector<double> staticResult = staticDirichlet.getSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(5);
+
+  EXPECT_EQ(dynamicResult, staticResult);
+}
+
 TEST_F(DirichletPoissonTest, LargeSolve)
 {
   GaussianEliminationSolver<double> mySolver;
@@ -0,0 +1,181 @@
+/*
+ * author Connor Walsh
+ * file   GMRESSolverTest.h
+ * brief  Class to represent a set of unit tests for GMRESSolver
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/GMRESSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/matrix_solver/JacobiPreconditioner.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/IMathMatrix.h"
+#include "../linear_algebra/math_matrix/SparseMathMatrix.h"
+#include "../linear_algebra/DirichletPoisson.h"
+#include "../parallel/ThreadPool.h"
+
+class GMRESSolverTest : public ::testing::Test
+{
+  protected:
+    // The Poisson operator with a convection term along x, so not
+    // symmetric, and row i scaled by scale^(i % 3)
+    static MathMatrix<double> convection(int numDivs, double scale = 1)
+    {
+      GaussianEliminationSolver<double> solver;
+      DirichletPoisson<double> dirichlet(0, 0, 1.0, solver, numDivs);
+      MathMatrix<double> A(dirichlet.getSparseOperator(numDivs));
+      int width = numDivs - 1;
+      int size = width * width;
+      for (int i = 0; i < size; ++i)
+      {
+        if (i % width != width - 1) A(i, i + 1) += 0.2;
+        if (i % width != 0) A(i, i - 1) -= 0.2;
+        double factor = (i % 3 == 0) ? 1 : (i % 3 == 1) ? scale : scale * scale;
+        for (int j = 0; j < size; ++j)
+        {
+          A(i, j) *= factor;
+        }
+      }
+      return A;
+    }
+
+    static MathVector<double> ramp(size_t size)
+    {
+      MathVector<double> b(size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        b[i] = (i % 5) - 1.5;
+      }
+      return b;
+    }
+};
+
+TEST_F(GMRESSolverTest, Solve)
+{
+  MathMatrix<double> A = convection(8);
+  MathVector<double> b = ramp(49);
+
+  GMRESSolver<double> gmres;
+  GaussianEliminationSolver<double> gauss;
+  const IMatrixSolver<double>& solver = gmres;
+  MathVector<double> expected = gauss(A, b);
+  MathVector<double> result = solver(A, b);
+  for (int i = 0; i < 49; ++i)
+  {
+    EXPECT_NEAR(expected[i], result[i], 1e-8);
+  }
+  EXPECT_GT(gmres.iterations(), 0u);
+  EXPECT_LE(gmres.iterations(), 49u);
+
+  // A guess that already solves the system needs no iterations at all
+  MathVector<double> exact = solver.solveFrom(A, b, result);
+  EXPECT_EQ(0u, gmres.iterations());
+  EXPECT_EQ(result, exact);
+
+  MathVector<double> moved = gmres(std::move(A), std::move(b));
+  EXPECT_EQ(result, moved);
+}
+
+TEST_F(GMRESSolverTest, Restart)
+{
+  MathMatrix<double> A = convection(8);
+  MathVector<double> b = ramp(49);
+
+  // Without restarts GMRES finishes within the number of unknowns, and
+  // short cycles take more iterations to get there
+  GMRESSolver<double> full(49);
+  GMRESSolver<double> restarted(4);
+  MathVector<double> x = full(A, b);
+  MathVector<double> y = restarted(A, b);
+  EXPECT_LE(full.iterations(), 49u);
+  EXPECT_LT(full.iterations(), restarted.iterations());
+  EXPECT_EQ(4u, restarted.restart());
+  for (int i = 0; i < 49; ++i)
+  {
+    EXPECT_NEAR(x[i], y[i], 1e-8);
+  }
+}
+
+TEST_F(GMRESSolverTest, Preconditioned)
+{
+  // Rows of very different scale are evened out by the diagonal
+  MathMatrix<double> A = convection(10, 10);
+  MathVector<double> b = ramp(81);
+  GaussianEliminationSolver<double> gauss;
+  MathVector<double> expected = gauss(A, b);
+
+  GMRESSolver<double> gmres(20, 1e-10, 1000);
+  gmres(A, b);
+  size_t plainIterations = gmres.iterations();
+
+  JacobiPreconditioner<double> jacobi(A);
+  typedef GMRESSolver<double>::Side Side;
+  for (Side side : { Side::Left, Side::Right })
+  {
+    gmres.setPreconditioner(jacobi, side);
+    EXPECT_EQ(&jacobi, gmres.preconditioner());
+    EXPECT_EQ(side, gmres.side());
+    MathVector<double> x = gmres(A, b);
+    for (int i = 0; i < 81; ++i)
+    {
+      EXPECT_NEAR(expected[i], x[i], 1e-6);
+    }
+    EXPECT_LT(gmres.iterations(), plainIterations);
+  }
+
+  gmres.clearPreconditioner();
+  EXPECT_EQ(nullptr, gmres.preconditioner());
+}
+
+TEST_F(GMRESSolverTest, SparseThreads)
+{
+  // The sparse kernel gives the dense result, the same for any thread count
+  MathMatrix<double> dense = convection(30);
+  SparseMathMatrix<double> A(dense);
+  MathVector<double> b = ramp(A.rows());
+  GMRESSolver<double> gmres;
+
+  ThreadCountScope threads(1);
+  MathVector<double> serial = gmres.solve(A, b);
+  size_t serialIterations = gmres.iterations();
+
+  threads.set(4);
+  MathVector<double> parallel = gmres.solve(A, b);
+  EXPECT_EQ(serial, parallel);
+  EXPECT_EQ(serialIterations, gmres.iterations());
+
+  MathVector<double> residual = A * parallel;
+  residual -= b;
+  EXPECT_LT(residual.getMagnitude(), 1e-9 * b.getMagnitude());
+}
+
+TEST_F(GMRESSolverTest, Failure)
+{
+  MathMatrix<double> A = convection(8);
+  MathVector<double> b = ramp(49);
+
+  EXPECT_THROW(GMRESSolver<double>(0), std::domain_error);
+
+  GMRESSolver<double> gmres(4, 1e-10, 3);
+  EXPECT_THROW(gmres(A, b), std::domain_error);
+
+  GMRESSolver<double> solver;
+  EXPECT_THROW(solver.solve(A, ramp(48)), std::domain_error);
+
+  JacobiPreconditioner<double> small(convection(7));
+  solver.setPreconditioner(small);
+  EXPECT_THROW(solver.solve(A, b), std::domain_error);
+
+  MathMatrix<double> singular(3, 3);
+  singular(0, 0) = 1;
+  singular(1, 1) = 1;
+  EXPECT_THROW(GMRESSolver<double>().solve(singular, ramp(3)),
+      std::domain_error);
+  EXPECT_THROW(JacobiPreconditioner<double> diagonal(singular),
+      std::domain_error);
+}
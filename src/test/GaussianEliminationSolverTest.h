@@ -5,12 +5,14 @@
  */
 
 #include <stdexcept>
+#include <utility>
 
 #include "gtest/gtest.h"
 
 #include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
 #include "../linear_algebra/MathVector.h"
 #include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/UpTriangleMathMatrix.h"
 #include "../linear_algebra/math_matrix/IMathMatrix.h"
 
 class GaussianEliminationSolverTest : public ::testing::Test {
@@ -129,3 +131,210 @@ TEST_F(GaussianEliminationSolverTest, FunctionOperator)
 
   EXPECT_EQ(answer, gauss(A, b));
 }
+
+TEST_F(GaussianEliminationSolverTest, StaticSolve)
+{
+  GaussianEliminationSolver<double> gauss;
+
+  UpTriangleMathMatrix<double> A(3, 3);
+  A(0, 0) = 1;
+  A(0, 1) = 2;
+  A(0, 2) = 3;
+  A(1, 1) = 1;
+  A(1, 2) = 2;
+  A(2, 2) = 1;
+
+  MathVector<double> b(3);
+  b[0] = 3;
+  b[1] = 1;
+  b[2] = 1;
+
+  MathVector<double> answer(3);
+  answer[0] = 2;
+  answer[1] = -1;
+  answer[2] = 1;
+
+  EXPECT_EQ(answer, gauss.solve(A, b));
+
+  const IMatrixSolver<double>& solverRef = gauss;
+  EXPECT_EQ(answer, solverRef.solve(A, b));
+}
+
+TEST_F(GaussianEliminationSolverTest, ConsumingSolve)
+{
+  GaussianEliminationSolver<double> gauss(true);
+
+  // Needs a row exchange since the first pivot is zero
+  MathMatrix<double> A(3, 3);
+  A(0, 0) = 0;
+  A(0, 1) = 1;
+  A(0, 2) = 2;
+  A(1, 0) = 1;
+  A(1, 1) = 2;
+  A(1, 2) = 3;
+  A(2, 0) = 0;
+  A(2, 1) = 0;
+  A(2, 2) = 1;
+
+  MathVector<double> b(3);
+  b[0] = 1;
+  b[1] = 3;
+  b[2] = 1;
+
+  MathVector<double> answer(3);
+  answer[0] = 2;
+  answer[1] = -1;
+  answer[2] = 1;
+
+  EXPECT_EQ(answer, gauss(A, b));
+
+  const IMatrixSolver<double>& solverRef = gauss;
+  EXPECT_EQ(answer, solverRef(std::move(A), std::move(b)));
+
+  GaussianEliminationSolver<double> noPivot;
+  MathMatrix<double> singular(2, 2);
+  singular(0, 1) = 1;
+  singular(1, 0) = 1;
+  MathVector<double> constants(2);
+  EXPECT_THROW(noPivot(std::move(singular), std::move(constants)),
+      std::domain_error);
+}
+
+TEST_F(GaussianEliminationSolverTest, Factor)
+{
+  MathMatrix<double> A(3, 3);
+  A(0, 0) = 0;
+  A(0, 1) = 1;
+  A(0, 2) = 2;
+  A(1, 0) = 1;
+  A(1, 1) = 2;
+  A(1, 2) = 3;
+  A(2, 0) = 4;
+  A(2, 1) = 0;
+  A(2, 2) = 1;
+
+  GaussianEliminationSolver<double> gauss(true);
+  std::unique_ptr<IMatrixFactorization<double> > lu = gauss.factor(A);
+  EXPECT_EQ(3, lu->rows());
+  EXPECT_EQ(3, lu->cols());
+
+  // Each right hand side gives exactly what a full solve gives
+  for (int rhs = 0; rhs < 3; ++rhs)
+  {
+    MathVector<double> b(3);
+    b[0] = 1 + rhs;
+    b[1] = 3 - rhs;
+    b[2] = 2 * rhs;
+    EXPECT_EQ(gauss(A, b), lu->solve(b));
+  }
+
+  EXPECT_THROW(lu->solve(MathVector<double>(2)), std::domain_error);
+  EXPECT_THROW(GaussianEliminationSolver<double>().factor(A), std::domain_error);
+}
+
+TEST_F(GaussianEliminationSolverTest, FactorSeveralExchanges)
+{
+  // Pivoting exchanges rows at both steps, which moves the multipliers of
+  // the first step again
+  MathMatrix<double> A(3, 3);
+  A(0, 0) = 1;
+  A(0, 1) = 2;
+  A(0, 2) = 3;
+  A(1, 0) = 4;
+  A(1, 1) = 5;
+  A(1, 2) = 6;
+  A(2, 0) = 7;
+  A(2, 1) = 8;
+  A(2, 2) = 10;
+  MathVector<double> b(3);
+  b[0] = 1;
+  b[1] = 2;
+  b[2] = 3;
+
+  GaussianEliminationSolver<double> gauss(true);
+  MathVector<double> expected = gauss(A, b);
+  EXPECT_NEAR(-1.0 / 3, expected[0], 1e-12);
+  EXPECT_NEAR(2.0 / 3, expected[1], 1e-12);
+  EXPECT_NEAR(0, expected[2], 1e-12);
+
+  std::unique_ptr<IMatrixFactorization<double> > lu = gauss.factor(A);
+  MathVector<double> x = lu->solve(b);
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_NEAR(expected[i], x[i], 1e-12);
+  }
+}
+
+TEST_F(GaussianEliminationSolverTest, MultipleRightHandSides)
+{
+  int size = 12;
+  int numRhs = 40;
+  MathMatrix<double> A(size, size);
+  MathMatrix<double> B(size, numRhs);
+  for (int row = 0; row < size; ++row)
+  {
+    for (int col = 0; col < size; ++col)
+    {
+      A(row, col) = (row == col) ? 4 : 1.0 / (1 + row + 2 * col);
+    }
+    for (int rhs = 0; rhs < numRhs; ++rhs)
+    {
+      B(row, rhs) = row - 0.5 * rhs;
+    }
+  }
+
+  GaussianEliminationSolver<double> gauss(true);
+  MathMatrix<double> X = gauss.solveMultiple(A, B);
+  EXPECT_EQ(size, X.rows());
+  EXPECT_EQ(numRhs, X.cols());
+
+  // Every column matches the single vector solve exactly
+  for (int rhs = 0; rhs < numRhs; ++rhs)
+  {
+    MathVector<double> b(size);
+    for (int row = 0; row < size; ++row)
+    {
+      b[row] = B(row, rhs);
+    }
+    MathVector<double> x = gauss(A, b);
+    for (int row = 0; row < size; ++row)
+    {
+      EXPECT_EQ(x[row], X(row, rhs));
+    }
+  }
+
+  MathMatrix<double> consumed = gauss.solveMultiple(MathMatrix<double>(A),
+      MathMatrix<double>(B));
+  EXPECT_EQ(X, consumed);
+  EXPECT_THROW(gauss.solveMultiple(A, MathMatrix<double>(3, 2)),
+      std::domain_error);
+
+  // Large values on the anti-diagonal make pivoting exchange rows at many
+  // steps, and every column must still match the factored vector solve
+  MathMatrix<double> pivoted(size, size);
+  for (int row = 0; row < size; ++row)
+  {
+    for (int col = 0; col < size; ++col)
+    {
+      pivoted(row, col) = (row + col == size - 1) ? 4 + row :
+        1.0 / (1 + row + 2 * col);
+    }
+  }
+  std::unique_ptr<IMatrixFactorization<double> > lu = gauss.factor(pivoted);
+  MathMatrix<double> pivotedX = gauss.solveMultiple(pivoted, B);
+  for (int rhs = 0; rhs < numRhs; ++rhs)
+  {
+    MathVector<double> b(size);
+    for (int row = 0; row < size; ++row)
+    {
+      b[row] = B(row, rhs);
+    }
+    MathVector<double> x = lu->solve(b);
+    MathVector<double> direct = gauss(pivoted, b);
+    for (int row = 0; row < size; ++row)
+    {
+      EXPECT_EQ(x[row], pivotedX(row, rhs));
+      EXPECT_NEAR(direct[row], x[row], 1e-12);
+    }
+  }
+}
@@ -0,0 +1,81 @@
+/*
+ * author Connor Walsh
+ * file   JacobiSolverTest.h
+ * brief  Class to represent a set of unit tests for JacobiSolver
+ */
+
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/JacobiSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../parallel/ThreadPool.h"
+
+class JacobiSolverTest : public ::testing::Test
+{
+  protected:
+    // Strictly diagonally dominant, so every relaxation method converges
+    static MathMatrix<double> dominantMatrix(int size)
+    {
+      MathMatrix<double> A(size, size);
+      for (int row = 0; row < size; ++row)
+      {
+        for (int col = 0; col < size; ++col)
+        {
+          A(row, col) = 1.0 / (1 + row + 2 * col);
+        }
+        A(row, row) = 2.0 * size;
+      }
+      return A;
+    }
+};
+
+TEST_F(JacobiSolverTest, Solve)
+{
+  MathMatrix<double> A = dominantMatrix(30);
+  MathVector<double> b(30);
+  for (int i = 0; i < 30; ++i)
+  {
+    b[i] = i % 5 - 2.0;
+  }
+
+  JacobiSolver<double> jacobi;
+  GaussianEliminationSolver<double> gauss;
+  MathVector<double> expected = gauss(A, b);
+  MathVector<double> result = jacobi(A, b);
+  for (int i = 0; i < 30; ++i)
+  {
+    EXPECT_NEAR(expected[i], result[i], 1e-9);
+  }
+  size_t coldIterations = jacobi.iterations();
+  EXPECT_GT(coldIterations, 0u);
+
+  // The result does not depend on the number of threads
+  ThreadCountScope threads(1);
+  MathVector<double> serial = jacobi(A, b);
+  threads.set(4);
+  EXPECT_EQ(serial, jacobi(A, b));
+
+  b[0] += 1e-4;
+  jacobi.solveFrom(A, b, result);
+  EXPECT_LT(jacobi.iterations(), coldIterations);
+}
+
+TEST_F(JacobiSolverTest, Errors)
+{
+  MathMatrix<double> A = dominantMatrix(4);
+  MathVector<double> b(4);
+  b[1] = 1;
+
+  JacobiSolver<double> jacobi;
+  EXPECT_THROW(jacobi(A, MathVector<double>(3)), std::domain_error);
+
+  A(2, 2) = 0;
+  EXPECT_THROW(jacobi(A, b), std::domain_error);
+
+  JacobiSolver<double> limited(1e-12, 2);
+  EXPECT_THROW(limited(dominantMatrix(4), b), std::domain_error);
+}
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+// author Connor Walsh
+// file   MathMatrixViewTest.h
+// brief  Class to represent a set of unit tests for MathMatrixView's
+////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "gtest/gtest.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/MathMatrixView.h"
+
+class MathMatrixViewTest : public ::testing::Test
+{
+  protected:
+    MathMatrixViewTest() : matrix(4, 5)
+    {
+      for (int row = 0; row < 4; ++row)
+      {
+        for (int col = 0; col < 5; ++col)
+        {
+          matrix(row, col) = 10 * row + col;
+        }
+      }
+    }
+
+    MathMatrix<double> matrix;
+};
+
+TEST_F(MathMatrixViewTest, Block)
+{
+  MathMatrixView<double> view = matrix.block(1, 2, 2, 3);
+  EXPECT_EQ(2, view.rows());
+  EXPECT_EQ(3, view.cols());
+  EXPECT_EQ(12, view(0, 0));
+  EXPECT_EQ(24, view(1, 2));
+
+  view(1, 1) = -1;
+  EXPECT_EQ(-1, matrix(2, 3));
+
+  EXPECT_THROW(view(2, 0), std::out_of_range);
+  EXPECT_THROW(matrix.block(3, 3, 2, 2), std::out_of_range);
+}
+
+TEST_F(MathMatrixViewTest, RowsAndColumns)
+{
+  MathMatrixView<double> rows = matrix.rowRange(1, 2);
+  EXPECT_EQ(2, rows.rows());
+  EXPECT_EQ(5, rows.cols());
+  EXPECT_EQ(10, rows(0, 0));
+
+  MathMatrixView<double> cols = matrix.colRange(3, 2);
+  EXPECT_EQ(4, cols.rows());
+  EXPECT_EQ(2, cols.cols());
+  EXPECT_EQ(34, cols(3, 1));
+
+  // Views of views refer back to the original matrix
+  MathMatrixView<double> inner = rows.colRange(1, 3).block(1, 1, 1, 2);
+  EXPECT_EQ(22, inner(0, 0));
+  EXPECT_EQ(23, inner(0, 1));
+}
+
+TEST_F(MathMatrixViewTest, Strided)
+{
+  MathMatrixView<double> even = MathMatrixView<double>(matrix).strided(2, 2);
+  EXPECT_EQ(2, even.rows());
+  EXPECT_EQ(3, even.cols());
+  EXPECT_EQ(0, even(0, 0));
+  EXPECT_EQ(24, even(1, 2));
+
+  MathMatrixView<double> odd(matrix, 1, 1, 2, 2, 2, 2);
+  EXPECT_EQ(11, odd(0, 0));
+  EXPECT_EQ(33, odd(1, 1));
+}
+
+TEST_F(MathMatrixViewTest, Transposed)
+{
+  MathMatrixView<double> trans = matrix.transposeView();
+  EXPECT_EQ(5, trans.rows());
+  EXPECT_EQ(4, trans.cols());
+  EXPECT_TRUE(trans == matrix.transpose());
+
+  MathMatrixView<double> transBlock = trans.block(1, 2, 3, 1);
+  EXPECT_EQ(21, transBlock(0, 0));
+  EXPECT_EQ(23, transBlock(2, 0));
+
+  MathMatrixView<double> back = matrix.block(1, 1, 2, 3).transposed()
+    .transposed();
+  EXPECT_TRUE(back == matrix.block(1, 1, 2, 3));
+}
+
+TEST_F(MathMatrixViewTest, ReadOnly)
+{
+  // Views of a const matrix are read-only, however they are copied
+  const MathMatrix<double>& constant = matrix;
+  ConstMathMatrixView<double> copied = constant.block(1, 2, 2, 3);
+  const ConstMathMatrixView<double>& view = copied;
+  EXPECT_EQ(12, view(0, 0));
+  EXPECT_EQ(24, view(1, 2));
+  EXPECT_EQ(12, copied.at(0, 0));
+  static_assert(std::is_same<decltype(copied.at(0, 0)), const double&>::value,
+      "Elements of a ConstMathMatrixView must be read-only");
+  static_assert(!std::is_constructible<MathMatrixView<double>,
+      ConstMathMatrixView<double> >::value,
+      "A ConstMathMatrixView must not convert to a writable view");
+
+  EXPECT_TRUE(view == matrix.block(1, 2, 2, 3));
+  EXPECT_TRUE(constant.rowRange(1, 2) == matrix.rowRange(1, 2));
+  EXPECT_TRUE(constant.colRange(3, 2) == matrix.colRange(3, 2));
+
+  const ConstMathMatrixView<double> trans = constant.transposeView();
+  EXPECT_EQ(5, trans.rows());
+  EXPECT_EQ(4, trans.cols());
+  EXPECT_EQ(31, trans(1, 3));
+  EXPECT_TRUE(trans.block(1, 2, 3, 1) == matrix.transposeView()
+      .block(1, 2, 3, 1));
+  EXPECT_TRUE(trans.transposed().strided(2, 2) ==
+      MathMatrixView<double>(matrix).strided(2, 2));
+
+  // A writable view converts to a read-only one of the same elements
+  const ConstMathMatrixView<double> converted = matrix.block(1, 1, 2, 2);
+  matrix(1, 1) = -1;
+  EXPECT_EQ(-1, converted(0, 0));
+  EXPECT_THROW(constant.block(3, 3, 2, 2), std::out_of_range);
+}
+
+TEST_F(MathMatrixViewTest, Arithmetic)
+{
+  MathMatrix<double> ones(2, 2);
+  ones(0, 0) = ones(0, 1) = ones(1, 0) = ones(1, 1) = 1;
+
+  MathMatrixView<double> view = matrix.block(0, 0, 2, 2);
+  view += ones;
+  EXPECT_EQ(1, matrix(0, 0));
+  EXPECT_EQ(12, matrix(1, 1));
+
+  view *= 2.0;
+  EXPECT_EQ(2, matrix(0, 0));
+  EXPECT_EQ(24, matrix(1, 1));
+
+  view.assign(ones);
+  EXPECT_TRUE(view == ones);
+  EXPECT_EQ(2, matrix(0, 2));
+
+  MathVector<double> vector(2);
+  vector[0] = 1;
+  vector[1] = 2;
+  MathVector<double> product = matrix.block(2, 0, 2, 2) * vector;
+  EXPECT_EQ(20 + 2 * 21, product[0]);
+  EXPECT_EQ(30 + 2 * 31, product[1]);
+
+  EXPECT_THROW(view += matrix, std::domain_error);
+}
@@ -9,6 +9,7 @@
 
 #include "gtest/gtest.h"
 #include "../linear_algebra/MathVector.h"
+#include "../parallel/ThreadPool.h"
 
 class MathVectorTest : public ::testing::Test {
 };
@@ -154,3 +155,54 @@ TEST_F(MathVectorTest, Magnitude)
   test[4] = 1.0;
   EXPECT_EQ(4.0, test.getMagnitude());
 }
+
+TEST_F(MathVectorTest, SmallVectorsStayInline)
+{
+  MathVector<double> point(3);
+  const char* object = reinterpret_cast<const char*>(&point);
+  const char* data = reinterpret_cast<const char*>(point.begin());
+  EXPECT_TRUE(data >= object && data < object + sizeof(point));
+
+  point[0] = 1.0;
+  point[2] = 2.0;
+  MathVector<double> other(MathVector<double>::inlineSize + 1);
+  other[4] = 5.0;
+
+  point = other;
+  EXPECT_EQ(5.0, point[4]);
+  other = MathVector<double>(3);
+  other[2] = 2.0;
+  EXPECT_EQ(2.0, other[2]);
+
+  MathVector<double> moved(std::move(other));
+  EXPECT_EQ(2.0, moved[2]);
+  EXPECT_EQ(4.0, (moved + moved)[2]);
+}
+
+TEST_F(MathVectorTest, ReproducibleDotProduct)
+{
+  MathVector<double> small(100);
+  MathVector<double> large(20 * MathVector<double>::reductionBlockSize + 7);
+  double serial = 0;
+  for (size_t i = 0; i < large.size(); ++i)
+  {
+    large[i] = ((i % 3 == 0) ? -1.0 : 1.0) / (i + 1);
+    if (i < small.size())
+    {
+      small[i] = large[i];
+      serial += small[i] * small[i];
+    }
+  }
+
+  // A single block is summed exactly like a serial loop
+  EXPECT_EQ(serial, small.dotProduct(small));
+
+  ThreadCountScope threads(1);
+  double oneThread = large.dotProduct(large);
+  double oneThreadMagnitude = large.getMagnitude();
+  threads.set(4);
+  double fourThreads = large.dotProduct(large);
+  double fourThreadMagnitude = large.getMagnitude();
+  EXPECT_EQ(oneThread, fourThreads);
+  EXPECT_EQ(oneThreadMagnitude, fourThreadMagnitude);
+}
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+// author Connor Walsh
+// file   MonotonicArenaTest.h
+// brief  Class to represent a set of unit tests for MonotonicArena
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+
+#include "gtest/gtest.h"
+#include "../containers/Array.h"
+#include "../containers/MonotonicArena.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/UpTriangleMathMatrix.h"
+#include "../linear_algebra/matrix_solver/QRSolver.h"
+
+class MonotonicArenaTest : public ::testing::Test {
+};
+
+TEST_F(MonotonicArenaTest, Allocate)
+{
+  MonotonicArena arena(256);
+  EXPECT_EQ(0, arena.bytesUsed());
+  EXPECT_EQ(0, arena.capacity());
+
+  void* first = arena.allocate(10, 8);
+  void* second = arena.allocate(16, 16);
+  EXPECT_EQ(0, reinterpret_cast<std::size_t>(second) % 16);
+  EXPECT_NE(first, second);
+  EXPECT_LE(26, arena.bytesUsed());
+  EXPECT_EQ(256, arena.capacity());
+
+  // Larger than a block gets a block of its own
+  arena.allocate(1000, 8);
+  EXPECT_LE(1256, arena.capacity());
+
+  MonotonicArena::Marker marker = arena.mark();
+  std::size_t used = arena.bytesUsed();
+  arena.allocate(100, 8);
+  arena.rewind(marker);
+  EXPECT_EQ(used, arena.bytesUsed());
+
+  std::size_t capacity = arena.capacity();
+  arena.release();
+  EXPECT_EQ(0, arena.bytesUsed());
+  EXPECT_EQ(first, arena.allocate(10, 8));
+  EXPECT_EQ(capacity, arena.capacity());
+}
+
+TEST_F(MonotonicArenaTest, ArrayInArena)
+{
+  MonotonicArena arena;
+  Array<double> outside(4);
+
+  {
+    ArenaRewind rewind(arena);
+    Array<double> inside(8, arena);
+    EXPECT_LE(8 * sizeof(double), arena.bytesUsed());
+    EXPECT_EQ(0, inside[7]);
+
+    // Only Arrays given the arena draw from it, and growing keeps drawing
+    // from it while copies go to the heap
+    std::size_t used = arena.bytesUsed();
+    Array<double> heapArray(8);
+    Array<double> copy(inside);
+    EXPECT_EQ(used, arena.bytesUsed());
+
+    inside[0] = 1;
+    inside.resize(16);
+    EXPECT_LE(used + 16 * sizeof(double), arena.bytesUsed());
+    EXPECT_EQ(1, inside[0]);
+    EXPECT_EQ(0, copy[0]);
+  }
+
+  EXPECT_EQ(0, arena.bytesUsed());
+  EXPECT_EQ(0, outside[0]);
+}
+
+TEST_F(MonotonicArenaTest, QRDecompositionReusesArena)
+{
+  MathMatrix<double> A(3, 3);
+  A(0, 0) = 12;
+  A(0, 1) = -51;
+  A(0, 2) = 4;
+  A(1, 0) = 6;
+  A(1, 1) = 167;
+  A(1, 2) = -68;
+  A(2, 0) = -4;
+  A(2, 1) = 24;
+  A(2, 2) = -41;
+
+  MathMatrix<double> Q(3, 3);
+  UpTriangleMathMatrix<double> R(3, 3);
+
+  QRSolver<double>::QRDecomposition(A, Q, R);
+  std::size_t capacity = MonotonicArena::threadArena().capacity();
+  EXPECT_LT(0, capacity);
+  EXPECT_EQ(0, MonotonicArena::threadArena().bytesUsed());
+
+  QRSolver<double>::QRDecomposition(A, Q, R);
+  EXPECT_EQ(capacity, MonotonicArena::threadArena().capacity());
+
+  // An explicit arena is used instead and rewound before returning
+  MonotonicArena scratch;
+  MathMatrix<double> explicitQ(3, 3);
+  QRSolver<double>::QRDecomposition(A, explicitQ, R, scratch);
+  EXPECT_LT(0, scratch.capacity());
+  EXPECT_EQ(0, scratch.bytesUsed());
+  EXPECT_EQ(Q, explicitQ);
+
+  EXPECT_NEAR(14, R(0, 0), 1e-10);
+  EXPECT_NEAR(175, R(1, 1), 1e-10);
+  EXPECT_NEAR(35, R(2, 2), 1e-10);
+  EXPECT_NEAR(6.0 / 7.0, Q(0, 0), 1e-10);
+}
@@ -0,0 +1,140 @@
+/*
+ * author Connor Walsh
+ * file   PipelinedConjugateGradientSolverTest.h
+ * brief  Class to represent a set of unit tests for
+ *        PipelinedConjugateGradientSolver
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/PipelinedConjugateGradientSolver.h"
+#include "../linear_algebra/matrix_solver/ConjugateGradientSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/IMathMatrix.h"
+#include "../linear_algebra/math_matrix/SparseMathMatrix.h"
+#include "../linear_algebra/DirichletPoisson.h"
+#include "../linear_algebra/PoissonFunctions.h"
+#include "../parallel/ThreadPool.h"
+
+class PipelinedConjugateGradientSolverTest : public ::testing::Test
+{
+  protected:
+    // Symmetric and diagonally dominant, so positive definite
+    static MathMatrix<double> spdMatrix(int size)
+    {
+      MathMatrix<double> A(size, size);
+      for (int row = 0; row < size; ++row)
+      {
+        for (int col = 0; col < size; ++col)
+        {
+          A(row, col) = 1.0 / (1 + row + col);
+        }
+        A(row, row) += size;
+      }
+      return A;
+    }
+};
+
+TEST_F(PipelinedConjugateGradientSolverTest, Solve)
+{
+  MathMatrix<double> A = spdMatrix(12);
+  MathVector<double> b(12);
+  for (int i = 0; i < 12; ++i)
+  {
+    b[i] = i - 4.0;
+  }
+
+  PipelinedConjugateGradientSolver<double> pipelined;
+  GaussianEliminationSolver<double> gauss;
+  const IMatrixSolver<double>& solver = pipelined;
+  MathVector<double> expected = gauss(A, b);
+  MathVector<double> result = solver(A, b);
+  for (int i = 0; i < 12; ++i)
+  {
+    EXPECT_NEAR(expected[i], result[i], 1e-9);
+  }
+  EXPECT_GT(pipelined.iterations(), 0u);
+  EXPECT_LE(pipelined.iterations(), 24u);
+
+  // A guess that already solves the system needs no iterations at all
+  MathVector<double> exact = solver.solveFrom(A, b, result);
+  EXPECT_EQ(0u, pipelined.iterations());
+  EXPECT_EQ(result, exact);
+
+  MathVector<double> moved = pipelined(std::move(A), std::move(b));
+  EXPECT_EQ(result, moved);
+}
+
+TEST_F(PipelinedConjugateGradientSolverTest, MatchesConjugateGradient)
+{
+  // In exact arithmetic the two take the same steps, so on the Poisson
+  // operator they agree on the solution and nearly on the iterations
+  const int numDivs = 40;
+  GaussianEliminationSolver<double> unused;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, unused);
+  SparseMathMatrix<double> A = dirichlet.getSparseOperator(numDivs);
+  MathVector<double> b(A.rows());
+  dirichlet.generateConstants
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(b);
+
+  ConjugateGradientSolver<double> cg;
+  PipelinedConjugateGradientSolver<double> pipelined;
+  MathVector<double> expected = cg.solve(A, b);
+  MathVector<double> x = pipelined.solve(A, b);
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], x[i], 1e-8);
+  }
+  EXPECT_LE(pipelined.iterations(), cg.iterations() + 5);
+  EXPECT_LE(cg.iterations(), pipelined.iterations() + 5);
+
+  MathVector<double> residual = A * x;
+  residual -= b;
+  EXPECT_LE(residual.getMagnitude(), 1e-10 * b.getMagnitude());
+}
+
+TEST_F(PipelinedConjugateGradientSolverTest, Threads)
+{
+  GaussianEliminationSolver<double> unused;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, unused);
+  SparseMathMatrix<double> A = dirichlet.getSparseOperator(60);
+  MathVector<double> b(A.rows());
+  dirichlet.generateConstants
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(b);
+  PipelinedConjugateGradientSolver<double> pipelined;
+
+  ThreadCountScope threads(1);
+  MathVector<double> serial = pipelined.solve(A, b);
+  size_t serialIterations = pipelined.iterations();
+
+  threads.set(4);
+  MathVector<double> parallel = pipelined.solve(A, b);
+  EXPECT_EQ(serial, parallel);
+  EXPECT_EQ(serialIterations, pipelined.iterations());
+}
+
+TEST_F(PipelinedConjugateGradientSolverTest, NotPositiveDefinite)
+{
+  MathMatrix<double> A = spdMatrix(4);
+  A(2, 2) = -10;
+  MathVector<double> b(4);
+  b[2] = 1;
+
+  PipelinedConjugateGradientSolver<double> pipelined;
+  EXPECT_THROW(pipelined(A, b), std::domain_error);
+  EXPECT_THROW(pipelined.solveFrom(A, b, MathVector<double>(3)),
+      std::domain_error);
+
+  MathVector<double> ones(10);
+  for (int i = 0; i < 10; ++i)
+  {
+    ones[i] = 1.0;
+  }
+  PipelinedConjugateGradientSolver<double> limited(1e-12, 1);
+  EXPECT_THROW(limited(spdMatrix(10), ones), std::domain_error);
+}
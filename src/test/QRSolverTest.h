@@ -5,6 +5,7 @@
  */
 
 #include <stdexcept>
+#include <utility>
 
 #include "gtest/gtest.h"
 
@@ -143,3 +144,104 @@ TEST_F(QRSolverTest, FunctionOperator)
 
   EXPECT_EQ(answer, solverRef(A, b));
 }
+
+TEST_F(QRSolverTest, ConsumingSolve)
+{
+  QRSolver<double> solver;
+
+  MathMatrix<double> A(2, 2);
+  A(0, 0) = 1;
+  A(0, 1) = 2;
+  A(1, 0) = 3;
+  A(1, 1) = -5;
+
+  MathVector<double> b(2);
+  b[0] = 4;
+  b[1] = 1;
+
+  MathVector<double> result = solver(std::move(A), std::move(b));
+  EXPECT_NEAR(2, result[0], 1e-12);
+  EXPECT_NEAR(1, result[1], 1e-12);
+
+  // Overdetermined but consistent system is solved in the least squares sense
+  MathMatrix<double> tall(3, 2);
+  tall(0, 0) = 1;
+  tall(1, 1) = 1;
+  tall(2, 0) = 1;
+  tall(2, 1) = 1;
+
+  MathVector<double> constants(3);
+  constants[0] = 2;
+  constants[1] = 3;
+  constants[2] = 5;
+
+  MathVector<double> solution = solver(std::move(tall), std::move(constants));
+  EXPECT_EQ(2, solution.size());
+  EXPECT_NEAR(2, solution[0], 1e-12);
+  EXPECT_NEAR(3, solution[1], 1e-12);
+
+  MathMatrix<double> singular(2, 2);
+  MathVector<double> zeros(2);
+  EXPECT_THROW(solver(std::move(singular), std::move(zeros)), std::domain_error);
+}
+
+TEST_F(QRSolverTest, Factor)
+{
+  MathMatrix<double> tall(3, 2);
+  tall(0, 0) = 1;
+  tall(1, 1) = 1;
+  tall(2, 0) = 1;
+  tall(2, 1) = 1;
+
+  QRSolver<double> solver;
+  std::unique_ptr<IMatrixFactorization<double> > qr = solver.factor(tall);
+  EXPECT_EQ(3, qr->rows());
+  EXPECT_EQ(2, qr->cols());
+
+  for (int rhs = 0; rhs < 3; ++rhs)
+  {
+    MathVector<double> constants(3);
+    constants[0] = 2 + rhs;
+    constants[1] = 3;
+    constants[2] = 5 + rhs;
+    EXPECT_EQ(solver(tall, constants), qr->solve(constants));
+  }
+
+  EXPECT_THROW(solver.factor(MathMatrix<double>(2, 2)), std::domain_error);
+}
+
+TEST_F(QRSolverTest, MultipleRightHandSides)
+{
+  MathMatrix<double> tall(4, 3);
+  MathMatrix<double> B(4, 5);
+  for (int row = 0; row < 4; ++row)
+  {
+    for (int col = 0; col < 3; ++col)
+    {
+      tall(row, col) = (row == col) ? 3 : row + col * 0.5;
+    }
+    for (int rhs = 0; rhs < 5; ++rhs)
+    {
+      B(row, rhs) = rhs - row;
+    }
+  }
+
+  QRSolver<double> solver;
+  MathMatrix<double> X = solver.solveMultiple(tall, B);
+  EXPECT_EQ(3, X.rows());
+  EXPECT_EQ(5, X.cols());
+
+  for (int rhs = 0; rhs < 5; ++rhs)
+  {
+    MathVector<double> b(4);
+    for (int row = 0; row < 4; ++row)
+    {
+      b[row] = B(row, rhs);
+    }
+    MathVector<double> x = solver(tall, b);
+    for (int row = 0; row < 3; ++row)
+    {
+      EXPECT_EQ(x[row], X(row, rhs));
+    }
+  }
+}
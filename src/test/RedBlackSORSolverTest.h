@@ -0,0 +1,74 @@
+/*
+ * author Connor Walsh
+ * file   RedBlackSORSolverTest.h
+ * brief  Class to represent a set of unit tests for RedBlackSORSolver
+ */
+
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/RedBlackSORSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/DirichletPoisson.h"
+#include "../linear_algebra/PoissonFunctions.h"
+#include "../parallel/ThreadPool.h"
+
+class RedBlackSORSolverTest : public ::testing::Test {};
+
+TEST_F(RedBlackSORSolverTest, MatchesDirectSolve)
+{
+  GaussianEliminationSolver<double> gauss;
+  RedBlackSORSolver<double> redBlack;
+
+  // Odd and even widths give rows of different lengths for each colour
+  for (int numDivs = 6; numDivs <= 9; ++numDivs)
+  {
+    DirichletPoisson<double> dirichlet(0, 0, 1.0, gauss);
+    MathVector<double> expected = dirichlet.getSolution
+      <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(numDivs);
+    MathVector<double> result = dirichlet.getGridSolution
+      <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(numDivs,
+          redBlack);
+    ASSERT_EQ(expected.size(), result.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      EXPECT_NEAR(expected[i], result[i], 1e-9);
+    }
+  }
+}
+
+TEST_F(RedBlackSORSolverTest, Smooth)
+{
+  int numDivs = 16;
+  GaussianEliminationSolver<double> gauss;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, gauss, numDivs);
+  MathVector<double> b((numDivs - 1) * (numDivs - 1));
+  dirichlet.generateConstants
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(b);
+
+  // Gauss-Seidel smoothing only ever lowers the residual
+  RedBlackSORSolver<double> smoother(1.0);
+  MathVector<double> x(b.size());
+  double residual = smoother.residualNorm(x, b, numDivs);
+  for (int step = 0; step < 5; ++step)
+  {
+    smoother.smooth(x, b, numDivs, 2);
+    double next = smoother.residualNorm(x, b, numDivs);
+    EXPECT_LT(next, residual);
+    residual = next;
+  }
+
+  // Sweeps are independent of the number of threads
+  MathVector<double> serial(b.size());
+  MathVector<double> parallel(b.size());
+  ThreadCountScope threads(1);
+  smoother.smooth(serial, b, numDivs, 3);
+  threads.set(4);
+  smoother.smooth(parallel, b, numDivs, 3);
+  EXPECT_EQ(serial, parallel);
+
+  EXPECT_THROW(smoother.smooth(x, b, numDivs + 1, 1), std::domain_error);
+}
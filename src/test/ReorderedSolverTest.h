@@ -0,0 +1,147 @@
+/*
+ * author Connor Walsh
+ * file   ReorderedSolverTest.h
+ * brief  Class to represent a set of unit tests for GraphOrdering and
+ *        ReorderedSolver
+ */
+
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../linear_algebra/matrix_solver/ReorderedSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/ordering/GraphOrdering.h"
+#include "../linear_algebra/ordering/Permutation.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/SparseMathMatrix.h"
+#include "../linear_algebra/DirichletPoisson.h"
+
+class ReorderedSolverTest : public ::testing::Test
+{
+  protected:
+    // The Poisson operator with its unknowns shuffled, as a matrix loaded
+    // from elsewhere might be numbered
+    static SparseMathMatrix<double> shuffledPoisson(int numDivs)
+    {
+      GaussianEliminationSolver<double> solver;
+      DirichletPoisson<double> dirichlet(0, 0, 1.0, solver, numDivs);
+      SparseMathMatrix<double> A = dirichlet.getSparseOperator(numDivs);
+
+      std::vector<size_t> order(A.rows());
+      for (size_t k = 0; k < order.size(); ++k)
+      {
+        order[k] = (k * 7) % order.size();
+      }
+      return A.permuted(Permutation(order));
+    }
+};
+
+TEST_F(ReorderedSolverTest, Permutation)
+{
+  Permutation permutation({2, 0, 1});
+  EXPECT_EQ(1u, permutation.position(0));
+  EXPECT_EQ(2u, permutation.order(0));
+
+  MathVector<double> b(3);
+  b[0] = 10;
+  b[1] = 20;
+  b[2] = 30;
+  MathVector<double> permuted = permutation.apply(b);
+  EXPECT_EQ(30, permuted[0]);
+  EXPECT_EQ(10, permuted[1]);
+  EXPECT_EQ(b, permutation.restore(permuted));
+  EXPECT_EQ(b, permutation.inverse().apply(permuted));
+  EXPECT_EQ(permutation, permutation.inverse().inverse());
+
+  EXPECT_THROW(Permutation({0, 0, 1}), std::domain_error);
+  EXPECT_THROW(Permutation({0, 3, 1}), std::domain_error);
+  EXPECT_THROW(permutation.apply(MathVector<double>(2)), std::domain_error);
+}
+
+TEST_F(ReorderedSolverTest, ReverseCuthillMcKee)
+{
+  SparseMathMatrix<double> A = shuffledPoisson(12);
+  Permutation rcm = GraphOrdering::reverseCuthillMcKee(A);
+  SparseMathMatrix<double> reordered = A.permuted(rcm);
+
+  // Breadth first levels of the grid are at most numDivs - 1 unknowns wide
+  EXPECT_LT(reordered.bandwidth(), A.bandwidth());
+  EXPECT_LE(reordered.bandwidth(), 2u * 11u);
+  EXPECT_LT(reordered.profile(), A.profile() / 2);
+
+  // Unconnected parts are each ordered on their own
+  SparseMathMatrix<double> split(4, 4, {0, 2, 3, 5, 6}, {0, 2, 1, 0, 2, 3},
+      MathVector<double>(6));
+  Permutation parts = GraphOrdering::reverseCuthillMcKee(split);
+  EXPECT_EQ(1u, split.permuted(parts).bandwidth());
+}
+
+TEST_F(ReorderedSolverTest, MinimumDegree)
+{
+  // An arrow matrix fills completely unless its dense unknown is among the
+  // last two
+  const size_t size = 8;
+  std::vector<size_t> rowStarts(1, 0);
+  std::vector<size_t> columns;
+  for (size_t i = 0; i < size; ++i)
+  {
+    if (i == 0)
+    {
+      for (size_t j = 0; j < size; ++j) columns.push_back(j);
+    }
+    else
+    {
+      columns.push_back(0);
+      columns.push_back(i);
+    }
+    rowStarts.push_back(columns.size());
+  }
+  SparseMathMatrix<double> arrow(size, size, rowStarts, columns,
+      MathVector<double>(columns.size()));
+
+  Permutation order = GraphOrdering::minimumDegree(arrow);
+  EXPECT_LE(size - 2, order.position(0));
+}
+
+TEST_F(ReorderedSolverTest, Solve)
+{
+  SparseMathMatrix<double> A = shuffledPoisson(9);
+  MathVector<double> b(A.rows());
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    b[i] = 1 + 0.1 * i;
+  }
+
+  GaussianEliminationSolver<double> gaussian;
+  MathVector<double> expected = gaussian(A, b);
+
+  ReorderedSolver<double> rcm(gaussian);
+  MathVector<double> x = rcm.solve(A, b);
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], x[i], 1e-10);
+  }
+  EXPECT_EQ(A.bandwidth(), rcm.report().bandwidthBefore);
+  EXPECT_LT(rcm.report().bandwidthAfter, rcm.report().bandwidthBefore);
+  EXPECT_LT(rcm.report().profileAfter, rcm.report().profileBefore);
+
+  ReorderedSolver<double> minimumDegree(gaussian,
+      ReorderedSolver<double>::Method::MinimumDegree);
+  const IMatrixSolver<double>& solver = minimumDegree;
+  x = solver(MathMatrix<double>(A), b);
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], x[i], 1e-10);
+  }
+
+  std::unique_ptr<IMatrixFactorization<double> > factored = rcm.factor(A);
+  x = factored->solve(b);
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], x[i], 1e-10);
+  }
+
+  EXPECT_THROW(rcm.solve(A, MathVector<double>(3)), std::domain_error);
+}
@@ -0,0 +1,95 @@
+/*
+ * author Connor Walsh
+ * file   SORSolverTest.h
+ * brief  Class to represent a set of unit tests for SORSolver and
+ *        GaussSeidelSolver
+ */
+
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/SORSolver.h"
+#include "../linear_algebra/matrix_solver/GaussSeidelSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/DirichletPoisson.h"
+#include "../linear_algebra/PoissonFunctions.h"
+
+class SORSolverTest : public ::testing::Test
+{
+  protected:
+    // The system DirichletPoisson generates for numDivs divisions
+    static void poissonSystem(int numDivs, MathMatrix<double>& A,
+        MathVector<double>& b)
+    {
+      GaussianEliminationSolver<double> unused;
+      DirichletPoisson<double> dirichlet(0, 0, 1.0, unused, numDivs);
+      int size = (numDivs - 1) * (numDivs - 1);
+      A = MathMatrix<double>(size, size);
+      b = MathVector<double>(size);
+      dirichlet.generate
+        <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(A, b);
+    }
+};
+
+TEST_F(SORSolverTest, GaussSeidel)
+{
+  MathMatrix<double> A;
+  MathVector<double> b;
+  poissonSystem(8, A, b);
+
+  GaussSeidelSolver<double> gaussSeidel;
+  GaussianEliminationSolver<double> gauss;
+  MathVector<double> expected = gauss(A, b);
+  MathVector<double> result = gaussSeidel(A, b);
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], result[i], 1e-9);
+  }
+}
+
+TEST_F(SORSolverTest, StopsOnTrueResidual)
+{
+  MathMatrix<double> A;
+  MathVector<double> b;
+  poissonSystem(8, A, b);
+
+  // The residuals seen during a sweep are not those of the final iterate,
+  // so a loose tolerance must still hold for b - Ax
+  for (double omega : {1.0, 0.0})
+  {
+    SORSolver<double> sor(omega, 1e-3);
+    MathVector<double> x = sor(A, b);
+    MathVector<double> residual = b - A * x;
+    EXPECT_LE(residual.getMagnitude(), 1e-3 * b.getMagnitude());
+  }
+}
+
+TEST_F(SORSolverTest, OptimalOmega)
+{
+  MathMatrix<double> A;
+  MathVector<double> b;
+  poissonSystem(8, A, b);
+
+  // For the Poisson operator the estimate approaches the known optimum
+  double optimal = SORSolver<double>::optimalPoissonOmega(8);
+  EXPECT_NEAR(optimal, SORSolver<double>::estimateOmega(A, 200), 1e-3);
+
+  GaussSeidelSolver<double> gaussSeidel;
+  gaussSeidel(A, b);
+
+  SORSolver<double> sor;
+  GaussianEliminationSolver<double> gauss;
+  MathVector<double> expected = gauss(A, b);
+  MathVector<double> result = sor(A, b);
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], result[i], 1e-9);
+  }
+  EXPECT_LT(2 * sor.iterations(), gaussSeidel.iterations());
+
+  EXPECT_THROW(SORSolver<double>(2.0), std::domain_error);
+  EXPECT_THROW(sor.setOmega(-0.5), std::domain_error);
+}
@@ -0,0 +1,101 @@
+/*
+ * author Connor Walsh
+ * file   SolverWorkspaceTest.h
+ * brief  Class to represent a set of unit tests for SolverWorkspace
+ */
+
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/SolverWorkspace.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/matrix_solver/QRSolver.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+
+class SolverWorkspaceTest : public ::testing::Test
+{
+  protected:
+    static MathMatrix<double> makeSystem(int size)
+    {
+      MathMatrix<double> A(size, size);
+      for (int i = 0; i < size; ++i)
+      {
+        A(i, i) = 4;
+        if (i > 0) A(i, i - 1) = -1;
+        if (i < size - 1) A(i, i + 1) = -1;
+      }
+      return A;
+    }
+};
+
+TEST_F(SolverWorkspaceTest, ReusesStorage)
+{
+  SolverWorkspace<double> workspace;
+  EXPECT_EQ(0, workspace.memoryBytes());
+
+  MathMatrix<double>& matrix = workspace.matrix(4, 5);
+  EXPECT_EQ(4, matrix.rows());
+  EXPECT_EQ(5, matrix.cols());
+  double* firstRow = &matrix(0, 0);
+
+  MathVector<double>& vector = workspace.vector(1, 6);
+  EXPECT_EQ(6, vector.size());
+
+  size_t highWater = workspace.highWaterBytes();
+  EXPECT_EQ(highWater, workspace.memoryBytes());
+
+  workspace.matrix(3, 3);
+  workspace.vector(1, 2);
+  workspace.matrix(4, 5);
+  workspace.vector(1, 6);
+  EXPECT_EQ(firstRow, &workspace.matrix(4, 4)(0, 0));
+  EXPECT_EQ(highWater, workspace.highWaterBytes());
+
+  workspace.release();
+  EXPECT_EQ(0, workspace.memoryBytes());
+  EXPECT_EQ(highWater, workspace.highWaterBytes());
+
+  EXPECT_THROW(workspace.vector(SolverWorkspace<double>::numVectors, 1),
+      std::out_of_range);
+}
+
+TEST_F(SolverWorkspaceTest, SteadyStateSolves)
+{
+  GaussianEliminationSolver<double> gauss;
+  QRSolver<double> qr;
+
+  MathMatrix<double> large = makeSystem(6);
+  MathMatrix<double> small = makeSystem(4);
+  MathVector<double> largeB(6);
+  MathVector<double> smallB(4);
+  largeB[0] = smallB[0] = 3;
+  largeB[5] = smallB[3] = 3;
+  for (int i = 1; i < 5; ++i) largeB[i] = 2;
+  smallB[1] = smallB[2] = 2;
+
+  MathVector<double> x;
+  gauss.solve(large, largeB, x);
+  qr.solve(large, largeB, x);
+  size_t gaussHighWater = gauss.workspace().highWaterBytes();
+  size_t qrHighWater = qr.workspace().highWaterBytes();
+  EXPECT_LT(0, gaussHighWater);
+  EXPECT_LT(0, qrHighWater);
+
+  for (int i = 0; i < 3; ++i)
+  {
+    gauss.solve(small, smallB, x);
+    for (double value : x) EXPECT_NEAR(1, value, 1e-12);
+    gauss.solve(large, largeB, x);
+    for (double value : x) EXPECT_NEAR(1, value, 1e-12);
+
+    qr.solve(small, smallB, x);
+    for (double value : x) EXPECT_NEAR(1, value, 1e-12);
+    qr.solve(large, largeB, x);
+    for (double value : x) EXPECT_NEAR(1, value, 1e-12);
+  }
+
+  EXPECT_EQ(gaussHighWater, gauss.workspace().highWaterBytes());
+  EXPECT_EQ(qrHighWater, qr.workspace().highWaterBytes());
+}
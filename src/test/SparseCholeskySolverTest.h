@@ -0,0 +1,256 @@
+/*
+ * author Connor Walsh
+ * file   SparseCholeskySolverTest.h
+ * brief  Class to represent a set of unit tests for the symbolic analysis
+ *        and the SparseCholeskySolver
+ */
+
+#include <stdexcept>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../linear_algebra/matrix_solver/SparseCholeskySolver.h"
+#include "../linear_algebra/matrix_solver/SymbolicCholesky.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/ordering/GraphOrdering.h"
+#include "../linear_algebra/ordering/Permutation.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/SparseMathMatrix.h"
+#include "../linear_algebra/math_matrix/TriDiagonalMathMatrix.h"
+#include "../linear_algebra/DirichletPoisson.h"
+#include "../linear_algebra/PoissonFunctions.h"
+#include "../parallel/ThreadPool.h"
+
+class SparseCholeskySolverTest : public ::testing::Test
+{
+  protected:
+    static SparseMathMatrix<double> poisson(int numDivs)
+    {
+      GaussianEliminationSolver<double> solver;
+      DirichletPoisson<double> dirichlet(0, 0, 1.0, solver, numDivs);
+      return dirichlet.getSparseOperator(numDivs);
+    }
+
+    static MathVector<double> ramp(size_t size)
+    {
+      MathVector<double> b(size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        b[i] = 1 + 0.01 * i;
+      }
+      return b;
+    }
+
+    static double residual(const SparseMathMatrix<double>& A,
+        const MathVector<double>& x, const MathVector<double>& b)
+    {
+      MathVector<double> r = A * x;
+      r -= b;
+      return r.getMagnitude();
+    }
+};
+
+TEST_F(SparseCholeskySolverTest, Symbolic)
+{
+  // A dense matrix is one supernode filling the whole lower triangle
+  MathMatrix<double> dense(5, 5);
+  for (int i = 0; i < 5; ++i)
+  {
+    for (int j = 0; j < 5; ++j)
+    {
+      dense(i, j) = (i == j) ? 10 : 1;
+    }
+  }
+  SymbolicCholesky full(SparseMathMatrix<double>(dense), Permutation(5));
+  EXPECT_EQ(1u, full.numSupernodes());
+  EXPECT_EQ(15u, full.factorNonZeros());
+  EXPECT_EQ(25u, full.valueCount());
+
+  // The elimination tree of a tridiagonal matrix is a path and its factor
+  // has no fill
+  SparseMathMatrix<double> tridiagonal(TriDiagonalMathMatrix<double>(6, -1, 4, -1));
+  SymbolicCholesky chain(tridiagonal, Permutation(6));
+  for (size_t j = 0; j + 1 < 6; ++j)
+  {
+    EXPECT_EQ(j + 1, chain.parents()[j]);
+    EXPECT_EQ(2u, chain.columnCounts()[j]);
+  }
+  EXPECT_EQ(6u, chain.parents()[5]);
+  EXPECT_EQ(11u, chain.factorNonZeros());
+
+  EXPECT_THROW(SymbolicCholesky(tridiagonal, Permutation(5)), std::domain_error);
+}
+
+TEST_F(SparseCholeskySolverTest, NestedDissection)
+{
+  // Every unknown appears once and the last one numbered is on the middle
+  // separator
+  Permutation order = GraphOrdering::nestedDissection(9, 7);
+  EXPECT_EQ(63u, order.size());
+  EXPECT_EQ(4u, order.order(62) % 9);
+
+  SparseMathMatrix<double> A = poisson(61);
+  SymbolicCholesky natural(A, Permutation(A.rows()));
+  SymbolicCholesky dissected(A, GraphOrdering::nestedDissection(60, 60));
+  SymbolicCholesky minimumDegree(A, GraphOrdering::minimumDegree(A));
+  EXPECT_LT(dissected.factorNonZeros(), natural.factorNonZeros() / 2);
+  EXPECT_LT(minimumDegree.factorNonZeros(), natural.factorNonZeros() / 2);
+  EXPECT_LT(dissected.numSupernodes(), A.rows());
+}
+
+TEST_F(SparseCholeskySolverTest, Solve)
+{
+  SparseMathMatrix<double> A = poisson(9);
+  MathVector<double> b = ramp(A.rows());
+
+  GaussianEliminationSolver<double> gaussian;
+  MathVector<double> expected = gaussian(A, b);
+
+  SparseCholeskySolver<double> solvers[] =
+  {
+    SparseCholeskySolver<double>(SparseCholeskySolver<double>::Method::Natural),
+    SparseCholeskySolver<double>(
+        SparseCholeskySolver<double>::Method::ReverseCuthillMcKee),
+    SparseCholeskySolver<double>(),
+    SparseCholeskySolver<double>(8, 8)
+  };
+  for (const SparseCholeskySolver<double>& solver : solvers)
+  {
+    MathVector<double> x = solver.solve(A, b);
+    for (size_t i = 0; i < b.size(); ++i)
+    {
+      EXPECT_NEAR(expected[i], x[i], 1e-12);
+    }
+  }
+
+  const IMatrixSolver<double>& dynamic = solvers[3];
+  MathVector<double> x = dynamic(MathMatrix<double>(A), b);
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    EXPECT_NEAR(expected[i], x[i], 1e-12);
+  }
+
+  std::unique_ptr<IMatrixFactorization<double> > factored = solvers[2].factor(A);
+  EXPECT_EQ(solvers[2].solve(A, b), factored->solve(b));
+
+  EXPECT_THROW(SparseCholeskySolver<double>(
+        SparseCholeskySolver<double>::Method::NestedDissection),
+      std::domain_error);
+  EXPECT_THROW(SparseCholeskySolver<double>(7, 8).solve(A, b),
+      std::domain_error);
+  EXPECT_THROW(solvers[0].solve(A, MathVector<double>(3)), std::domain_error);
+}
+
+TEST_F(SparseCholeskySolverTest, Refactor)
+{
+  SparseMathMatrix<double> A = poisson(9);
+  SparseMathMatrix<double> shifted = A;
+  for (size_t i = 0; i < A.rows(); ++i)
+  {
+    shifted(i, i) += 1 + 0.1 * i;
+  }
+  MathVector<double> b = ramp(A.rows());
+
+  SparseCholeskySolver<double> solver;
+  std::shared_ptr<const SymbolicCholesky> symbolic = solver.analyze(A);
+  EXPECT_TRUE(symbolic->matches(shifted));
+  EXPECT_FALSE(symbolic->matches(poisson(8)));
+
+  // Refactoring in place gives the factor a fresh analysis would
+  std::unique_ptr<SparseCholeskyFactorization<double> > factored =
+    solver.factor(symbolic, A);
+  MathVector<double> x = factored->solve(b);
+  factored->refactor(shifted);
+  EXPECT_EQ(solver.solve(shifted, b), factored->solve(b));
+  factored->refactor(A);
+  EXPECT_EQ(x, factored->solve(b));
+
+  // A graph analysis keeps no pattern but factors the same
+  SymbolicCholesky fromGraph(GraphOrdering::graphOf(A), solver.ordering(A));
+  EXPECT_FALSE(fromGraph.hasPattern());
+  SparseCholeskyFactorization<double> searched(
+      std::make_shared<const SymbolicCholesky>(fromGraph), shifted);
+  EXPECT_EQ(solver.solve(shifted, b), searched.solve(b));
+
+  // The solver keeps its analysis until the pattern changes
+  std::shared_ptr<const SymbolicCholesky> kept = solver.lastAnalysis();
+  solver.solve(A, b);
+  EXPECT_EQ(kept, solver.lastAnalysis());
+  solver.solve(poisson(8), ramp(49));
+  EXPECT_NE(kept, solver.lastAnalysis());
+  solver.clearAnalysisCache();
+  EXPECT_FALSE(solver.lastAnalysis());
+
+  SparseMathMatrix<double> other = poisson(8);
+  EXPECT_THROW(factored->refactor(other), std::domain_error);
+  EXPECT_THROW(solver.factor(symbolic, other), std::domain_error);
+}
+
+TEST_F(SparseCholeskySolverTest, NotPositiveDefinite)
+{
+  SparseMathMatrix<double> A = -poisson(5);
+  SparseCholeskySolver<double> solver;
+  EXPECT_THROW(solver.solve(A, ramp(A.rows())), std::domain_error);
+}
+
+TEST_F(SparseCholeskySolverTest, NotSymmetric)
+{
+  // The pattern is symmetric but the values are not
+  MathMatrix<double> skewed(3, 3);
+  for (int i = 0; i < 3; ++i)
+  {
+    skewed(i, i) = 4;
+  }
+  skewed(0, 1) = 1;
+  skewed(1, 0) = -1;
+  SparseMathMatrix<double> A(skewed);
+  SparseCholeskySolver<double> solver;
+  EXPECT_THROW(solver.solve(A, ramp(3)), std::domain_error);
+
+  // Only the upper triangle is stored
+  MathMatrix<double> upper(3, 3);
+  for (int i = 0; i < 3; ++i)
+  {
+    upper(i, i) = 4;
+  }
+  upper(0, 1) = 1;
+  upper(1, 2) = 1;
+  EXPECT_THROW(solver.solve(SparseMathMatrix<double>(upper), ramp(3)),
+      std::domain_error);
+
+  // Refactoring is checked as well
+  skewed(1, 0) = 1;
+  SparseMathMatrix<double> symmetric(skewed);
+  std::unique_ptr<SparseCholeskyFactorization<double> > factored =
+    solver.factor(solver.analyze(symmetric), symmetric);
+  EXPECT_THROW(factored->refactor(A), std::domain_error);
+}
+
+TEST_F(SparseCholeskySolverTest, LargeGrid)
+{
+  // Far more unknowns than dense elimination could store, the factor being
+  // the same for any thread count
+  const int numDivs = 121;
+  SparseCholeskySolver<double> solver(numDivs - 1, numDivs - 1);
+  GaussianEliminationSolver<double> unused;
+  DirichletPoisson<double> dirichlet(0, 0, 1.0, unused);
+
+  ThreadCountScope threads(1);
+  MathVector<double> serial = dirichlet.getSparseSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(numDivs,
+        solver);
+
+  threads.set(4);
+  MathVector<double> parallel = dirichlet.getSparseSolution
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(numDivs,
+        solver);
+  EXPECT_EQ(serial, parallel);
+
+  SparseMathMatrix<double> A = dirichlet.getSparseOperator(numDivs);
+  MathVector<double> b(A.rows());
+  dirichlet.generateConstants
+    <lowerBound, upperBound, leftBound, rightBound, forcingFunction>(b);
+  EXPECT_LT(residual(A, parallel, b), 1e-10 * b.getMagnitude());
+}
@@ -0,0 +1,156 @@
+/*
+ * author Connor Walsh
+ * file   SparseMathMatrixTest.h
+ * brief  Class to represent a set of unit tests for SparseMathMatrix
+ */
+
+#include <stdexcept>
+#include <sstream>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/SparseMathMatrix.h"
+#include "../linear_algebra/ordering/Permutation.h"
+#include "../parallel/ThreadPool.h"
+
+class SparseMathMatrixTest : public ::testing::Test
+{
+  protected:
+    // Matrix with a few entries per row, some far from the diagonal
+    static MathMatrix<double> scattered(int rows, int cols)
+    {
+      MathMatrix<double> dense(rows, cols);
+      for (int i = 0; i < rows; ++i)
+      {
+        for (int j = 0; j < cols; ++j)
+        {
+          if ((i * 7 + j * 3) % 5 == 0 || i == j)
+          {
+            dense(i, j) = 1 + i - 0.5 * j;
+          }
+        }
+      }
+      return dense;
+    }
+};
+
+TEST_F(SparseMathMatrixTest, Construction)
+{
+  SparseMathMatrix<double> empty;
+  EXPECT_EQ(0u, empty.rows());
+  EXPECT_EQ(0u, empty.nonZeros());
+
+  MathMatrix<double> dense = scattered(6, 5);
+  SparseMathMatrix<double> A(dense);
+  EXPECT_TRUE(A == dense);
+  EXPECT_EQ(6u, A.rows());
+  EXPECT_EQ(5u, A.cols());
+
+  size_t nonZeros = 0;
+  for (int i = 0; i < 6; ++i)
+  {
+    for (int j = 0; j < 5; ++j)
+    {
+      if (dense(i, j) != 0) ++nonZeros;
+    }
+  }
+  EXPECT_EQ(nonZeros, A.nonZeros());
+
+  A(1, 1) = 9;
+  EXPECT_EQ(9, A(1, 1));
+  EXPECT_THROW(A(0, 1) = 1, std::out_of_range);
+  EXPECT_THROW(A(6, 0), std::out_of_range);
+  const SparseMathMatrix<double>& view = A;
+  EXPECT_EQ(0, view(0, 1));
+
+  SparseMathMatrix<double> fromArrays(2, 3, {0, 2, 3}, {0, 2, 1},
+      MathVector<double>(3));
+  EXPECT_EQ(3u, fromArrays.nonZeros());
+  EXPECT_THROW(SparseMathMatrix<double>(2, 3, {0, 2, 3}, {2, 0, 1},
+        MathVector<double>(3)), std::domain_error);
+  EXPECT_THROW(SparseMathMatrix<double>(2, 3, {0, 2}, {0, 2},
+        MathVector<double>(2)), std::domain_error);
+}
+
+TEST_F(SparseMathMatrixTest, Arithmetic)
+{
+  MathMatrix<double> dense = scattered(5, 5);
+  SparseMathMatrix<double> A(dense);
+  SparseMathMatrix<double> B(dense.transpose());
+
+  SparseMathMatrix<double> sum = A + B;
+  EXPECT_TRUE(sum == dense + dense.transpose());
+  EXPECT_TRUE((A - B) == dense - dense.transpose());
+  EXPECT_TRUE(-A == dense * -1.0);
+  EXPECT_TRUE(A * 2.0 == dense * 2.0);
+  EXPECT_TRUE(A * dense == dense * dense);
+  EXPECT_TRUE(A.transpose() == dense.transpose());
+  EXPECT_EQ(B, A.transpose());
+
+  A += dense;
+  EXPECT_TRUE(A == dense * 2.0);
+  A *= dense;
+  EXPECT_TRUE(A == (dense * 2.0) * dense);
+}
+
+TEST_F(SparseMathMatrixTest, MultiplyVector)
+{
+  const int size = 400;
+  MathMatrix<double> dense = scattered(size, size);
+  SparseMathMatrix<double> A(dense);
+
+  MathVector<double> x(size);
+  for (int i = 0; i < size; ++i)
+  {
+    x[i] = (i % 5) - 2.0;
+  }
+
+  ThreadCountScope threads(1);
+  MathVector<double> serial = A * x;
+  EXPECT_EQ(dense * x, serial);
+
+  threads.set(4);
+  MathVector<double> y;
+  A.multiply(x, y);
+  EXPECT_EQ(serial, y);
+
+  EXPECT_THROW(A * MathVector<double>(size - 1), std::domain_error);
+}
+
+TEST_F(SparseMathMatrixTest, Permute)
+{
+  MathMatrix<double> dense = scattered(6, 6);
+  SparseMathMatrix<double> A(dense);
+  Permutation permutation({3, 0, 5, 1, 4, 2});
+
+  const SparseMathMatrix<double> permuted = A.permuted(permutation);
+  for (size_t k = 0; k < 6; ++k)
+  {
+    for (size_t l = 0; l < 6; ++l)
+    {
+      EXPECT_EQ(dense(permutation.order(k), permutation.order(l)),
+          permuted(k, l));
+    }
+  }
+  EXPECT_EQ(A, permuted.permuted(permutation.inverse()));
+
+  // One entry in row 4 reaching back to column 1
+  SparseMathMatrix<double> band(5, 5, {0, 1, 2, 3, 4, 6}, {0, 1, 2, 3, 1, 4},
+      MathVector<double>(6));
+  EXPECT_EQ(3u, band.bandwidth());
+  EXPECT_EQ(3u, band.profile());
+  EXPECT_THROW(band.permuted(Permutation(4)), std::domain_error);
+}
+
+TEST_F(SparseMathMatrixTest, Stream)
+{
+  SparseMathMatrix<double> A(scattered(3, 3));
+  std::stringstream stream;
+  stream << A;
+
+  SparseMathMatrix<double> read(3, 3);
+  stream >> read;
+  EXPECT_EQ(A, read);
+}
@@ -0,0 +1,144 @@
+/*
+ * author Connor Walsh
+ * file   SymmetricMathMatrixTest.h
+ * brief  Class to represent a set of unit tests for SymmetricMathMatrix
+ */
+
+#include <stdexcept>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/SymmetricMathMatrix.h"
+#include "../parallel/ThreadPool.h"
+
+class SymmetricMathMatrixTest : public ::testing::Test
+{
+  protected:
+    static SymmetricMathMatrix<double> numbered(int size)
+    {
+      SymmetricMathMatrix<double> matrix(size);
+      for (int i = 0; i < size; ++i)
+      {
+        for (int j = 0; j <= i; ++j)
+        {
+          matrix(i, j) = (i == j) ? size + i : 1.0 / (1 + i + 2 * j);
+        }
+      }
+      return matrix;
+    }
+};
+
+TEST_F(SymmetricMathMatrixTest, Construction)
+{
+  SymmetricMathMatrix<double> empty;
+  EXPECT_EQ(0u, empty.rows());
+  EXPECT_EQ(0u, empty.cols());
+
+  SymmetricMathMatrix<double> A(4);
+  EXPECT_EQ(4u, A.rows());
+  EXPECT_EQ(10u, A.packed().size());
+  A(0, 3) = 2;
+  EXPECT_EQ(2, A(3, 0));
+  EXPECT_EQ(2, A.packed()[6]);
+  EXPECT_THROW(A(4, 0), std::out_of_range);
+
+  MathMatrix<double> dense(numbered(4));
+  SymmetricMathMatrix<double> fromDense(dense);
+  EXPECT_EQ(numbered(4), fromDense);
+  EXPECT_TRUE(dense == fromDense);
+
+  dense(0, 2) = 7;
+  EXPECT_THROW(SymmetricMathMatrix<double> bad(dense), std::domain_error);
+  EXPECT_THROW(SymmetricMathMatrix<double> bad(MathMatrix<double>(2, 3)),
+      std::domain_error);
+}
+
+TEST_F(SymmetricMathMatrixTest, Arithmetic)
+{
+  SymmetricMathMatrix<double> A = numbered(5);
+  MathMatrix<double> dense(A);
+
+  SymmetricMathMatrix<double> sum = A + A;
+  EXPECT_TRUE(sum == dense + dense);
+  EXPECT_TRUE((A - A) == MathMatrix<double>(5, 5));
+  EXPECT_TRUE(-A == dense * -1.0);
+  EXPECT_TRUE(A * 3.0 == dense * 3.0);
+  EXPECT_TRUE(A * dense == dense * dense);
+  EXPECT_EQ(A, A.transpose());
+
+  MathMatrix<double> skew(5, 5);
+  skew(4, 0) = 1;
+  EXPECT_THROW(A += skew, std::domain_error);
+  EXPECT_EQ(numbered(5), A);
+}
+
+TEST_F(SymmetricMathMatrixTest, MultiplyVector)
+{
+  // Large enough to be split into several blocks of rows
+  const int size = 300;
+  SymmetricMathMatrix<double> A = numbered(size);
+  MathMatrix<double> dense(A);
+
+  MathVector<double> x(size);
+  for (int i = 0; i < size; ++i)
+  {
+    x[i] = (i % 7) - 3.0;
+  }
+
+  MathVector<double> expected = dense * x;
+  ThreadCountScope threads(1);
+  MathVector<double> serial = A * x;
+  for (int i = 0; i < size; ++i)
+  {
+    EXPECT_NEAR(expected[i], serial[i], 1e-10);
+  }
+
+  threads.set(4);
+  MathVector<double> y;
+  A.multiply(x, y);
+  EXPECT_EQ(serial, y);
+
+  EXPECT_THROW(A * MathVector<double>(size + 1), std::domain_error);
+}
+
+TEST_F(SymmetricMathMatrixTest, RankUpdate)
+{
+  MathMatrix<double> V(6, 3);
+  for (int i = 0; i < 6; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      V(i, j) = i - 2 * j + 0.5;
+    }
+  }
+
+  SymmetricMathMatrix<double> A = numbered(6);
+  MathMatrix<double> expected = MathMatrix<double>(A) * 0.5 +
+    (V * V.transpose()) * 2.0;
+  A.rankUpdate(V, 2.0, 0.5);
+  EXPECT_TRUE(A == expected);
+
+  // Normal equation matrix of V
+  SymmetricMathMatrix<double> gram(3);
+  gram.rankUpdate(V.transpose(), 1.0, 0.0);
+  EXPECT_TRUE(gram == V.transpose() * V);
+
+  EXPECT_THROW(gram.rankUpdate(V), std::domain_error);
+}
+
+TEST_F(SymmetricMathMatrixTest, Stream)
+{
+  SymmetricMathMatrix<double> A(3);
+  A(0, 0) = 4;
+  A(1, 0) = -1;
+  A(2, 1) = 2.5;
+  A(2, 2) = 3;
+  std::stringstream stream;
+  stream << A;
+
+  SymmetricMathMatrix<double> read(3);
+  stream >> read;
+  EXPECT_EQ(A, read);
+}
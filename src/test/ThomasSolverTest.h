@@ -0,0 +1,124 @@
+/*
+ * author Connor Walsh
+ * file   ThomasSolverTest.h
+ * brief  Class to represent a set of unit tests for ThomasSolver and the
+ *        batched Thomas solver
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "../linear_algebra/matrix_solver/ThomasSolver.h"
+#include "../linear_algebra/matrix_solver/BatchedThomasSolver.h"
+#include "../linear_algebra/matrix_solver/GaussianEliminationSolver.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/TriDiagonalMathMatrix.h"
+
+class ThomasSolverTest : public ::testing::Test
+{
+  protected:
+    // Diagonally dominant system number system of a family
+    static void makeSystem(int system, TriDiagonalMathMatrix<double>& A,
+        MathVector<double>& b)
+    {
+      for (size_t i = 0; i < A.rows(); ++i)
+      {
+        A(i, i) = 4 + 0.1 * system + 0.01 * i;
+        if (i > 0) A(i, i - 1) = -1 - 0.05 * i;
+        if (i + 1 < A.rows()) A(i, i + 1) = -1 + 0.02 * system;
+        b[i] = system - 0.5 * i;
+      }
+    }
+};
+
+TEST_F(ThomasSolverTest, Solve)
+{
+  TriDiagonalMathMatrix<double> A(20);
+  MathVector<double> b(20);
+  makeSystem(3, A, b);
+
+  ThomasSolver<double> thomas;
+  GaussianEliminationSolver<double> gauss;
+  MathVector<double> expected = gauss(MathMatrix<double>(A), b);
+  MathVector<double> result = thomas.solve(A, b);
+  for (int i = 0; i < 20; ++i)
+  {
+    EXPECT_NEAR(expected[i], result[i], 1e-12);
+  }
+
+  const IMatrixSolver<double>& solver = thomas;
+  EXPECT_EQ(result, solver(MathMatrix<double>(A), b));
+
+  MathMatrix<double> dense(A);
+  dense(0, 5) = 1;
+  EXPECT_THROW(solver(dense, b), std::domain_error);
+  EXPECT_THROW(thomas.solve(A, MathVector<double>(3)), std::domain_error);
+
+  TriDiagonalMathMatrix<double> singular(3, 1, 0, 1);
+  EXPECT_THROW(thomas.solve(singular, MathVector<double>(3)),
+      std::domain_error);
+}
+
+TEST_F(ThomasSolverTest, Factor)
+{
+  TriDiagonalMathMatrix<double> A(12);
+  MathVector<double> b(12);
+  makeSystem(1, A, b);
+
+  ThomasSolver<double> thomas;
+  std::unique_ptr<IMatrixFactorization<double> > factors = thomas.factor(A);
+
+  MathMatrix<double> B(12, 5);
+  for (int row = 0; row < 12; ++row)
+  {
+    for (int col = 0; col < 5; ++col)
+    {
+      B(row, col) = b[row] * (col + 1) - col;
+    }
+  }
+  MathMatrix<double> X = factors->solve(B);
+  for (int col = 0; col < 5; ++col)
+  {
+    MathVector<double> column(12);
+    for (int row = 0; row < 12; ++row)
+    {
+      column[row] = B(row, col);
+    }
+    factors->solveInPlace(column);
+    for (int row = 0; row < 12; ++row)
+    {
+      EXPECT_EQ(column[row], X(row, col));
+    }
+  }
+}
+
+TEST_F(ThomasSolverTest, Batched)
+{
+  int count = 50;
+  int size = 9;
+  BatchedTriDiagonalSystems<double> systems(count, size);
+  TriDiagonalMathMatrix<double> A(size);
+  MathVector<double> b(size);
+  for (int system = 0; system < count; ++system)
+  {
+    makeSystem(system, A, b);
+    systems.setSystem(system, A, b);
+  }
+
+  BatchedThomasSolver<double> batched;
+  batched.solveInPlace(systems);
+
+  ThomasSolver<double> thomas;
+  for (int system = 0; system < count; ++system)
+  {
+    makeSystem(system, A, b);
+    EXPECT_EQ(thomas.solve(A, b), systems.solution(system));
+  }
+
+  EXPECT_THROW(systems.setSystem(count, A, b), std::out_of_range);
+  EXPECT_THROW(systems.setSystem(0, TriDiagonalMathMatrix<double>(2), b),
+      std::domain_error);
+}
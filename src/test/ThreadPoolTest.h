@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////////
+// author Connor Walsh
+// file   ThreadPoolTest.h
+// brief  Class to represent a set of unit tests for ThreadPool
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <vector>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "../parallel/ThreadPool.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+
+class ThreadPoolTest : public ::testing::Test {
+};
+
+TEST_F(ThreadPoolTest, ParallelFor)
+{
+  ThreadPool pool(4);
+  EXPECT_EQ(4, pool.threadCount());
+
+  std::vector<int> covered(1000, 0);
+  pool.parallelFor(0, covered.size(), 7,
+      [&](std::size_t first, std::size_t last)
+      {
+        for (std::size_t i = first; i < last; ++i)
+        {
+          ++covered[i];
+        }
+      });
+  for (int count : covered)
+  {
+    EXPECT_EQ(1, count);
+  }
+
+  // Nested loops are run by the threads already working for the pool
+  std::vector<int> nested(64 * 64, 0);
+  pool.parallelFor(0, 64, 1,
+      [&](std::size_t firstRow, std::size_t lastRow)
+      {
+        for (std::size_t row = firstRow; row < lastRow; ++row)
+        {
+          pool.parallelFor(0, 64, 4,
+              [&](std::size_t firstCol, std::size_t lastCol)
+              {
+                for (std::size_t col = firstCol; col < lastCol; ++col)
+                {
+                  nested[row * 64 + col] += 1;
+                }
+              });
+        }
+      });
+  for (int count : nested)
+  {
+    EXPECT_EQ(1, count);
+  }
+}
+
+TEST_F(ThreadPoolTest, ParallelReduce)
+{
+  auto sum = [](std::size_t first, std::size_t last)
+  {
+    long result = 0;
+    for (std::size_t i = first; i < last; ++i)
+    {
+      result += i;
+    }
+    return result;
+  };
+  auto add = [](long lhs, long rhs) { return lhs + rhs; };
+
+  ThreadPool serial(1);
+  ThreadPool parallel(3);
+  long serialSum = serial.parallelReduce(0, 10001, 64, 0L, sum, add);
+  long parallelSum = parallel.parallelReduce(0, 10001, 64, 0L, sum, add);
+  EXPECT_EQ(50005000, serialSum);
+  EXPECT_EQ(serialSum, parallelSum);
+}
+
+TEST_F(ThreadPoolTest, Exceptions)
+{
+  ThreadPool pool(3);
+  EXPECT_THROW(pool.parallelFor(0, 100, 1,
+      [](std::size_t first, std::size_t)
+      {
+        if (first == 50)
+        {
+          throw std::domain_error("piece failed");
+        }
+      }), std::domain_error);
+}
+
+TEST_F(ThreadPoolTest, SharedPoolMatrixProduct)
+{
+  MathMatrix<double> A(64, 64);
+  for (int row = 0; row < 64; ++row)
+  {
+    for (int col = 0; col < 64; ++col)
+    {
+      A(row, col) = row - col;
+    }
+  }
+
+  std::size_t original = ThreadPool::instance().threadCount();
+  {
+    ThreadCountScope threads(1);
+    MathMatrix<double> serial = A * A;
+    threads.set(4);
+    EXPECT_EQ(4, ThreadPool::instance().threadCount());
+    MathMatrix<double> parallel = A * A;
+    EXPECT_EQ(serial, parallel);
+  }
+  EXPECT_EQ(original, ThreadPool::instance().threadCount());
+}
@@ -0,0 +1,98 @@
+/*
+ * author Connor Walsh
+ * file   TriDiagonalMathMatrixTest.h
+ * brief  Class to represent a set of unit tests for TriDiagonalMathMatrix
+ */
+
+#include <stdexcept>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "../linear_algebra/MathVector.h"
+#include "../linear_algebra/math_matrix/MathMatrix.h"
+#include "../linear_algebra/math_matrix/TriDiagonalMathMatrix.h"
+
+class TriDiagonalMathMatrixTest : public ::testing::Test
+{
+  protected:
+    static TriDiagonalMathMatrix<double> numbered(int size)
+    {
+      TriDiagonalMathMatrix<double> matrix(size);
+      for (int i = 0; i < size; ++i)
+      {
+        matrix(i, i) = 10 + i;
+        if (i > 0) matrix(i, i - 1) = -i;
+        if (i + 1 < size) matrix(i, i + 1) = 2 * i + 1;
+      }
+      return matrix;
+    }
+};
+
+TEST_F(TriDiagonalMathMatrixTest, Construction)
+{
+  TriDiagonalMathMatrix<double> empty;
+  EXPECT_EQ(0u, empty.rows());
+  EXPECT_EQ(0u, empty.cols());
+
+  TriDiagonalMathMatrix<double> constant(4, -1, 2, -3);
+  EXPECT_EQ(4u, constant.rows());
+  EXPECT_EQ(4u, constant.cols());
+  EXPECT_EQ(-1, constant(2, 1));
+  EXPECT_EQ(2, constant(2, 2));
+  EXPECT_EQ(-3, constant(2, 3));
+  const TriDiagonalMathMatrix<double>& view = constant;
+  EXPECT_EQ(0, view(0, 3));
+  EXPECT_EQ(0, constant.lower()[0]);
+  EXPECT_EQ(0, constant.upper()[3]);
+
+  EXPECT_THROW(constant(0, 2) = 1, std::out_of_range);
+  EXPECT_THROW(constant(4, 4), std::out_of_range);
+
+  MathMatrix<double> dense(constant);
+  TriDiagonalMathMatrix<double> fromDense(dense);
+  EXPECT_EQ(constant, fromDense);
+  EXPECT_TRUE(dense == fromDense);
+
+  dense(0, 2) = 1;
+  EXPECT_THROW(TriDiagonalMathMatrix<double> bad(dense), std::domain_error);
+  EXPECT_THROW(TriDiagonalMathMatrix<double> bad(MathMatrix<double>(2, 3)),
+      std::domain_error);
+}
+
+TEST_F(TriDiagonalMathMatrixTest, Arithmetic)
+{
+  TriDiagonalMathMatrix<double> A = numbered(5);
+  MathMatrix<double> dense(A);
+
+  MathVector<double> x(5);
+  for (int i = 0; i < 5; ++i)
+  {
+    x[i] = i - 1.5;
+  }
+  EXPECT_EQ(dense * x, A * x);
+
+  TriDiagonalMathMatrix<double> sum = A + A;
+  EXPECT_TRUE(sum == dense + dense);
+  EXPECT_TRUE((A - A) == MathMatrix<double>(5, 5));
+  EXPECT_TRUE(-A == dense * -1.0);
+  EXPECT_TRUE(A * 3.0 == dense * 3.0);
+  EXPECT_TRUE(A * dense == dense * dense);
+  EXPECT_TRUE(A.transpose() == dense.transpose());
+
+  MathMatrix<double> full(5, 5);
+  full(4, 0) = 1;
+  EXPECT_THROW(A += full, std::domain_error);
+  EXPECT_THROW(A *= dense, std::domain_error);
+  EXPECT_EQ(numbered(5), A);
+}
+
+TEST_F(TriDiagonalMathMatrixTest, Stream)
+{
+  TriDiagonalMathMatrix<double> A = numbered(3);
+  std::stringstream stream;
+  stream << A;
+
+  TriDiagonalMathMatrix<double> read(3);
+  stream >> read;
+  EXPECT_EQ(A, read);
+}
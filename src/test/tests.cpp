@@ -2,10 +2,29 @@
 
 #include "MathVectorTest.h"
 #include "ArrayTest.h"
+#include "MonotonicArenaTest.h"
+#include "ThreadPoolTest.h"
 #include "MathMatrixTest.h"
+#include "MathMatrixViewTest.h"
 #include "UpTriangleMathMatrixTest.h"
+#include "TriDiagonalMathMatrixTest.h"
+#include "SymmetricMathMatrixTest.h"
+#include "SparseMathMatrixTest.h"
 #include "GaussianEliminationSolverTest.h"
+#include "BatchedGaussianSolverTest.h"
 #include "QRSolverTest.h"
+#include "ConjugateGradientSolverTest.h"
+#include "JacobiSolverTest.h"
+#include "SORSolverTest.h"
+#include "RedBlackSORSolverTest.h"
+#include "ADISolverTest.h"
+#include "ThomasSolverTest.h"
+#include "ReorderedSolverTest.h"
+#include "SparseCholeskySolverTest.h"
+#include "GMRESSolverTest.h"
+#include "BiCGSTABSolverTest.h"
+#include "PipelinedConjugateGradientSolverTest.h"
+#include "SolverWorkspaceTest.h"
 #include "DirichletPoissonTest.h"
 
 int main(int argc, char** argv)